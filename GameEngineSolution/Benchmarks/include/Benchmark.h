@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+// ==================================================================================
+// Benchmark helpers
+// ----------------------------------------------------------------------------------
+// Minimal timing utilities shared by the benchmark suites. Each suite is a free
+// function registered in main.cpp and prints one line per measurement.
+// ==================================================================================
+namespace Benchmark {
+
+// Run 'fn' 'iterations' times after one warm-up call; returns the average in nanoseconds
+template<typename Func>
+double Measure(int iterations, Func&& fn) {
+    fn();
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        fn();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+inline void PrintHeader(const std::string& suite) {
+    std::printf("\n=== %s ===\n", suite.c_str());
+}
+
+inline void PrintResult(const std::string& name, double nanoseconds, const char* unit = "op") {
+    if (nanoseconds >= 1.0e6) {
+        std::printf("  %-52s %10.3f ms/%s\n", name.c_str(), nanoseconds / 1.0e6, unit);
+    } else if (nanoseconds >= 1.0e3) {
+        std::printf("  %-52s %10.3f us/%s\n", name.c_str(), nanoseconds / 1.0e3, unit);
+    } else {
+        std::printf("  %-52s %10.1f ns/%s\n", name.c_str(), nanoseconds, unit);
+    }
+}
+
+// Benchmark suites
+void RunJobSystemBenchmarks();
+void RunEntityScalingBenchmarks();
+void RunSnapshotBenchmarks();
+void RunGroupBenchmarks();
+void RunArchetypeBenchmarks();
+void RunSharedComponentBenchmarks();
+void RunEntityPoolBenchmarks();
+void RunReactiveQueueBenchmarks();
+void RunTimeSliceBenchmarks();
+void RunSpatialOrderBenchmarks();
+void RunEventBusBenchmarks();
+void RunLoggerBenchmarks();
+
+} // namespace Benchmark
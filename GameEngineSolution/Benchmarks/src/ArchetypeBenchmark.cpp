@@ -0,0 +1,94 @@
+#include "../include/Benchmark.h"
+#include "ECS/ComponentManager.h"
+#include "ECS/View.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace Benchmark {
+
+namespace {
+
+constexpr size_t BODY_COUNT = 100'000;
+constexpr size_t SCENERY_COUNT = 100'000;
+constexpr int FRAMES = 50;
+
+// Bodies (Transform + Physics + Collider) interleaved with static scenery
+// (Transform + Collider). 'shuffled' adds each component type in its own random
+// order, so the sparse-set dense arrays end up unrelated (as after spawn/despawn churn).
+void Populate(ECS::ComponentManager& componentManager, bool shuffled) {
+    std::vector<ECS::Entity> entities = componentManager.CreateEntities(BODY_COUNT + SCENERY_COUNT);
+    std::vector<ECS::Entity> bodies;
+    for (size_t i = 0; i < entities.size(); i += 2) {
+        bodies.push_back(entities[i]);
+    }
+
+    std::mt19937 random(42);
+    auto add = [&](std::vector<ECS::Entity> targets, auto component) {
+        if (shuffled) {
+            std::shuffle(targets.begin(), targets.end(), random);
+        }
+        std::vector<decltype(component)> components(targets.size(), component);
+        componentManager.AddComponents<decltype(component)>(targets, components);
+    };
+    add(entities, ECS::TransformComponent{});
+    add(entities, ECS::ColliderComponent{});
+    add(bodies, ECS::PhysicsComponent{});
+}
+
+// Per-body work comparable to PhysicsSystem integration plus a collider read
+inline void Step(ECS::PhysicsComponent& physics, ECS::TransformComponent& transform, const ECS::ColliderComponent& collider) {
+    const float dt = 0.016f;
+    physics.velocity.y += physics.gravityAcceleration * dt;
+    transform.position.x += physics.velocity.x * dt;
+    transform.position.y += physics.velocity.y * dt;
+    transform.position.z += physics.velocity.z * dt;
+    physics.isGrounded = transform.position.y - collider.localAABB.extents.y * transform.scale.y <= 0.0f;
+}
+
+// Sparse-set Views also stamp change ticks for the mutable components; chunks have none
+double MeasureView(ECS::ComponentManager& componentManager) {
+    return Measure(FRAMES, [&]() {
+        ECS::View<ECS::PhysicsComponent, ECS::TransformComponent, const ECS::ColliderComponent> bodies(componentManager);
+        bodies.Each([](ECS::Entity, ECS::PhysicsComponent& physics, ECS::TransformComponent& transform, const ECS::ColliderComponent& collider) {
+            Step(physics, transform, collider);
+        });
+    });
+}
+
+} // namespace
+
+void RunArchetypeBenchmarks() {
+    PrintHeader("Sparse sets vs. archetype chunks (Transform + Physics + Collider, 100k bodies)");
+
+    ECS::ComponentManager ordered;
+    Populate(ordered, false);
+    const double sparseOrdered = MeasureView(ordered);
+    PrintResult("Sparse sets, added in entity order: View::Each", sparseOrdered, "frame");
+
+    ECS::ComponentManager shuffled;
+    Populate(shuffled, true);
+    const double sparseShuffled = MeasureView(shuffled);
+    PrintResult("Sparse sets, added in shuffled order: View::Each", sparseShuffled, "frame");
+
+    ECS::ComponentManager archetypes(ECS::StorageMode::Archetype);
+    Populate(archetypes, true);
+    const double chunks = Measure(FRAMES, [&]() {
+        archetypes.ForEachChunk<ECS::PhysicsComponent, ECS::TransformComponent, ECS::ColliderComponent>(
+            [](size_t count, ECS::Entity*, ECS::PhysicsComponent* physics, ECS::TransformComponent* transforms, ECS::ColliderComponent* colliders) {
+                for (size_t i = 0; i < count; ++i) {
+                    Step(physics[i], transforms[i], colliders[i]);
+                }
+            });
+    });
+    PrintResult("Archetype chunks: ForEachChunk", chunks, "frame");
+
+    // View::Each also walks chunks in archetype mode, checking each entity's enabled flag
+    const double chunkView = MeasureView(archetypes);
+    PrintResult("Archetype chunks: View::Each", chunkView, "frame");
+
+    std::printf("  %-52s %10.1fx\n", "ForEachChunk speedup over ordered sparse sets", sparseOrdered / chunks);
+    std::printf("  %-52s %10.1fx\n", "ForEachChunk speedup over shuffled sparse sets", sparseShuffled / chunks);
+}
+
+} // namespace Benchmark
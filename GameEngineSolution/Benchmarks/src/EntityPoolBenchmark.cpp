@@ -0,0 +1,119 @@
+#include "../include/Benchmark.h"
+#include "ECS/ComponentManager.h"
+#include "ECS/CommandBuffer.h"
+#include "ECS/EntityPool.h"
+#include "ECS/Group.h"
+#include "ECS/View.h"
+#include "Events/EventBus.h"
+#include <deque>
+#include <vector>
+
+namespace Benchmark {
+
+namespace {
+
+constexpr size_t WORLD_SIZE = 20'000;     // Static bodies sharing the arrays with the projectiles
+constexpr size_t SHOTS_PER_FRAME = 8;     // Automatic weapons
+constexpr size_t PROJECTILE_LIFETIME = 60; // Frames
+constexpr size_t POOL_SIZE = SHOTS_PER_FRAME * PROJECTILE_LIFETIME;
+constexpr int FRAMES = 600;
+
+void PopulateWorld(ECS::ComponentManager& componentManager) {
+    std::vector<ECS::Entity> entities = componentManager.CreateEntities(WORLD_SIZE);
+    componentManager.AddComponents<ECS::TransformComponent>(entities, std::vector<ECS::TransformComponent>(WORLD_SIZE));
+    componentManager.AddComponents<ECS::PhysicsComponent>(entities, std::vector<ECS::PhysicsComponent>(WORLD_SIZE));
+}
+
+// One frame of projectile traffic: expire the oldest shots, fire new ones, play back.
+// 'spawn' and 'retire' record into the buffer, as WeaponSystem/ProjectileSystem do.
+template<typename Spawn, typename Retire>
+double MeasureTraffic(ECS::ComponentManager& componentManager, Spawn&& spawn, Retire&& retire) {
+    ECS::CommandBuffer commands;
+    std::deque<ECS::Entity> live;
+
+    return Measure(FRAMES, [&]() {
+        while (live.size() + SHOTS_PER_FRAME > POOL_SIZE) {
+            retire(commands, live.front());
+            live.pop_front();
+        }
+        for (size_t i = 0; i < SHOTS_PER_FRAME; ++i) {
+            live.push_back(spawn(commands));
+        }
+        commands.Playback(componentManager);
+
+        // Placeholders of created projectiles resolve during playback: track the real
+        // entities through the projectile array instead
+        if (!live.empty() && ECS::CommandBuffer::IsDeferred(live.back())) {
+            auto projectiles = componentManager.GetComponentArray<ECS::ProjectileComponent>();
+            live.clear();
+            for (size_t i = 0; i < projectiles->GetSize(); ++i) {
+                live.push_back(projectiles->GetEntityAtIndex(i));
+            }
+        }
+    });
+}
+
+} // namespace
+
+void RunEntityPoolBenchmarks() {
+    PrintHeader("Projectile churn: create/destroy vs. EntityPool (8 shots/frame)");
+
+    {
+        EventBus eventBus;
+        ECS::ComponentManager componentManager;
+        componentManager.SetEventBus(&eventBus);
+        componentManager.DeclareOwningGroup<ECS::PhysicsComponent, ECS::TransformComponent>();
+        PopulateWorld(componentManager);
+
+        double churn = MeasureTraffic(componentManager,
+            [](ECS::CommandBuffer& commands) {
+                ECS::Entity projectile = commands.CreateEntity();
+                commands.AddComponent(projectile, ECS::TransformComponent{});
+                commands.AddComponent(projectile, ECS::PhysicsComponent{});
+                commands.AddComponent(projectile, ECS::ProjectileComponent{});
+                return projectile;
+            },
+            [](ECS::CommandBuffer& commands, ECS::Entity projectile) {
+                commands.DestroyEntity(projectile);
+            });
+        PrintResult("CreateEntity + AddComponent x3 / DestroyEntity", churn, "frame");
+    }
+
+    {
+        EventBus eventBus;
+        ECS::ComponentManager componentManager;
+        componentManager.SetEventBus(&eventBus);
+        componentManager.DeclareOwningGroup<ECS::PhysicsComponent, ECS::TransformComponent>();
+        PopulateWorld(componentManager);
+
+        ECS::EntityPool pool(componentManager, POOL_SIZE, [](ECS::ComponentManager& components, ECS::Entity entity) {
+            components.AddComponent(entity, ECS::TransformComponent{});
+            components.AddComponent(entity, ECS::PhysicsComponent{});
+            components.AddComponent(entity, ECS::ProjectileComponent{});
+        });
+
+        double pooled = MeasureTraffic(componentManager,
+            [&](ECS::CommandBuffer& commands) {
+                ECS::Entity projectile = pool.Acquire(commands);
+                commands.SetComponent(projectile, ECS::TransformComponent{});
+                commands.SetComponent(projectile, ECS::PhysicsComponent{});
+                commands.SetComponent(projectile, ECS::ProjectileComponent{});
+                return projectile;
+            },
+            [&](ECS::CommandBuffer& commands, ECS::Entity projectile) {
+                pool.Release(projectile, commands);
+            });
+        PrintResult("EntityPool Acquire + SetComponent x3 / Release", pooled, "frame");
+
+        // What parked entities cost everyone else: the group walk skips them
+        double walk = Measure(50, [&]() {
+            ECS::Group<ECS::PhysicsComponent, ECS::TransformComponent> bodies(componentManager);
+            bodies.Each([](ECS::Entity, ECS::PhysicsComponent& physics, ECS::TransformComponent& transform) {
+                transform.position.y += physics.velocity.y * 0.016f;
+            });
+        });
+        PrintResult("Group<Physics, Transform>::Each with parked pool", walk, "frame");
+    }
+}
+
+} // namespace Benchmark
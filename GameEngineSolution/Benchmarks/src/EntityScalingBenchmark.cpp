@@ -0,0 +1,113 @@
+#include "../include/Benchmark.h"
+#include "ECS/ComponentManager.h"
+#include "ECS/View.h"
+#include <string>
+#include <vector>
+
+namespace Benchmark {
+
+namespace {
+
+constexpr size_t ENTITY_COUNT = 1'000'000;
+constexpr size_t RARE_COMPONENT_COUNT = 16;
+
+void BenchmarkCreation() {
+    // One fresh manager per iteration: measures creation from empty storage
+    double create = Measure(3, [&]() {
+        ECS::ComponentManager componentManager;
+        std::vector<ECS::Entity> entities = componentManager.CreateEntities(ENTITY_COUNT);
+        std::vector<ECS::TransformComponent> transforms(ENTITY_COUNT);
+        componentManager.AddComponents<ECS::TransformComponent>(entities, transforms);
+    });
+    PrintResult("CreateEntities + AddComponents<Transform>, 1M", create, "batch");
+}
+
+void BenchmarkSparseMemory() {
+    ECS::ComponentManager componentManager;
+    std::vector<ECS::Entity> entities = componentManager.CreateEntities(ENTITY_COUNT);
+    std::vector<ECS::TransformComponent> transforms(ENTITY_COUNT);
+    componentManager.AddComponents<ECS::TransformComponent>(entities, transforms);
+
+    // A component only a few entities (spread over the whole id range) use
+    for (size_t i = 0; i < RARE_COMPONENT_COUNT; ++i) {
+        componentManager.AddComponent(entities[i * (ENTITY_COUNT / RARE_COMPONENT_COUNT)], ECS::CameraComponent{});
+    }
+
+    auto transformArray = componentManager.GetComponentArray<ECS::TransformComponent>();
+    auto cameraArray = componentManager.GetComponentArray<ECS::CameraComponent>();
+    std::printf("  %-52s %10zu pages (%zu KB)\n", "Transform sparse pages, 1M entities",
+        transformArray->GetSparsePageCount(), transformArray->GetSparsePageCount() * 4);
+    std::printf("  %-52s %10zu pages (%zu KB)\n", "Camera sparse pages, 16 entities",
+        cameraArray->GetSparsePageCount(), cameraArray->GetSparsePageCount() * 4);
+
+    double iterate = Measure(20, [&]() {
+        ECS::View<ECS::TransformComponent> view(componentManager);
+        view.Each([](ECS::Entity, ECS::TransformComponent& transform) {
+            transform.position.y += 1.0f;
+        });
+    });
+    PrintResult("View<Transform>::Each, 1M", iterate, "frame");
+
+    volatile float sink = 0.0f;
+    double lookup = Measure(20, [&]() {
+        const ECS::ComponentManager& components = componentManager;
+        float sum = 0.0f;
+        for (size_t i = 0; i < ENTITY_COUNT; i += 7) {
+            sum += components.GetComponent<ECS::TransformComponent>(entities[i]).position.y;
+        }
+        sink = sum;
+    });
+    PrintResult("GetComponent<Transform> (paged lookup), 1M/7", lookup, "pass");
+}
+
+// Destroy every 4th of 1M entities (Transform on all, Physics on half). Only the
+// destruction is timed; each run starts from a freshly populated manager.
+template<typename Destroy>
+double MeasureDestruction(Destroy&& destroy) {
+    constexpr int ITERATIONS = 3;
+    double total = 0.0;
+    for (int i = 0; i < ITERATIONS; ++i) {
+        ECS::ComponentManager componentManager;
+        std::vector<ECS::Entity> entities = componentManager.CreateEntities(ENTITY_COUNT);
+        std::vector<ECS::TransformComponent> transforms(ENTITY_COUNT);
+        componentManager.AddComponents<ECS::TransformComponent>(entities, transforms);
+
+        std::vector<ECS::Entity> bodies;
+        std::vector<ECS::Entity> doomed;
+        for (size_t e = 0; e < ENTITY_COUNT; ++e) {
+            if (e % 2 == 0) bodies.push_back(entities[e]);
+            if (e % 4 == 0) doomed.push_back(entities[e]);
+        }
+        componentManager.AddComponents<ECS::PhysicsComponent>(bodies, std::vector<ECS::PhysicsComponent>(bodies.size()));
+
+        auto start = std::chrono::high_resolution_clock::now();
+        destroy(componentManager, doomed);
+        total += std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+    return total / ITERATIONS;
+}
+
+void BenchmarkDestruction() {
+    double single = MeasureDestruction([](ECS::ComponentManager& componentManager, const std::vector<ECS::Entity>& doomed) {
+        for (ECS::Entity entity : doomed) {
+            componentManager.DestroyEntity(entity);
+        }
+    });
+    PrintResult("DestroyEntity x 250k", single, "batch");
+
+    double bulk = MeasureDestruction([](ECS::ComponentManager& componentManager, const std::vector<ECS::Entity>& doomed) {
+        componentManager.DestroyEntities(doomed);
+    });
+    PrintResult("DestroyEntities (250k)", bulk, "batch");
+}
+
+} // namespace
+
+void RunEntityScalingBenchmarks() {
+    PrintHeader("Entity scaling (paged sparse sets)");
+    BenchmarkCreation();
+    BenchmarkSparseMemory();
+    BenchmarkDestruction();
+}
+
+} // namespace Benchmark
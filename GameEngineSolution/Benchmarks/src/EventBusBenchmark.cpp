@@ -0,0 +1,183 @@
+#include "../include/Benchmark.h"
+#include "ECS/Components.h"
+#include "Events/ApplicationEvents.h"
+#include "Events/ECSEvents.h"
+#include "Events/EventBus.h"
+#include "Events/InputEvents.h"
+#include <array>
+#include <thread>
+#include <vector>
+
+namespace Benchmark {
+
+namespace {
+
+constexpr size_t SUBSCRIBERS = 8;
+constexpr int EVENTS = 100'000;
+constexpr int PUBLISHER_THREADS = 4;
+constexpr size_t LIFECYCLE_SUBSCRIBERS = 3; // Render cache, spatial grid, gameplay listener
+constexpr int QUEUED_PER_FRAME = 1000;
+constexpr int FRAMES = 200;
+constexpr int PRODUCER_BASE = 100; // MouseMoved x of the numbered producers' events
+
+// Handler with a little work, like updating input state or a cache entry
+thread_local uint32_t t_sink = 0;
+
+void Work() {
+    uint32_t value = t_sink;
+    for (uint32_t i = 0; i < 16; ++i) {
+        value = value * 31 + i;
+    }
+    t_sink = value;
+}
+
+// ECS lifecycle traffic: one ComponentAdded event per spawned component
+void BenchmarkLifecycleEvents() {
+    PrintHeader("ComponentAdded dispatch: EventType subscribers vs. typed channel (3 subscribers)");
+
+    ECS::Entity entity{ 1, 0 };
+    uint64_t seen = 0;
+
+    {
+        EventBus eventBus;
+        for (size_t i = 0; i < LIFECYCLE_SUBSCRIBERS; ++i) {
+            eventBus.Subscribe(EventType::ComponentAdded, [&seen](Event& e) {
+                seen += static_cast<ComponentAddedEvent&>(e).entity.id;
+            });
+        }
+        double untyped = Measure(EVENTS, [&]() {
+            ComponentAddedEvent event(entity, typeid(ECS::TransformComponent));
+            eventBus.Publish(event);
+        });
+        PrintResult("EventBus::Publish, std::function subscribers", untyped, "event");
+    }
+
+    {
+        EventBus eventBus;
+        EventChannel<ComponentAddedEvent>& added = eventBus.Channel<ComponentAddedEvent>();
+        for (size_t i = 0; i < LIFECYCLE_SUBSCRIBERS; ++i) {
+            added.Subscribe([&seen](ComponentAddedEvent& e) { seen += e.entity.id; });
+        }
+        double typed = Measure(EVENTS, [&]() {
+            ComponentAddedEvent event(entity, typeid(ECS::TransformComponent));
+            eventBus.Channel<ComponentAddedEvent>().Publish(event);
+        });
+        PrintResult("Channel<ComponentAddedEvent>().Publish, Delegates", typed, "event");
+    }
+
+    std::printf("  (checksum %llu)\n", static_cast<unsigned long long>(seen));
+}
+
+// Deferred events: queue a frame's worth, then ProcessEvents
+void BenchmarkQueuedEvents() {
+    PrintHeader("Deferred events (1000 queued per frame, 1 subscriber)");
+
+    EventBus eventBus;
+    uint64_t seen = 0;
+    eventBus.Subscribe(EventType::MouseMoved, [&seen](Event&) { ++seen; });
+
+    double heap = Measure(FRAMES, [&]() {
+        for (int i = 0; i < QUEUED_PER_FRAME; ++i) {
+            eventBus.QueueEvent(std::make_unique<MouseMovedEvent>(1.0f, 2.0f));
+        }
+        eventBus.ProcessEvents();
+    }) / QUEUED_PER_FRAME;
+    PrintResult("QueueEvent(unique_ptr) + ProcessEvents", heap, "event");
+
+    double arena = Measure(FRAMES, [&]() {
+        for (int i = 0; i < QUEUED_PER_FRAME; ++i) {
+            eventBus.QueueEvent<MouseMovedEvent>(1.0f, 2.0f);
+        }
+        eventBus.ProcessEvents();
+    }) / QUEUED_PER_FRAME;
+    PrintResult("QueueEvent<T>(args) (frame arena) + ProcessEvents", arena, "event");
+
+    // Worker threads queueing while the main thread drains. Each producer numbers its
+    // events (x = producer, y = sequence): delivery must keep every producer's order,
+    // across frames too.
+    std::array<float, PUBLISHER_THREADS> lastSequence;
+    lastSequence.fill(-1.0f);
+    std::array<float, PUBLISHER_THREADS> nextSequence{};
+    size_t outOfOrder = 0;
+    eventBus.Subscribe(EventType::MouseMoved, [&](Event& e) {
+        auto& moved = static_cast<MouseMovedEvent&>(e);
+        int producer = static_cast<int>(moved.GetX()) - PRODUCER_BASE;
+        if (producer < 0 || producer >= PUBLISHER_THREADS) return;
+        if (moved.GetY() <= lastSequence[producer]) ++outOfOrder;
+        lastSequence[producer] = moved.GetY();
+    });
+
+    double concurrent = Measure(FRAMES / 10, [&]() {
+        std::vector<std::thread> producers;
+        for (int t = 0; t < PUBLISHER_THREADS; ++t) {
+            producers.emplace_back([&, t]() {
+                for (int i = 0; i < QUEUED_PER_FRAME; ++i) {
+                    eventBus.QueueEvent<MouseMovedEvent>(static_cast<float>(PRODUCER_BASE + t), nextSequence[t]);
+                    nextSequence[t] += 1.0f;
+                }
+            });
+        }
+        eventBus.ProcessEvents();
+        for (auto& producer : producers) {
+            producer.join();
+        }
+        eventBus.ProcessEvents();
+    }) / (static_cast<double>(QUEUED_PER_FRAME) * PUBLISHER_THREADS);
+    PrintResult("QueueEvent<T>, 4 threads (wall time / total events)", concurrent, "event");
+
+    std::printf("  (checksum %llu, out-of-order deliveries %zu)\n", static_cast<unsigned long long>(seen), outOfOrder);
+}
+
+} // namespace
+
+void RunEventBusBenchmarks() {
+    PrintHeader("EventBus publish (8 subscribers per event type)");
+
+    EventBus eventBus;
+    for (size_t i = 0; i < SUBSCRIBERS; ++i) {
+        eventBus.Subscribe(EventType::MouseMoved, [](Event&) { Work(); });
+        eventBus.Subscribe(EventType::WindowResize, [](Event&) { Work(); });
+    }
+
+    MouseMovedEvent moved(1.0f, 2.0f);
+    double single = Measure(EVENTS, [&]() { eventBus.Publish(moved); });
+    PrintResult("Publish, 1 thread", single, "event");
+
+    // Several publishers at once: wall time per event over all threads
+    double concurrent = Measure(1, [&]() {
+        std::vector<std::thread> publishers;
+        for (int t = 0; t < PUBLISHER_THREADS; ++t) {
+            publishers.emplace_back([&]() {
+                MouseMovedEvent event(1.0f, 2.0f);
+                for (int i = 0; i < EVENTS; ++i) {
+                    eventBus.Publish(event);
+                }
+            });
+        }
+        for (auto& publisher : publishers) {
+            publisher.join();
+        }
+    }) / (static_cast<double>(EVENTS) * PUBLISHER_THREADS);
+    PrintResult("Publish, 4 threads (wall time / total events)", concurrent, "event");
+
+    // Subscription churn pays for the copy-on-write
+    double churn = Measure(EVENTS / 10, [&]() {
+        EventBus::SubscriptionId id = eventBus.Subscribe(EventType::MouseMoved, [](Event&) {});
+        eventBus.Unsubscribe(EventType::MouseMoved, id);
+    });
+    PrintResult("Subscribe + Unsubscribe", churn, "pair");
+
+    // A handler that publishes: deadlocked before the copy-on-write lists
+    eventBus.Subscribe(EventType::KeyPressed, [&](Event&) {
+        WindowResizeEvent resized(1280, 720);
+        eventBus.Publish(resized);
+    });
+    KeyPressedEvent pressed(65, 0);
+    double nested = Measure(EVENTS, [&]() { eventBus.Publish(pressed); });
+    PrintResult("Publish with a nested Publish", nested, "event");
+
+    BenchmarkLifecycleEvents();
+    BenchmarkQueuedEvents();
+}
+
+} // namespace Benchmark
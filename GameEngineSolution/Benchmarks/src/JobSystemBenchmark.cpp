@@ -0,0 +1,109 @@
+#include "../include/Benchmark.h"
+#include "Jobs/JobSystem.h"
+#include "Jobs/ParallelFor.h"
+#include "ECS/ComponentManager.h"
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace Benchmark {
+
+namespace {
+
+constexpr int ITERATIONS = 200;
+constexpr int JOBS_PER_BATCH = 1000;
+constexpr uint32_t TRANSFORM_COUNT = 5000;
+
+// Per-entity work comparable to PhysicsSystem integration
+void Integrate(ECS::TransformComponent& transform, float dt) {
+    transform.rotation.y += dt;
+    transform.position.x += std::sin(transform.rotation.y) * dt;
+    transform.position.z += std::cos(transform.rotation.y) * dt;
+}
+
+void BenchmarkJobOverhead(Jobs::JobSystem& jobSystem) {
+    std::atomic<int> sink{ 0 };
+
+    // Empty jobs spawned from the main thread (injection queue)
+    double injected = Measure(ITERATIONS, [&]() {
+        Jobs::JobCounter counter;
+        for (int i = 0; i < JOBS_PER_BATCH; ++i) {
+            jobSystem.Run([&sink]() { sink.fetch_add(1, std::memory_order_relaxed); }, counter);
+        }
+        jobSystem.Wait(counter);
+    });
+    PrintResult("Run+Wait, empty job (spawned by main thread)", injected / JOBS_PER_BATCH, "job");
+
+    // Empty jobs spawned from a worker (own deque, stolen by the others)
+    double nested = Measure(ITERATIONS, [&]() {
+        Jobs::JobCounter outer;
+        jobSystem.Run([&]() {
+            Jobs::JobCounter inner;
+            for (int i = 0; i < JOBS_PER_BATCH; ++i) {
+                jobSystem.Run([&sink]() { sink.fetch_add(1, std::memory_order_relaxed); }, inner);
+            }
+            jobSystem.Wait(inner);
+        }, outer);
+        jobSystem.Wait(outer);
+    });
+    PrintResult("Run+Wait, empty job (spawned by worker, stolen)", nested / JOBS_PER_BATCH, "job");
+
+    // Baseline: what SystemManager used to do for every parallel system, every frame
+    constexpr int ASYNC_TASKS = 64;
+    double async = Measure(ITERATIONS / 10, [&]() {
+        std::vector<std::future<void>> futures;
+        futures.reserve(ASYNC_TASKS);
+        for (int i = 0; i < ASYNC_TASKS; ++i) {
+            futures.push_back(std::async(std::launch::async, [&sink]() { sink.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        for (auto& future : futures) {
+            future.wait();
+        }
+    });
+    PrintResult("std::async(launch::async), empty task (baseline)", async / ASYNC_TASKS, "job");
+}
+
+void BenchmarkParallelFor(Jobs::JobSystem& jobSystem) {
+    ECS::ComponentManager componentManager;
+    for (uint32_t id = 1; id < TRANSFORM_COUNT; ++id) {
+        ECS::TransformComponent transform;
+        transform.position = { static_cast<float>(id), 0.0f, 0.0f };
+        componentManager.AddComponent(componentManager.CreateEntity(), transform);
+    }
+    ECS::ComponentArray<ECS::TransformComponent>& transforms = *componentManager.GetComponentArray<ECS::TransformComponent>();
+
+    const float dt = 1.0f / 60.0f;
+    const std::string count = std::to_string(transforms.GetSize());
+
+    double serial = Measure(ITERATIONS, [&]() {
+        for (auto& transform : transforms.GetComponentArray()) {
+            Integrate(transform, dt);
+        }
+    });
+    PrintResult("Serial loop, " + count + " transforms", serial, "frame");
+
+    for (size_t grainSize : { 32, 128, 512, 2048 }) {
+        double parallel = Measure(ITERATIONS, [&]() {
+            Jobs::ParallelFor(componentManager, transforms, grainSize, [dt](ECS::Entity, ECS::TransformComponent& transform) {
+                Integrate(transform, dt);
+            }, jobSystem);
+        });
+        PrintResult("ParallelFor, grain " + std::to_string(grainSize), parallel, "frame");
+    }
+}
+
+} // namespace
+
+void RunJobSystemBenchmarks() {
+    Jobs::JobSystem& jobSystem = Jobs::JobSystem::Get();
+
+    PrintHeader("JobSystem (" + std::to_string(jobSystem.GetWorkerCount()) + " workers + main thread)");
+    BenchmarkJobOverhead(jobSystem);
+
+    PrintHeader("ParallelFor over ComponentArray<TransformComponent>");
+    BenchmarkParallelFor(jobSystem);
+}
+
+} // namespace Benchmark
@@ -0,0 +1,83 @@
+#include "../include/Benchmark.h"
+#include "Utils/Logger.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Benchmark {
+
+namespace {
+
+constexpr int BATCH = 256;   // Fits one thread's ring even at 4 records per message: nothing is dropped
+constexpr int BATCHES = 400;
+
+// Calling-thread cost of 'BATCH' log calls; the writer output is flushed between batches
+template<typename Func>
+double MeasureLogCalls(Func&& log) {
+    double total = 0.0;
+    for (int batch = 0; batch < BATCHES; ++batch) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < BATCH; ++i) {
+            log(i);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration<double, std::nano>(end - start).count();
+
+        Logger::Get().Flush();
+    }
+    return total / (double(BATCH) * BATCHES);
+}
+
+} // namespace
+
+void RunLoggerBenchmarks() {
+    PrintHeader("Logger: calling-thread cost (file output, console off)");
+
+    Logger& logger = Logger::Get();
+    logger.EnableConsoleOutput(false);
+
+    double literal = MeasureLogCalls([](int) { LOG_DEBUG("Benchmark: constant message"); });
+    PrintResult("LOG_DEBUG, string literal", literal, "call");
+
+    const std::string longMessage(400, 'x');
+    double multiRecord = MeasureLogCalls([&](int) { LOG_DEBUG(longMessage); });
+    PrintResult("LOG_DEBUG, 400 chars (4 records)", multiRecord, "call");
+
+    double formatted = MeasureLogCalls([](int i) { LOG_DEBUG("Benchmark: message " + std::to_string(i)); });
+    PrintResult("LOG_DEBUG, built with std::to_string", formatted, "call");
+
+    logger.SetMinLevel(Logger::Level::Info);
+    double filtered = MeasureLogCalls([](int) { LOG_DEBUG("Benchmark: filtered message"); });
+    PrintResult("LOG_DEBUG below the minimum level", filtered, "call");
+    logger.SetMinLevel(Logger::Level::Debug);
+
+    // Four threads logging at once, each into its own ring
+    constexpr int THREADS = 4;
+    std::atomic<double> threadTotal{ 0.0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&threadTotal]() {
+            double total = 0.0;
+            for (int batch = 0; batch < BATCHES; ++batch) {
+                auto start = std::chrono::high_resolution_clock::now();
+                for (int i = 0; i < BATCH; ++i) {
+                    LOG_DEBUG("Benchmark: message from a worker thread");
+                }
+                auto end = std::chrono::high_resolution_clock::now();
+                total += std::chrono::duration<double, std::nano>(end - start).count();
+                Logger::Get().Flush();
+            }
+            threadTotal.fetch_add(total / (double(BATCH) * BATCHES));
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    PrintResult("LOG_DEBUG, 4 threads concurrently", threadTotal.load() / THREADS, "call");
+
+    logger.EnableConsoleOutput(true);
+}
+
+} // namespace Benchmark
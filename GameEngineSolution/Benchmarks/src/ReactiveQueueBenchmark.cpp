@@ -0,0 +1,115 @@
+#include "../include/Benchmark.h"
+#include "ECS/ComponentManager.h"
+#include "ECS/CommandBuffer.h"
+#include "ECS/ReactiveQueue.h"
+#include "Events/ECSEvents.h"
+#include "Events/EventBus.h"
+#include <array>
+#include <unordered_set>
+#include <vector>
+
+namespace Benchmark {
+
+namespace {
+
+constexpr size_t SPAWNS_PER_FRAME = 256;
+constexpr size_t LISTENERS = 3; // Render, physics and transform caches
+constexpr int FRAMES = 200;
+
+// Listener state: the entities it tracks, like a render cache or spatial grid
+using Tracked = std::unordered_set<ECS::Entity>;
+
+// One frame of spawn traffic: destroy last frame's entities, create new ones with
+// three components each (one of them watched), play back, then let 'deliver' bring
+// the listeners up to date.
+template<typename Deliver>
+double MeasureSpawnFrames(ECS::ComponentManager& componentManager, Deliver&& deliver) {
+    ECS::CommandBuffer commands;
+    std::vector<ECS::Entity> live;
+
+    return Measure(FRAMES, [&]() {
+        for (ECS::Entity entity : live) {
+            commands.DestroyEntity(entity);
+        }
+        for (size_t i = 0; i < SPAWNS_PER_FRAME; ++i) {
+            ECS::Entity entity = commands.CreateEntity();
+            commands.AddComponent(entity, ECS::TransformComponent{});
+            commands.AddComponent(entity, ECS::PhysicsComponent{});
+            commands.AddComponent(entity, ECS::ColliderComponent{});
+        }
+        commands.Playback(componentManager);
+        deliver();
+
+        live.clear();
+        auto colliders = componentManager.GetComponentArray<ECS::ColliderComponent>();
+        for (size_t i = 0; i < colliders->GetSize(); ++i) {
+            live.push_back(colliders->GetEntityAtIndex(i));
+        }
+    });
+}
+
+} // namespace
+
+void RunReactiveQueueBenchmarks() {
+    PrintHeader("Component listeners: EventBus callbacks vs. reactive queues (256 spawns/frame)");
+
+    {
+        EventBus eventBus;
+        ECS::ComponentManager componentManager;
+        componentManager.SetEventBus(&eventBus);
+
+        // Every listener sees every ComponentAdded and filters by type
+        std::array<Tracked, LISTENERS> tracked;
+        for (Tracked& set : tracked) {
+            eventBus.Subscribe(EventType::ComponentAdded, [&set](Event& e) {
+                auto& event = static_cast<ComponentAddedEvent&>(e);
+                if (event.componentType == typeid(ECS::ColliderComponent)) {
+                    set.insert(event.entity);
+                }
+            });
+            eventBus.Subscribe(EventType::EntitiesDestroyed, [&set](Event& e) {
+                for (ECS::Entity entity : static_cast<EntitiesDestroyedEvent&>(e).entities) {
+                    set.erase(entity);
+                }
+            });
+        }
+
+        double callbacks = MeasureSpawnFrames(componentManager, []() {});
+        PrintResult("EventBus subscribers (synchronous, filtered)", callbacks, "frame");
+    }
+
+    {
+        EventBus eventBus;
+        ECS::ComponentManager componentManager;
+        componentManager.SetEventBus(&eventBus);
+
+        // Only changes to the watched type are queued; each listener drains once per frame
+        std::array<Tracked, LISTENERS> tracked;
+        std::array<ECS::ReactiveQueue, LISTENERS> queues;
+        for (ECS::ReactiveQueue& queue : queues) {
+            queue.Watch<ECS::ColliderComponent>();
+            componentManager.RegisterReactiveQueue(&queue);
+        }
+
+        double queued = MeasureSpawnFrames(componentManager, [&]() {
+            for (size_t i = 0; i < LISTENERS; ++i) {
+                queues[i].Drain([&set = tracked[i]](std::span<const ECS::ReactiveChange> changes) {
+                    for (const ECS::ReactiveChange& change : changes) {
+                        if (change.kind == ECS::ReactiveChange::Kind::ComponentAdded) {
+                            set.insert(change.entity);
+                        } else {
+                            set.erase(change.entity);
+                        }
+                    }
+                });
+            }
+        });
+        PrintResult("Reactive queues (drained once per frame)", queued, "frame");
+
+        for (ECS::ReactiveQueue& queue : queues) {
+            componentManager.UnregisterReactiveQueue(&queue);
+        }
+    }
+}
+
+} // namespace Benchmark
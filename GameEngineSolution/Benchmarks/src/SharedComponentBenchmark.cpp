@@ -0,0 +1,88 @@
+#include "../include/Benchmark.h"
+#include "ECS/ComponentManager.h"
+#include "Renderer/Material.h"
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Benchmark {
+
+namespace {
+
+constexpr size_t ENTITY_COUNT = 100'000;
+constexpr size_t MESH_COUNT = 16;
+constexpr size_t MATERIAL_COUNT = 8;
+
+// Props drawn from a small asset set in random order, as a level file lists them.
+// Meshes are only compared, never dereferenced, so stand-in addresses suffice.
+struct PropSet {
+    std::array<std::byte, MESH_COUNT> meshStorage{};
+    std::vector<std::shared_ptr<Material>> materials;
+    std::vector<ECS::Entity> entities;
+    std::vector<ECS::RenderComponent> renders;
+
+    PropSet() {
+        for (size_t i = 0; i < MATERIAL_COUNT; ++i) {
+            materials.push_back(std::make_shared<Material>());
+        }
+        std::mt19937 rng(42);
+        for (uint32_t i = 0; i < ENTITY_COUNT; ++i) {
+            entities.push_back(ECS::Entity{ i + 1, 0 }); // Id 0 is the null entity
+            renders.push_back({ reinterpret_cast<Mesh*>(&meshStorage[rng() % MESH_COUNT]), materials[rng() % MATERIAL_COUNT] });
+        }
+    }
+};
+
+} // namespace
+
+void RunSharedComponentBenchmarks() {
+    PrintHeader("Shared RenderComponent vs. per-entity copies (100k props, 128 values)");
+
+    PropSet props;
+
+    // Adding: every copy is an atomic refcount increment, a shared value is stored once
+    ECS::ComponentArray<ECS::RenderComponent> copies;
+    double copyInsert = Measure(20, [&]() {
+        copies.Clear();
+        copies.InsertDataBulk(props.entities, props.renders);
+    });
+    PrintResult("ComponentArray<RenderComponent>::InsertDataBulk", copyInsert, "100k");
+
+    ECS::SharedComponentArray<ECS::RenderComponent> shared;
+    double sharedInsert = Measure(20, [&]() {
+        shared.Clear();
+        shared.InsertDataBulk(props.entities, props.renders);
+    });
+    PrintResult("SharedComponentArray<RenderComponent>::InsertDataBulk", sharedInsert, "100k");
+
+    // Grouping for draw batches: sorting instance pointers (the old RenderFrame path)
+    // versus walking the value buckets
+    std::vector<const ECS::RenderComponent*> sorted;
+    double sortTime = Measure(20, [&]() {
+        sorted.clear();
+        for (const auto& render : copies.GetComponentArray()) {
+            sorted.push_back(&render);
+        }
+        std::sort(sorted.begin(), sorted.end(), [](const ECS::RenderComponent* lhs, const ECS::RenderComponent* rhs) {
+            if (lhs->material != rhs->material) {
+                return lhs->material < rhs->material;
+            }
+            return lhs->mesh < rhs->mesh;
+        });
+    });
+    PrintResult("Sort instances by material/mesh", sortTime, "frame");
+
+    size_t batches = 0;
+    double bucketTime = Measure(20, [&]() {
+        batches = 0;
+        shared.ForEachValue([&](uint32_t, const ECS::RenderComponent&, std::span<const ECS::Entity> entities) {
+            batches += entities.empty() ? 0 : 1;
+        });
+    });
+    PrintResult("SharedComponentArray::ForEachValue (" + std::to_string(batches) + " batches)", bucketTime, "frame");
+}
+
+} // namespace Benchmark
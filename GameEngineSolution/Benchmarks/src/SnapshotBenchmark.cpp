@@ -0,0 +1,80 @@
+#include "../include/Benchmark.h"
+#include "ECS/ComponentManager.h"
+#include "ResourceManagement/SceneLoader.h"
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <string>
+
+namespace Benchmark {
+
+namespace {
+
+constexpr size_t SCENE_ENTITY_COUNT = 10'000;
+
+// Scene without resources: transform + collider on every entity, physics and
+// rotation on some, so several component arrays of different sizes are involved
+std::string BuildSceneJson() {
+    std::string json = "{ \"entities\": [\n";
+    for (size_t i = 0; i < SCENE_ENTITY_COUNT; ++i) {
+        float x = static_cast<float>(i % 100);
+        float z = static_cast<float>(i / 100);
+        json += std::format(
+            "{{ \"components\": {{ \"transform\": {{ \"position\": [{}, 0.5, {}], \"rotation\": [0, {}, 0], \"scale\": [1, 1, 1] }}, "
+            "\"collider\": {{ \"center\": [0, 0, 0], \"extents\": [0.5, 0.5, 0.5] }}",
+            x, z, static_cast<float>(i) * 0.01f);
+        if (i % 2 == 0) {
+            json += ", \"physics\": { \"mass\": 2.0, \"drag\": 0.1, \"useGravity\": true }";
+        }
+        if (i % 4 == 0) {
+            json += ", \"rotate\": { \"axis\": [0, 1, 0], \"speed\": 1.5 }";
+        }
+        json += std::format(" }} }}{}\n", i + 1 < SCENE_ENTITY_COUNT ? "," : "");
+    }
+    json += "] }\n";
+    return json;
+}
+
+} // namespace
+
+void RunSnapshotBenchmarks() {
+    PrintHeader("World snapshots vs. JSON scene loading (10k entities)");
+
+    std::filesystem::path scenePath = std::filesystem::temp_directory_path() / "benchmark_snapshot_scene.json";
+    {
+        std::ofstream file(scenePath, std::ios::binary);
+        file << BuildSceneJson();
+    }
+
+    double jsonLoad = Measure(5, [&]() {
+        ECS::ComponentManager componentManager;
+        SceneLoader::LoadScene(scenePath.wstring(), componentManager, nullptr);
+    });
+    PrintResult("SceneLoader::LoadScene (parse + create)", jsonLoad, "load");
+
+    ECS::ComponentManager componentManager;
+    SceneLoader::LoadScene(scenePath.wstring(), componentManager, nullptr);
+    std::filesystem::remove(scenePath);
+
+    ECS::WorldSnapshot snapshot;
+    double capture = Measure(20, [&]() {
+        componentManager.Snapshot(snapshot);
+    });
+    PrintResult("ComponentManager::Snapshot (buffer reused)", capture, "capture");
+    std::printf("  %-52s %10zu KB\n", "Snapshot size", snapshot.GetSize() / 1024);
+
+    double restore = Measure(20, [&]() {
+        componentManager.Restore(snapshot);
+    });
+    PrintResult("ComponentManager::Restore (over live world)", restore, "restore");
+
+    double restoreFresh = Measure(20, [&]() {
+        ECS::ComponentManager restored;
+        restored.Restore(snapshot);
+    });
+    PrintResult("ComponentManager::Restore (into empty manager)", restoreFresh, "restore");
+
+    std::printf("  %-52s %10.1fx\n", "Restore speedup over JSON load", jsonLoad / restoreFresh);
+}
+
+} // namespace Benchmark
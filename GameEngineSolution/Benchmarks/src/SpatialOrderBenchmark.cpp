@@ -0,0 +1,122 @@
+#include "../include/Benchmark.h"
+#include "ECS/ComponentManager.h"
+#include "ECS/SpatialOrder.h"
+#include "ECS/SystemManager.h"
+#include "ECS/Systems/ECSPhysicsSystem.h"
+#include "Events/EventBus.h"
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <unordered_set>
+#include <vector>
+
+namespace Benchmark {
+
+namespace {
+
+constexpr int FLOOR_SIDE = 320;          // 1x1 floor tiles: ~100k static colliders
+constexpr size_t BODY_COUNT = 2'000;     // Dynamic bodies resting on the floor
+constexpr float TICK = 1.0f / 60.0f;
+constexpr size_t PAGE_SIZE = 4096;
+
+// Floor tiles and bodies created in random order, as a streamed or edited level
+// would be: neighbours in space end up anywhere in the arrays
+void PopulateScene(ECS::ComponentManager& componentManager) {
+    std::mt19937 rng(42);
+
+    std::vector<ECS::TransformComponent> tiles;
+    tiles.reserve(static_cast<size_t>(FLOOR_SIDE) * FLOOR_SIDE);
+    for (int x = 0; x < FLOOR_SIDE; ++x) {
+        for (int z = 0; z < FLOOR_SIDE; ++z) {
+            tiles.push_back({ { static_cast<float>(x), 0.0f, static_cast<float>(z) } });
+        }
+    }
+    std::shuffle(tiles.begin(), tiles.end(), rng);
+
+    ECS::ColliderComponent tileCollider;
+    tileCollider.localAABB.extents = { 0.5f, 0.5f, 0.5f };
+    std::vector<ECS::Entity> floor = componentManager.CreateEntities(tiles.size());
+    componentManager.AddComponents<ECS::TransformComponent>(floor, tiles);
+    componentManager.AddComponents<ECS::ColliderComponent>(floor, std::vector<ECS::ColliderComponent>(floor.size(), tileCollider));
+
+    std::uniform_real_distribution<float> position(1.0f, static_cast<float>(FLOOR_SIDE - 2));
+    std::vector<ECS::TransformComponent> bodies(BODY_COUNT);
+    for (auto& body : bodies) {
+        body.position = { position(rng), 0.9f, position(rng) };
+    }
+
+    ECS::ColliderComponent bodyCollider;
+    bodyCollider.localAABB.extents = { 0.4f, 0.4f, 0.4f };
+    ECS::PhysicsComponent physics;
+    physics.checkCollisions = true;
+    std::vector<ECS::Entity> dynamic = componentManager.CreateEntities(BODY_COUNT);
+    componentManager.AddComponents<ECS::TransformComponent>(dynamic, bodies);
+    componentManager.AddComponents<ECS::ColliderComponent>(dynamic, std::vector<ECS::ColliderComponent>(BODY_COUNT, bodyCollider));
+    componentManager.AddComponents<ECS::PhysicsComponent>(dynamic, std::vector<ECS::PhysicsComponent>(BODY_COUNT, physics));
+}
+
+// Locality proxy for CheckGroundCollision: distinct 4 KB pages of the transform and
+// collider arrays touched by one body's neighbour lookups
+double PagesPerQuery(const ECS::ComponentManager& componentManager, const ECS::PhysicsSystem& physicsSystem) {
+    auto transforms = componentManager.GetComponentArray<ECS::TransformComponent>();
+    auto colliders = componentManager.GetComponentArray<ECS::ColliderComponent>();
+    auto physics = componentManager.GetComponentArray<ECS::PhysicsComponent>();
+
+    size_t pages = 0;
+    std::unordered_set<size_t> touched;
+    for (size_t i = 0; i < physics->GetSize(); ++i) {
+        const ECS::Entity body = physics->GetEntityAtIndex(i);
+        const ECS::TransformComponent& transform = std::as_const(*transforms).GetData(body);
+
+        AABB query;
+        query.center = transform.position;
+        query.extents = { 0.4f, 0.4f, 0.4f };
+
+        touched.clear();
+        for (ECS::Entity other : physicsSystem.GetSpatialGrid().Query(query)) {
+            touched.insert(transforms->GetIndex(other) * sizeof(ECS::TransformComponent) / PAGE_SIZE);
+            touched.insert((size_t(1) << 40) + colliders->GetIndex(other) * sizeof(ECS::ColliderComponent) / PAGE_SIZE);
+        }
+        pages += touched.size();
+    }
+    return static_cast<double>(pages) / static_cast<double>(physics->GetSize());
+}
+
+} // namespace
+
+void RunSpatialOrderBenchmarks() {
+    PrintHeader("PhysicsSystem collisions: insertion order vs. Morton order (100k tiles, 2k bodies)");
+
+    for (bool sorted : { false, true }) {
+        EventBus eventBus;
+        ECS::ComponentManager componentManager;
+        componentManager.SetEventBus(&eventBus);
+        ECS::SystemManager systemManager;
+        ECS::PhysicsSystem* physicsSystem = systemManager.AddSystem<ECS::PhysicsSystem>(componentManager);
+        PopulateScene(componentManager);
+
+        ECS::SpatialOrder order(componentManager);
+        order.Track<ECS::TransformComponent>();
+        order.Track<ECS::ColliderComponent>();
+        if (sorted) {
+            order.SortAll();
+        }
+
+        // Let the bodies land before measuring
+        for (int i = 0; i < 10; ++i) {
+            systemManager.UpdateSimulation(TICK);
+        }
+
+        double tick = Measure(20, [&]() { systemManager.UpdateSimulation(TICK); });
+        PrintResult(sorted ? "Morton order (SpatialOrder::SortAll)" : "Insertion order", tick, "tick");
+        std::printf("  %-52s %.1f pages/query\n", "", PagesPerQuery(componentManager, *physicsSystem));
+
+        if (sorted) {
+            // Steady-state maintenance cost once sorted
+            double step = Measure(200, [&]() { order.Step(); });
+            PrintResult("SpatialOrder::Step (4096 entries, already sorted)", step, "frame");
+        }
+    }
+}
+
+} // namespace Benchmark
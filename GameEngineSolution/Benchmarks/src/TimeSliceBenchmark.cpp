@@ -0,0 +1,83 @@
+#include "../include/Benchmark.h"
+#include "ECS/ComponentManager.h"
+#include "ECS/TimeSlicer.h"
+#include "ECS/View.h"
+#include <string>
+#include <vector>
+
+namespace Benchmark {
+
+namespace {
+
+constexpr float FRAME_TIME = 1.0f / 60.0f;
+
+void Regenerate(ECS::HealthComponent& health, float elapsed) {
+    if (health.isDead || health.currentHealth >= health.maxHealth) return;
+    health.currentHealth += health.regenerationRate * elapsed;
+    if (health.currentHealth > health.maxHealth) {
+        health.currentHealth = health.maxHealth;
+    }
+}
+
+void Populate(ECS::ComponentManager& componentManager, size_t count) {
+    std::vector<ECS::Entity> entities = componentManager.CreateEntities(count);
+    ECS::HealthComponent wounded;
+    wounded.maxHealth = 1.0e9f; // Never full: every visit does the work
+    wounded.currentHealth = 1.0f;
+    wounded.regenerationRate = 1.0f;
+    componentManager.AddComponents<ECS::HealthComponent>(entities, std::vector<ECS::HealthComponent>(count, wounded));
+}
+
+void PrintSlice(const std::string& name, double nanoseconds, const ECS::TimeSliceStats& stats) {
+    PrintResult(name, nanoseconds, "frame");
+    std::printf("  %-52s %zu/frame, sweep %u frames, max latency %.0f ms\n", "",
+        stats.processedCount, stats.sweepFrames, stats.maxLatency * 1000.0f);
+}
+
+} // namespace
+
+void RunTimeSliceBenchmarks() {
+    PrintHeader("Health regeneration: every entity vs. time-sliced (per frame)");
+
+    for (size_t count : { size_t(10'000), size_t(100'000), size_t(1'000'000) }) {
+        const std::string suffix = " (" + std::to_string(count / 1000) + "k)";
+
+        {
+            ECS::ComponentManager componentManager;
+            Populate(componentManager, count);
+            double full = Measure(60, [&]() {
+                ECS::View<ECS::HealthComponent> view(componentManager);
+                view.Each([](ECS::Entity, ECS::HealthComponent& health) { Regenerate(health, FRAME_TIME); });
+            });
+            PrintResult("View, every entity" + suffix, full, "frame");
+        }
+
+        {
+            ECS::ComponentManager componentManager;
+            Populate(componentManager, count);
+            auto healthArray = componentManager.GetComponentArray<ECS::HealthComponent>();
+            ECS::TimeSlicer slicer;
+            slicer.SetBudget(ECS::SystemBudget::Entities(4096));
+            double sliced = Measure(600, [&]() {
+                slicer.Each(componentManager, *healthArray, FRAME_TIME,
+                    [](ECS::Entity, ECS::HealthComponent& health, float elapsed) { Regenerate(health, elapsed); });
+            });
+            PrintSlice("TimeSlicer, 4096 entities" + suffix, sliced, slicer.GetStats());
+        }
+
+        {
+            ECS::ComponentManager componentManager;
+            Populate(componentManager, count);
+            auto healthArray = componentManager.GetComponentArray<ECS::HealthComponent>();
+            ECS::TimeSlicer slicer;
+            slicer.SetBudget(ECS::SystemBudget::Microseconds(50.0f));
+            double sliced = Measure(600, [&]() {
+                slicer.Each(componentManager, *healthArray, FRAME_TIME,
+                    [](ECS::Entity, ECS::HealthComponent& health, float elapsed) { Regenerate(health, elapsed); });
+            });
+            PrintSlice("TimeSlicer, 50 us" + suffix, sliced, slicer.GetStats());
+        }
+    }
+}
+
+} // namespace Benchmark
@@ -0,0 +1,30 @@
+#include "../include/Benchmark.h"
+#include <exception>
+#include <iostream>
+
+// ==================================================================================
+// Benchmarks
+// ----------------------------------------------------------------------------------
+// Console runner for engine microbenchmarks. Build in Release for meaningful numbers.
+// ==================================================================================
+int main() {
+    try {
+        Benchmark::RunJobSystemBenchmarks();
+        Benchmark::RunEntityScalingBenchmarks();
+        Benchmark::RunSnapshotBenchmarks();
+        Benchmark::RunGroupBenchmarks();
+        Benchmark::RunArchetypeBenchmarks();
+        Benchmark::RunSharedComponentBenchmarks();
+        Benchmark::RunEntityPoolBenchmarks();
+        Benchmark::RunReactiveQueueBenchmarks();
+        Benchmark::RunTimeSliceBenchmarks();
+        Benchmark::RunSpatialOrderBenchmarks();
+        Benchmark::RunEventBusBenchmarks();
+        Benchmark::RunLoggerBenchmarks();
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,226 @@
+#pragma once
+
+#include "Entity.h"
+#include "Signature.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+
+// ========================================
+// ComponentTypeInfo
+// Type-erased size/alignment and lifetime
+// helpers used by chunked storage
+// ========================================
+struct ComponentTypeInfo {
+    size_t size = 0;
+    size_t alignment = 0;
+    void (*moveConstruct)(void* dst, void* src) = nullptr; // Move src into uninitialized dst, then destroy src
+    void (*destroy)(void* ptr) = nullptr;
+
+    template<typename T>
+    static ComponentTypeInfo Create() {
+        ComponentTypeInfo info;
+        info.size = sizeof(T);
+        info.alignment = alignof(T);
+        info.moveConstruct = [](void* dst, void* src) {
+            T* source = static_cast<T*>(src);
+            new (dst) T(std::move(*source));
+            source->~T();
+        };
+        info.destroy = [](void* ptr) {
+            static_cast<T*>(ptr)->~T();
+        };
+        return info;
+    }
+
+    bool IsValid() const { return size != 0; }
+};
+
+// ==================================================================================
+// Archetype
+// ----------------------------------------------------------------------------------
+// Stores every entity that has exactly the same Signature.
+// Entities are packed into fixed-size chunks (CHUNK_SIZE bytes). Inside a chunk the
+// data is laid out as structure-of-arrays: one Entity column followed by one tightly
+// packed column per component type, so iterating N components over a chunk walks
+// N+1 contiguous arrays.
+//
+// Rows are addressed by a global index: chunk = index / capacity, row = index % capacity.
+// Removal swaps the last row into the hole, keeping every chunk but the last full.
+// ==================================================================================
+class Archetype {
+public:
+    static constexpr size_t CHUNK_SIZE = 16 * 1024;
+    static constexpr uint32_t INVALID_OFFSET = 0xFFFFFFFF;
+
+    Archetype(const Signature& signature, const std::vector<ComponentTypeInfo>& typeInfos);
+    ~Archetype();
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    const Signature& GetSignature() const { return m_signature; }
+    bool HasComponent(uint32_t typeID) const { return m_signature.test(typeID); }
+
+    // Reserve a row for the entity. Component columns of the row are left uninitialized.
+    uint32_t Allocate(Entity entity);
+
+    // Fill the hole at 'index' with the last row. The components at 'index' must already
+    // be destroyed or moved out. Returns the entity that was moved (NULL_ENTITY if none).
+    Entity RemoveRow(uint32_t index);
+
+    // Destroy every component stored in the row (does not remove the row)
+    void DestroyRow(uint32_t index);
+
+    void* GetComponent(uint32_t index, uint32_t typeID) const {
+        return GetColumn(index / m_capacity, typeID) + static_cast<size_t>(index % m_capacity) * m_typeSizes[typeID];
+    }
+
+    Entity GetEntity(uint32_t index) const {
+        return GetEntities(index / m_capacity)[index % m_capacity];
+    }
+
+    // Chunk iteration
+    size_t GetEntityCount() const { return m_count; }
+    size_t GetCapacityPerChunk() const { return m_capacity; }
+    size_t GetChunkCount() const { return (m_count + m_capacity - 1) / m_capacity; }
+
+    size_t GetChunkEntityCount(size_t chunkIndex) const {
+        size_t begin = chunkIndex * m_capacity;
+        return (m_count - begin < m_capacity) ? (m_count - begin) : m_capacity;
+    }
+
+    Entity* GetEntities(size_t chunkIndex) const {
+        return reinterpret_cast<Entity*>(m_chunks[chunkIndex]->bytes);
+    }
+
+    std::byte* GetColumn(size_t chunkIndex, uint32_t typeID) const {
+        return m_chunks[chunkIndex]->bytes + m_columnOffsets[typeID];
+    }
+
+    const std::vector<uint32_t>& GetTypeIDs() const { return m_typeIDs; }
+
+private:
+    struct alignas(64) ChunkData {
+        std::byte bytes[CHUNK_SIZE];
+    };
+
+    Signature m_signature;
+    std::vector<uint32_t> m_typeIDs;                          // Component types stored in this archetype
+    std::array<uint32_t, MAX_COMPONENTS> m_columnOffsets;     // Byte offset of each column inside a chunk
+    std::array<uint32_t, MAX_COMPONENTS> m_typeSizes{};       // sizeof() per component type
+    std::vector<void (*)(void*, void*)> m_moveFns;            // Parallel to m_typeIDs
+    std::vector<void (*)(void*)> m_destroyFns;                // Parallel to m_typeIDs
+    uint32_t m_capacity = 0;                                  // Entities per chunk
+    size_t m_count = 0;
+    std::vector<std::unique_ptr<ChunkData>> m_chunks;
+};
+
+// ==================================================================================
+// ArchetypeStorage
+// ----------------------------------------------------------------------------------
+// Alternative to the per-type ComponentArray sparse sets. Owns one Archetype per
+// distinct Signature and tracks where each entity lives. Adding or removing a
+// component moves the entity's row into the archetype of its new signature.
+// Thread-safe with read/write locks (structural changes take the write lock).
+// ==================================================================================
+class ArchetypeStorage {
+public:
+    ArchetypeStorage() = default;
+
+    ArchetypeStorage(const ArchetypeStorage&) = delete;
+    ArchetypeStorage& operator=(const ArchetypeStorage&) = delete;
+
+    void RegisterType(uint32_t typeID, const ComponentTypeInfo& info);
+
+    template<typename T>
+    void Insert(Entity entity, uint32_t typeID, T component) {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+        EntityLocation& location = GetLocation(entity);
+        if (location.archetype && location.archetype->HasComponent(typeID)) {
+            // Component already exists, just update it
+            *static_cast<T*>(location.archetype->GetComponent(location.index, typeID)) = std::move(component);
+            return;
+        }
+
+        Signature signature = location.archetype ? location.archetype->GetSignature() : Signature();
+        signature.set(typeID);
+
+        MoveEntity(entity, GetOrCreateArchetype(signature));
+        new (location.archetype->GetComponent(location.index, typeID)) T(std::move(component));
+    }
+
+    void Remove(Entity entity, uint32_t typeID);
+    void DestroyEntity(Entity entity);
+
+    void* Get(Entity entity, uint32_t typeID) const {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+        if (entity.id >= m_locations.size()) return nullptr;
+        const EntityLocation& location = m_locations[entity.id];
+        if (!location.archetype || !location.archetype->HasComponent(typeID)) return nullptr;
+        return location.archetype->GetComponent(location.index, typeID);
+    }
+
+    bool Has(Entity entity, uint32_t typeID) const {
+        return Get(entity, typeID) != nullptr;
+    }
+
+    // Invoke fn(Archetype&) for every archetype whose signature contains 'required'
+    template<typename Func>
+    void ForEachArchetype(const Signature& required, Func&& fn) const {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+        for (const auto& archetype : m_archetypeList) {
+            if ((archetype->GetSignature() & required) == required && archetype->GetEntityCount() > 0) {
+                fn(*archetype);
+            }
+        }
+    }
+
+    size_t GetArchetypeCount() const {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_archetypeList.size();
+    }
+
+private:
+    struct EntityLocation {
+        Archetype* archetype = nullptr;
+        uint32_t index = 0;
+    };
+
+    EntityLocation& GetLocation(Entity entity) {
+        if (entity.id >= m_locations.size()) {
+            m_locations.resize(static_cast<size_t>(entity.id) + 1);
+        }
+        return m_locations[entity.id];
+    }
+
+    Archetype& GetOrCreateArchetype(const Signature& signature);
+
+    // Move the entity's row into 'target', carrying over shared components and
+    // destroying the ones 'target' does not store. Updates the entity's location.
+    void MoveEntity(Entity entity, Archetype& target);
+
+    // Remove the row at 'location' and patch the location of the entity swapped into it
+    void RemoveRow(const EntityLocation& location);
+
+    std::vector<ComponentTypeInfo> m_typeInfos;                               // Indexed by component type ID
+    std::unordered_map<Signature, Archetype*> m_archetypes;                   // Signature -> archetype
+    std::vector<std::unique_ptr<Archetype>> m_archetypeList;                  // Owning, in creation order
+    std::vector<EntityLocation> m_locations;                                  // Indexed by entity ID
+    mutable std::shared_mutex m_mutex;
+};
+
+} // namespace ECS
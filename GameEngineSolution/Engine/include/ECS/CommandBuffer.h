@@ -0,0 +1,284 @@
+#pragma once
+
+#include "ComponentManager.h"
+#include "../Jobs/JobSystem.h"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+
+// ==================================================================================
+// CommandBuffer
+// ----------------------------------------------------------------------------------
+// Records structural changes (create/destroy entities, add/remove components) and
+// enabled-state changes so they can be applied later, outside of any iteration. A buffer is written by a
+// single thread, so recording takes no locks; Playback() applies the commands in
+// record order and clears the buffer.
+//
+// CreateEntity() returns a deferred placeholder that is only meaningful to commands
+// in the same buffer; it is resolved to the real entity during playback.
+//
+// Example Usage:
+//     Entity projectile = commands.CreateEntity();
+//     commands.AddComponent(projectile, TransformComponent{ spawnPos });
+//     commands.DestroyEntity(expired);
+//     ...
+//     commands.Playback(componentManager);
+// ==================================================================================
+class CommandBuffer {
+public:
+    CommandBuffer() = default;
+    ~CommandBuffer() { Clear(); }
+
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    // Placeholder handles carry this version; real entities never reach it in practice
+    static constexpr uint32_t DEFERRED_VERSION = 0xFFFFFFFFu;
+
+    static bool IsDeferred(Entity entity) {
+        return entity.version == DEFERRED_VERSION;
+    }
+
+    // Record entity creation; returns a placeholder usable by later commands
+    Entity CreateEntity() {
+        uint32_t index = m_createdCount++;
+        Entity placeholder{ index + 1, DEFERRED_VERSION }; // id 0 is the null entity
+        m_commands.push_back({ &ApplyCreate, nullptr, placeholder, nullptr });
+        return placeholder;
+    }
+
+    template<typename T>
+    void AddComponent(Entity entity, T component) {
+        void* payload = Allocate(sizeof(T), alignof(T));
+        new (payload) T(std::move(component));
+        m_commands.push_back({ &ApplyAdd<T>, &DestroyPayload<T>, entity, payload });
+    }
+
+    // Overwrite an existing component (marks it changed, fires no event); skipped if
+    // the entity no longer has T. Use it to re-initialize pooled entities.
+    template<typename T>
+    void SetComponent(Entity entity, T component) {
+        static_assert(!IsSharedComponent<T>::value, "Shared components are immutable; use AddComponent");
+        void* payload = Allocate(sizeof(T), alignof(T));
+        new (payload) T(std::move(component));
+        m_commands.push_back({ &ApplySet<T>, &DestroyPayload<T>, entity, payload });
+    }
+
+    template<typename T>
+    void RemoveComponent(Entity entity) {
+        m_commands.push_back({ &ApplyRemove<T>, nullptr, entity, nullptr });
+    }
+
+    void DestroyEntity(Entity entity) {
+        m_commands.push_back({ &ApplyDestroy, nullptr, entity, nullptr });
+    }
+
+    // Not structural, but it changes what views see (see ComponentManager::SetEntityEnabled)
+    void SetEntityEnabled(Entity entity, bool enabled) {
+        m_commands.push_back({ enabled ? &ApplyEnable : &ApplyDisable, nullptr, entity, nullptr });
+    }
+
+    // Record fn(ComponentManager&), run in record order with the other commands.
+    // Placeholder entities captured by fn are not resolved.
+    template<typename Func>
+    void Call(Func fn) {
+        using Callback = std::decay_t<Func>;
+        void* payload = Allocate(sizeof(Callback), alignof(Callback));
+        new (payload) Callback(std::move(fn));
+        m_commands.push_back({ &ApplyCall<Callback>, &DestroyPayload<Callback>, NULL_ENTITY, payload });
+    }
+
+    // Apply all commands in record order, then clear.
+    // Runs of consecutive DestroyEntity commands are applied with one
+    // ComponentManager::DestroyEntities call (a single EntitiesDestroyedEvent).
+    // Commands recorded while playing back (e.g. from event handlers) run in the same pass.
+    void Playback(ComponentManager& componentManager) {
+        m_createdEntities.assign(m_createdCount, NULL_ENTITY);
+
+        for (size_t i = 0; i < m_commands.size(); ++i) {
+            if (m_commands[i].apply == &ApplyDestroy) {
+                m_destroyedEntities.clear();
+                for (; i < m_commands.size() && m_commands[i].apply == &ApplyDestroy; ++i) {
+                    m_destroyedEntities.push_back(Resolve(m_commands[i].entity));
+                }
+                componentManager.DestroyEntities(m_destroyedEntities);
+                --i;
+                continue;
+            }
+            Command command = m_commands[i];
+            command.apply(*this, componentManager, command);
+        }
+        Clear();
+    }
+
+    void Clear() {
+        for (auto& command : m_commands) {
+            if (command.destroy) {
+                command.destroy(command.payload);
+            }
+        }
+        m_commands.clear();
+        m_createdEntities.clear();
+        m_createdCount = 0;
+
+        // Keep the first block for reuse, release the rest
+        if (m_blocks.size() > 1) {
+            m_blocks.resize(1);
+        }
+        m_blockOffset = 0;
+    }
+
+    bool IsEmpty() const { return m_commands.empty(); }
+    size_t GetCommandCount() const { return m_commands.size(); }
+
+private:
+    struct Command;
+    using ApplyFn = void (*)(CommandBuffer&, ComponentManager&, Command&);
+    using DestroyFn = void (*)(void*);
+
+    struct Command {
+        ApplyFn apply;
+        DestroyFn destroy;  // Destroys the payload (nullptr if none)
+        Entity entity;
+        void* payload;
+    };
+
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+    };
+
+    static constexpr size_t BLOCK_SIZE = 16 * 1024;
+
+    // Placeholder -> real entity (NULL_ENTITY if its creation hasn't been played back)
+    Entity Resolve(Entity entity) const {
+        if (!IsDeferred(entity)) {
+            return entity;
+        }
+        size_t index = entity.id - 1;
+        return index < m_createdEntities.size() ? m_createdEntities[index] : NULL_ENTITY;
+    }
+
+    static void ApplyCreate(CommandBuffer& buffer, ComponentManager& componentManager, Command& command) {
+        size_t index = command.entity.id - 1;
+        if (index >= buffer.m_createdEntities.size()) {
+            buffer.m_createdEntities.resize(index + 1, NULL_ENTITY);
+        }
+        buffer.m_createdEntities[index] = componentManager.CreateEntity();
+    }
+
+    template<typename T>
+    static void ApplyAdd(CommandBuffer& buffer, ComponentManager& componentManager, Command& command) {
+        Entity entity = buffer.Resolve(command.entity);
+        // The entity may have been destroyed by an earlier command
+        if (componentManager.IsEntityValid(entity)) {
+            componentManager.AddComponent(entity, std::move(*static_cast<T*>(command.payload)));
+        }
+    }
+
+    template<typename T>
+    static void ApplySet(CommandBuffer& buffer, ComponentManager& componentManager, Command& command) {
+        Entity entity = buffer.Resolve(command.entity);
+        if (!componentManager.IsEntityValid(entity)) return;
+        if (T* component = componentManager.GetComponentPtr<T>(entity)) {
+            *component = std::move(*static_cast<T*>(command.payload));
+        }
+    }
+
+    template<typename T>
+    static void ApplyRemove(CommandBuffer& buffer, ComponentManager& componentManager, Command& command) {
+        componentManager.RemoveComponent<T>(buffer.Resolve(command.entity));
+    }
+
+    static void ApplyDestroy(CommandBuffer& buffer, ComponentManager& componentManager, Command& command) {
+        componentManager.DestroyEntity(buffer.Resolve(command.entity));
+    }
+
+    static void ApplyEnable(CommandBuffer& buffer, ComponentManager& componentManager, Command& command) {
+        componentManager.SetEntityEnabled(buffer.Resolve(command.entity), true);
+    }
+
+    static void ApplyDisable(CommandBuffer& buffer, ComponentManager& componentManager, Command& command) {
+        componentManager.SetEntityEnabled(buffer.Resolve(command.entity), false);
+    }
+
+    template<typename Callback>
+    static void ApplyCall(CommandBuffer&, ComponentManager& componentManager, Command& command) {
+        (*static_cast<Callback*>(command.payload))(componentManager);
+    }
+
+    template<typename T>
+    static void DestroyPayload(void* payload) {
+        static_cast<T*>(payload)->~T();
+    }
+
+    // Bump allocation from stable blocks (payloads are never moved once written)
+    void* Allocate(size_t size, size_t alignment) {
+        if (!m_blocks.empty()) {
+            Block& block = m_blocks.back();
+            size_t offset = (m_blockOffset + alignment - 1) & ~(alignment - 1);
+            if (offset + size <= block.size) {
+                m_blockOffset = offset + size;
+                return block.data.get() + offset;
+            }
+        }
+
+        // 'new' aligns to __STDCPP_DEFAULT_NEW_ALIGNMENT__, enough for component types
+        size_t blockSize = (std::max)(BLOCK_SIZE, size);
+        m_blocks.push_back({ std::make_unique<std::byte[]>(blockSize), blockSize });
+        m_blockOffset = size;
+        return m_blocks.back().data.get();
+    }
+
+    std::vector<Command> m_commands;
+    std::vector<Entity> m_createdEntities;
+    std::vector<Entity> m_destroyedEntities; // Scratch for coalesced destroys
+    uint32_t m_createdCount = 0;
+    std::vector<Block> m_blocks;
+    size_t m_blockOffset = 0;
+};
+
+// ==================================================================================
+// CommandBuffers
+// ----------------------------------------------------------------------------------
+// One CommandBuffer per JobSystem thread slot, so systems running concurrently can
+// record without synchronization. SystemManager plays them back at phase boundaries,
+// in slot order.
+// ==================================================================================
+class CommandBuffers {
+public:
+    explicit CommandBuffers(Jobs::JobSystem& jobSystem)
+        : m_jobSystem(&jobSystem)
+    {
+        m_buffers.resize(jobSystem.GetThreadSlotCount());
+        for (auto& buffer : m_buffers) {
+            buffer = std::make_unique<CommandBuffer>();
+        }
+    }
+
+    // Buffer owned by the calling thread
+    CommandBuffer& Local() {
+        return *m_buffers[m_jobSystem->GetCurrentThreadIndex()];
+    }
+
+    // Apply every buffer (call only when no system is running)
+    void Playback(ComponentManager& componentManager) {
+        for (auto& buffer : m_buffers) {
+            if (!buffer->IsEmpty()) {
+                buffer->Playback(componentManager);
+            }
+        }
+    }
+
+private:
+    Jobs::JobSystem* m_jobSystem;
+    std::vector<std::unique_ptr<CommandBuffer>> m_buffers;
+};
+
+} // namespace ECS
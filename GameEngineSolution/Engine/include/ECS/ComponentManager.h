@@ -1,7 +1,11 @@
 #pragma once
 
 #include "Entity.h"
+#include "Signature.h"
+#include "ArchetypeStorage.h"
 #include "Components.h"
+#include "WorldSnapshot.h"
+#include "ReactiveQueue.h"
 #include <unordered_map>
 #include <vector>
 #include <optional>
@@ -10,21 +14,22 @@
 #include <stdexcept>
 #include <cassert>
 #include <bitset>
+#include <mutex>
 #include <shared_mutex>
 #include <algorithm>
 #include <limits>
+#include <span>
+#include <atomic>
+#include <array>
+#include <string>
+#include <type_traits>
+#include <initializer_list>
 
 // Forward declare EventBus
 class EventBus;
 
 namespace ECS {
 
-// ========================================
-// Component Signature
-// ========================================
-constexpr size_t MAX_COMPONENTS = 64;
-using Signature = std::bitset<MAX_COMPONENTS>;
-
 // ========================================
 // IComponentArray
 // Interface for generic component arrays
@@ -33,108 +38,206 @@ class IComponentArray {
 public:
     virtual ~IComponentArray() = default;
     virtual void EntityDestroyed(Entity entity) = 0;
+    virtual void EntitiesDestroyed(std::span<const Entity> entities) = 0; // One lock, one compaction pass
     virtual size_t GetSize() const = 0;
     virtual Entity GetEntityAtIndex(size_t index) const = 0;
+    virtual void MarkChanged(Entity entity) = 0; // No-op if the entity has no component
+    
+    // Type-erased dense-order access used by owning groups (structural change rules apply)
+    virtual uint32_t FindIndex(Entity entity) const = 0;
+    virtual void SwapEntries(size_t first, size_t second) = 0;
+    
+    // Type-erased access used by snapshots (no structural changes may run concurrently)
+    virtual std::type_index GetComponentType() const = 0;
+    virtual size_t GetComponentSize() const = 0;
+    virtual std::span<const Entity> GetEntities() const = 0;
+    virtual void Clear() = 0;
+    virtual void Serialize(SnapshotWriter& writer, const IComponentSerializer* serializer) const = 0;
+    virtual void Deserialize(SnapshotReader& reader, const IComponentSerializer* serializer) = 0;
 };
 
-// ========================================
+// ==================================================================================
 // ComponentArray<T>
+// ----------------------------------------------------------------------------------
 // Generic sparse set storage for components
 // Thread-safe with read/write locks
-// ========================================
+//
+// The entity -> index map is paged: 4 KB pages (SPARSE_PAGE_SIZE ids) are allocated
+// the first time an entity in their id range gets this component, so a type used
+// by a handful of entities costs a few pages no matter how many entities exist.
+//
+// Change tracking:
+// Every slot records the change tick at which its component was added and last
+// accessed mutably. Mutable accessors (non-const GetData/TryGetData, MarkChanged,
+// mutable View/ParallelFor iteration) stamp the slot; const accessors never do.
+// Raw GetComponentArray() access bypasses tracking - call MarkChanged() after writing.
+// Ticks come from the owning ComponentManager (see AdvanceChangeTick()).
+// ==================================================================================
 template<typename T>
 class ComponentArray : public IComponentArray {
 public:
-    ComponentArray() {
-        // Initialize sparse array with invalid index
-        m_entityToIndex.resize(MAX_ENTITIES, INVALID_INDEX);
-        
-        // Pre-allocate for typical scene size
-        m_componentArray.reserve(1024);
-        m_indexToEntity.reserve(1024);
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+    explicit ComponentArray(const std::atomic<uint32_t>* changeTick = nullptr)
+        : m_changeTick(changeTick)
+    {
+        // Nothing is allocated up front: sparse pages and dense storage grow on demand
     }
 
     void InsertData(Entity entity, T component) {
         std::unique_lock<std::shared_mutex> lock(m_mutex);
         
-        uint32_t id = entity.id;
-        if (id >= MAX_ENTITIES) {
-            throw std::runtime_error("Entity ID out of range.");
-        }
+        uint32_t& slot = AcquireSparseSlot(entity.id);
 
-        if (m_entityToIndex[id] != INVALID_INDEX) {
+        uint32_t tick = CurrentTick();
+        if (slot != INVALID_INDEX) {
             // Component already exists, just update it
-            m_componentArray[m_entityToIndex[id]] = component;
+            m_componentArray[slot] = component;
+            StoreTick(m_changedTicks[slot], tick);
             return;
         }
 
         // Add new component
         size_t newIndex = m_size;
-        m_entityToIndex[id] = static_cast<uint32_t>(newIndex);
+        slot = static_cast<uint32_t>(newIndex);
         m_indexToEntity.push_back(entity);
         m_componentArray.push_back(component);
+        m_addedTicks.push_back(tick);
+        m_changedTicks.push_back(tick);
         m_size++;
     }
 
+    // Insert many components under a single lock (existing components are overwritten)
+    void InsertDataBulk(std::span<const Entity> entities, std::span<const T> components) {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        
+        m_componentArray.reserve(m_size + entities.size());
+        m_indexToEntity.reserve(m_size + entities.size());
+        m_addedTicks.reserve(m_size + entities.size());
+        m_changedTicks.reserve(m_size + entities.size());
+        
+        uint32_t tick = CurrentTick();
+        for (size_t i = 0; i < entities.size(); ++i) {
+            uint32_t& slot = AcquireSparseSlot(entities[i].id);
+            
+            if (slot != INVALID_INDEX) {
+                m_componentArray[slot] = components[i];
+                StoreTick(m_changedTicks[slot], tick);
+                continue;
+            }
+            
+            slot = static_cast<uint32_t>(m_size);
+            m_indexToEntity.push_back(entities[i]);
+            m_componentArray.push_back(components[i]);
+            m_addedTicks.push_back(tick);
+            m_changedTicks.push_back(tick);
+            m_size++;
+        }
+    }
+
     void RemoveData(Entity entity) {
         std::unique_lock<std::shared_mutex> lock(m_mutex);
         
-        uint32_t id = entity.id;
-        if (id >= MAX_ENTITIES || m_entityToIndex[id] == INVALID_INDEX) {
+        uint32_t index = GetIndex(entity);
+        if (index == INVALID_INDEX) {
             return; // Entity doesn't have this component
         }
+        RemoveAtIndex(index);
+    }
 
-        // Copy last element into deleted element's place to maintain density
-        size_t indexOfRemovedEntity = m_entityToIndex[id];
-        size_t indexOfLastElement = m_size - 1;
+    // Remove many components under a single lock (entities without one are skipped).
+    // Large batches are compacted in one pass starting at the first hole, so the
+    // survivors keep their relative order; a few removals far from the end (single
+    // destroys) are swap-removed like RemoveData instead of shifting the whole tail.
+    void RemoveDataBulk(std::span<const Entity> entities) {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
         
-        m_componentArray[indexOfRemovedEntity] = m_componentArray[indexOfLastElement];
-
-        // Update map to point to moved spot
-        Entity entityOfLastElement = m_indexToEntity[indexOfLastElement];
-        m_entityToIndex[entityOfLastElement.id] = static_cast<uint32_t>(indexOfRemovedEntity);
-        m_indexToEntity[indexOfRemovedEntity] = entityOfLastElement;
-
-        m_entityToIndex[id] = INVALID_INDEX;
-        m_indexToEntity.pop_back();
-        m_componentArray.pop_back();
-
-        m_size--;
+        size_t removed = 0;
+        size_t firstHole = m_size;
+        for (Entity entity : entities) {
+            uint32_t index = GetIndex(entity);
+            if (index == INVALID_INDEX) continue;
+            ++removed;
+            firstHole = (std::min)(firstHole, static_cast<size_t>(index));
+        }
+        if (removed == 0) return;
+        
+        if (removed * SWAP_REMOVE_RATIO < m_size - firstHole) {
+            for (Entity entity : entities) {
+                uint32_t index = GetIndex(entity);
+                if (index != INVALID_INDEX) {
+                    RemoveAtIndex(index);
+                }
+            }
+            return;
+        }
+        
+        for (Entity entity : entities) {
+            uint32_t index = GetIndex(entity);
+            if (index == INVALID_INDEX) continue;
+            
+            SparseSlot(entity.id) = INVALID_INDEX;
+            m_indexToEntity[index] = NULL_ENTITY; // Tombstone
+        }
+        
+        size_t write = firstHole;
+        for (size_t read = firstHole; read < m_size; ++read) {
+            if (!m_indexToEntity[read].IsValid()) continue;
+            
+            if (write != read) {
+                m_componentArray[write] = std::move(m_componentArray[read]);
+                m_addedTicks[write] = m_addedTicks[read];
+                m_changedTicks[write] = m_changedTicks[read];
+                m_indexToEntity[write] = m_indexToEntity[read];
+                SparseSlot(m_indexToEntity[write].id) = static_cast<uint32_t>(write);
+            }
+            ++write;
+        }
+        
+        m_componentArray.erase(m_componentArray.begin() + write, m_componentArray.end());
+        m_addedTicks.resize(write);
+        m_changedTicks.resize(write);
+        m_indexToEntity.resize(write);
+        m_size = write;
     }
 
+    // Mutable access: marks the component as changed
     T& GetData(Entity entity) {
         std::shared_lock<std::shared_mutex> lock(m_mutex);
         
-        uint32_t id = entity.id;
-        if (id >= MAX_ENTITIES || m_entityToIndex[id] == INVALID_INDEX) {
+        uint32_t index = GetIndex(entity);
+        if (index == INVALID_INDEX) {
             throw std::runtime_error("Retrieving non-existent component.");
         }
-        return m_componentArray[m_entityToIndex[id]];
+        StoreTick(m_changedTicks[index], CurrentTick());
+        return m_componentArray[index];
     }
     
     const T& GetData(Entity entity) const {
         std::shared_lock<std::shared_mutex> lock(m_mutex);
         
-        uint32_t id = entity.id;
-        if (id >= MAX_ENTITIES || m_entityToIndex[id] == INVALID_INDEX) {
+        uint32_t index = GetIndex(entity);
+        if (index == INVALID_INDEX) {
             throw std::runtime_error("Retrieving non-existent component.");
         }
-        return m_componentArray[m_entityToIndex[id]];
+        return m_componentArray[index];
     }
 
     bool HasData(Entity entity) const {
         std::shared_lock<std::shared_mutex> lock(m_mutex);
         
-        uint32_t id = entity.id;
-        return id < MAX_ENTITIES && m_entityToIndex[id] != INVALID_INDEX;
+        return GetIndex(entity) != INVALID_INDEX;
     }
 
     void EntityDestroyed(Entity entity) override {
-        uint32_t id = entity.id;
-        if (id < MAX_ENTITIES && m_entityToIndex[id] != INVALID_INDEX) {
+        if (GetIndex(entity) != INVALID_INDEX) {
             RemoveData(entity);
         }
     }
+    
+    void EntitiesDestroyed(std::span<const Entity> entities) override {
+        RemoveDataBulk(entities);
+    }
 
     // Direct access for systems (read-only, thread-safe)
     std::vector<T> GetComponentArrayCopy() const {
@@ -165,19 +268,754 @@ public:
         return m_size;
     }
     
+    // Unlocked accessors for View iteration
+    // Caller guarantees no concurrent structural changes (insert/remove) on this array
+    const std::vector<Entity>& GetEntityArray() const {
+        return m_indexToEntity;
+    }
+    
+    // Mutable access: marks the component as changed
+    T* TryGetData(Entity entity) {
+        uint32_t index = GetIndex(entity);
+        if (index == INVALID_INDEX) {
+            return nullptr;
+        }
+        StoreTick(m_changedTicks[index], CurrentTick());
+        return &m_componentArray[index];
+    }
+    
+    const T* TryGetData(Entity entity) const {
+        uint32_t index = GetIndex(entity);
+        return index != INVALID_INDEX ? &m_componentArray[index] : nullptr;
+    }
+    
+    // Dense index of the entity's component (INVALID_INDEX if it has none)
+    uint32_t GetIndex(Entity entity) const {
+        uint32_t page = entity.id / SPARSE_PAGE_SIZE;
+        if (page >= m_sparsePages.size() || !m_sparsePages[page]) {
+            return INVALID_INDEX;
+        }
+        return m_sparsePages[page][entity.id % SPARSE_PAGE_SIZE];
+    }
+    
+    uint32_t FindIndex(Entity entity) const override {
+        return GetIndex(entity);
+    }
+    
+    // Exchange two dense slots (component, ticks and entity) and fix their sparse entries
+    void SwapEntries(size_t first, size_t second) override {
+        if (first == second) return;
+        
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        std::swap(m_componentArray[first], m_componentArray[second]);
+        std::swap(m_addedTicks[first], m_addedTicks[second]);
+        std::swap(m_changedTicks[first], m_changedTicks[second]);
+        std::swap(m_indexToEntity[first], m_indexToEntity[second]);
+        SparseSlot(m_indexToEntity[first].id) = static_cast<uint32_t>(first);
+        SparseSlot(m_indexToEntity[second].id) = static_cast<uint32_t>(second);
+    }
+    
+    // Sparse pages currently allocated (memory diagnostics)
+    size_t GetSparsePageCount() const {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return static_cast<size_t>(std::count_if(m_sparsePages.begin(), m_sparsePages.end(),
+            [](const auto& page) { return page != nullptr; }));
+    }
+    
+    // ========================================
+    // Change Tracking (unlocked, like the accessors above)
+    // ========================================
+    void MarkChanged(Entity entity) override {
+        uint32_t index = GetIndex(entity);
+        if (index != INVALID_INDEX) {
+            MarkChangedAtIndex(index);
+        }
+    }
+    
+    void MarkChangedAtIndex(size_t index) {
+        StoreTick(m_changedTicks[index], CurrentTick());
+    }
+    
+    uint32_t GetChangedTick(size_t index) const {
+        return LoadTick(m_changedTicks[index]);
+    }
+    
+    uint32_t GetAddedTick(size_t index) const {
+        return m_addedTicks[index];
+    }
+    
     // Lock acquisition for batch operations
     std::shared_mutex& GetMutex() {
         return m_mutex;
     }
+    
+    // ========================================
+    // Snapshot support
+    // ----------------------------------------
+    // Dense entities and components are written as two raw arrays (components go
+    // through 'serializer' when T is not trivially copyable). Deserialize replaces the
+    // contents; every restored component counts as added at the current tick.
+    // ========================================
+    std::type_index GetComponentType() const override { return typeid(T); }
+    size_t GetComponentSize() const override { return sizeof(T); }
+    std::span<const Entity> GetEntities() const override { return m_indexToEntity; }
+    
+    void Clear() override {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        ClearUnlocked();
+    }
+    
+    void Serialize(SnapshotWriter& writer, const IComponentSerializer* serializer) const override {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        
+        writer.WriteArray(std::span<const Entity>(m_indexToEntity));
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            writer.WriteArray(std::span<const T>(m_componentArray));
+        } else {
+            const auto& typed = RequireSerializer(serializer);
+            for (const T& component : m_componentArray) {
+                typed.Save(component, writer);
+            }
+            writer.BeginSection();
+        }
+    }
+    
+    void Deserialize(SnapshotReader& reader, const IComponentSerializer* serializer) override {
+        // Read everything before touching the array so a bad snapshot leaves it intact
+        std::vector<Entity> entities;
+        std::vector<T> components;
+        reader.ReadArray(entities);
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            reader.ReadArray(components);
+            if (components.size() != entities.size()) {
+                throw std::runtime_error("Snapshot: component and entity counts differ");
+            }
+        } else {
+            const auto& typed = RequireSerializer(serializer);
+            components.resize(entities.size());
+            for (T& component : components) {
+                typed.Load(reader, component);
+            }
+        }
+        
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        ClearUnlocked();
+        m_indexToEntity = std::move(entities);
+        m_componentArray = std::move(components);
+        
+        m_size = m_indexToEntity.size();
+        uint32_t tick = CurrentTick();
+        m_addedTicks.assign(m_size, tick);
+        m_changedTicks.assign(m_size, tick);
+        for (size_t i = 0; i < m_size; ++i) {
+            AcquireSparseSlot(m_indexToEntity[i].id) = static_cast<uint32_t>(i);
+        }
+    }
 
 private:
-    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+    static constexpr uint32_t SPARSE_PAGE_SIZE = 1024; // 4 KB of uint32_t indices
+    
+    // RemoveDataBulk swap-removes when fewer than 1/SWAP_REMOVE_RATIO of the
+    // entries from the first hole on go
+    static constexpr size_t SWAP_REMOVE_RATIO = 4;
+    
+    // Move the last element into dense slot 'index' (caller holds the write lock)
+    void RemoveAtIndex(uint32_t index) {
+        size_t indexOfLastElement = m_size - 1;
+        SparseSlot(m_indexToEntity[index].id) = INVALID_INDEX;
+        
+        if (index != indexOfLastElement) {
+            m_componentArray[index] = std::move(m_componentArray[indexOfLastElement]);
+            m_addedTicks[index] = m_addedTicks[indexOfLastElement];
+            m_changedTicks[index] = m_changedTicks[indexOfLastElement];
+
+            // Update map to point to moved spot
+            Entity entityOfLastElement = m_indexToEntity[indexOfLastElement];
+            SparseSlot(entityOfLastElement.id) = index;
+            m_indexToEntity[index] = entityOfLastElement;
+        }
+
+        m_indexToEntity.pop_back();
+        m_componentArray.pop_back();
+        m_addedTicks.pop_back();
+        m_changedTicks.pop_back();
+
+        m_size--;
+    }
+    
+    // Slot of an id whose page already exists
+    uint32_t& SparseSlot(uint32_t id) {
+        return m_sparsePages[id / SPARSE_PAGE_SIZE][id % SPARSE_PAGE_SIZE];
+    }
+    
+    // Slot of 'id', allocating its page if needed (caller holds the write lock)
+    uint32_t& AcquireSparseSlot(uint32_t id) {
+        if (id >= MAX_ENTITIES) {
+            throw std::runtime_error("Entity ID out of range.");
+        }
+        
+        uint32_t page = id / SPARSE_PAGE_SIZE;
+        if (page >= m_sparsePages.size()) {
+            m_sparsePages.resize(static_cast<size_t>(page) + 1);
+        }
+        if (!m_sparsePages[page]) {
+            m_sparsePages[page] = std::make_unique<uint32_t[]>(SPARSE_PAGE_SIZE);
+            std::fill_n(m_sparsePages[page].get(), SPARSE_PAGE_SIZE, INVALID_INDEX);
+        }
+        return SparseSlot(id);
+    }
+    
+    uint32_t CurrentTick() const {
+        return m_changeTick ? m_changeTick->load(std::memory_order_relaxed) : 0;
+    }
+    
+    // Reset the used sparse slots (pages are kept) and drop all dense data
+    void ClearUnlocked() {
+        for (Entity entity : m_indexToEntity) {
+            SparseSlot(entity.id) = INVALID_INDEX;
+        }
+        m_indexToEntity.clear();
+        m_componentArray.clear();
+        m_addedTicks.clear();
+        m_changedTicks.clear();
+        m_size = 0;
+    }
+    
+    static const ComponentSerializer<T>& RequireSerializer(const IComponentSerializer* serializer) {
+        if (!serializer) {
+            throw std::runtime_error(std::string("Snapshot: no serializer registered for non-trivially copyable component ") + typeid(T).name());
+        }
+        return static_cast<const ComponentSerializer<T>&>(*serializer);
+    }
+    
+    // Slots may be stamped by several threads holding only a shared lock
+    static void StoreTick(uint32_t& slot, uint32_t tick) {
+        std::atomic_ref<uint32_t>(slot).store(tick, std::memory_order_relaxed);
+    }
+    
+    static uint32_t LoadTick(const uint32_t& slot) {
+        // atomic_ref<const T> is not available before C++26; the load does not write
+        return std::atomic_ref<uint32_t>(const_cast<uint32_t&>(slot)).load(std::memory_order_relaxed);
+    }
     
     std::vector<T> m_componentArray;
-    std::vector<uint32_t> m_entityToIndex;  // Sparse array: Entity ID -> Index
+    std::vector<std::unique_ptr<uint32_t[]>> m_sparsePages; // Paged sparse array: Entity ID -> Index
     std::vector<Entity> m_indexToEntity;    // Dense array: Index -> Entity
+    std::vector<uint32_t> m_addedTicks;     // Dense: tick at which each component was added
+    std::vector<uint32_t> m_changedTicks;   // Dense: tick of the last mutable access
     size_t m_size = 0;
     mutable std::shared_mutex m_mutex;      // Read/write lock for thread safety
+    const std::atomic<uint32_t>* m_changeTick; // Owner's change tick (nullptr: always 0)
+};
+
+// ==================================================================================
+// SharedComponentArray<T>
+// ----------------------------------------------------------------------------------
+// Storage for shared component types (IsSharedComponent<T>, see Components.h): each
+// distinct value is stored once and entities hold the index of their value, so
+// adding a component copies nothing once its value exists. Entities are bucketed by
+// value - every entity using a value is one contiguous list (the render path turns
+// each bucket into a draw batch).
+//
+// Values are immutable: AddComponent with a different value moves the entity to
+// that value's bucket. A value is released when its last entity leaves; its index
+// is reused by the next new value.
+//
+// The dense entity order (GetEntities) is independent of the buckets and carries
+// the change ticks: an entity counts as changed when it gets the component or moves
+// to a different value (writing an equal value changes nothing).
+// Thread-safe with read/write locks like ComponentArray; the unlocked accessors
+// require that no structural change runs concurrently.
+// ==================================================================================
+template<typename T>
+class SharedComponentArray : public IComponentArray {
+public:
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+    explicit SharedComponentArray(const std::atomic<uint32_t>* changeTick = nullptr)
+        : m_changeTick(changeTick)
+    {
+    }
+
+    void InsertData(Entity entity, const T& value) {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        
+        uint32_t& slot = AcquireSparseSlot(entity.id);
+        InsertUnlocked(entity, slot, AcquireValue(value), CurrentTick());
+    }
+
+    // Insert many components under a single lock (existing components are overwritten)
+    void InsertDataBulk(std::span<const Entity> entities, std::span<const T> values) {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        
+        m_indexToEntity.reserve(m_indexToEntity.size() + entities.size());
+        m_valueOfIndex.reserve(m_valueOfIndex.size() + entities.size());
+        m_bucketPositions.reserve(m_bucketPositions.size() + entities.size());
+        m_addedTicks.reserve(m_addedTicks.size() + entities.size());
+        m_changedTicks.reserve(m_changedTicks.size() + entities.size());
+        
+        uint32_t tick = CurrentTick();
+        uint32_t valueIndex = INVALID_INDEX;
+        for (size_t i = 0; i < entities.size(); ++i) {
+            uint32_t& slot = AcquireSparseSlot(entities[i].id);
+            // Runs of equal values (level props, spawn waves) are looked up once
+            if (valueIndex == INVALID_INDEX || !(values[i] == *m_values[valueIndex].value)) {
+                valueIndex = AcquireValue(values[i]);
+            }
+            InsertUnlocked(entities[i], slot, valueIndex, tick);
+        }
+    }
+
+    void RemoveData(Entity entity) {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        
+        uint32_t index = GetIndex(entity);
+        if (index == INVALID_INDEX) {
+            return; // Entity doesn't have this component
+        }
+        
+        RemoveAtIndex(index);
+    }
+
+    // Remove many components under a single lock: one compaction pass, or swap-removes
+    // for a few entries far from the end (see ComponentArray)
+    void RemoveDataBulk(std::span<const Entity> entities) {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        
+        const size_t size = m_indexToEntity.size();
+        size_t removed = 0;
+        size_t firstHole = size;
+        for (Entity entity : entities) {
+            uint32_t index = GetIndex(entity);
+            if (index == INVALID_INDEX) continue;
+            ++removed;
+            firstHole = (std::min)(firstHole, static_cast<size_t>(index));
+        }
+        if (removed == 0) return;
+        
+        if (removed * SWAP_REMOVE_RATIO < size - firstHole) {
+            for (Entity entity : entities) {
+                uint32_t index = GetIndex(entity);
+                if (index != INVALID_INDEX) {
+                    RemoveAtIndex(index);
+                }
+            }
+            return;
+        }
+        
+        for (Entity entity : entities) {
+            uint32_t index = GetIndex(entity);
+            if (index == INVALID_INDEX) continue;
+            
+            LeaveBucket(index); // Before the tombstone: bucket fix-ups go through the sparse set
+            SparseSlot(entity.id) = INVALID_INDEX;
+            m_indexToEntity[index] = NULL_ENTITY;
+        }
+        
+        size_t write = firstHole;
+        for (size_t read = firstHole; read < size; ++read) {
+            if (!m_indexToEntity[read].IsValid()) continue;
+            
+            if (write != read) {
+                m_indexToEntity[write] = m_indexToEntity[read];
+                m_valueOfIndex[write] = m_valueOfIndex[read];
+                m_bucketPositions[write] = m_bucketPositions[read];
+                m_addedTicks[write] = m_addedTicks[read];
+                m_changedTicks[write] = m_changedTicks[read];
+                SparseSlot(m_indexToEntity[write].id) = static_cast<uint32_t>(write);
+            }
+            ++write;
+        }
+        
+        m_indexToEntity.resize(write);
+        m_valueOfIndex.resize(write);
+        m_bucketPositions.resize(write);
+        m_addedTicks.resize(write);
+        m_changedTicks.resize(write);
+    }
+
+    const T& GetData(Entity entity) const {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        
+        uint32_t index = GetIndex(entity);
+        if (index == INVALID_INDEX) {
+            throw std::runtime_error("Retrieving non-existent component.");
+        }
+        return *m_values[m_valueOfIndex[index]].value;
+    }
+
+    bool HasData(Entity entity) const {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        
+        return GetIndex(entity) != INVALID_INDEX;
+    }
+
+    void EntityDestroyed(Entity entity) override {
+        if (GetIndex(entity) != INVALID_INDEX) {
+            RemoveData(entity);
+        }
+    }
+    
+    void EntitiesDestroyed(std::span<const Entity> entities) override {
+        RemoveDataBulk(entities);
+    }
+
+    Entity GetEntityAtIndex(size_t index) const override {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        if (index >= m_indexToEntity.size()) {
+            throw std::runtime_error("Index out of range");
+        }
+        return m_indexToEntity[index];
+    }
+
+    size_t GetSize() const override {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_indexToEntity.size();
+    }
+    
+    // Unlocked accessors (caller guarantees no concurrent structural changes)
+    const std::vector<Entity>& GetEntityArray() const {
+        return m_indexToEntity;
+    }
+    
+    const T* TryGetData(Entity entity) const {
+        uint32_t index = GetIndex(entity);
+        return index != INVALID_INDEX ? m_values[m_valueOfIndex[index]].value : nullptr;
+    }
+    
+    // Dense index of the entity's component (INVALID_INDEX if it has none)
+    uint32_t GetIndex(Entity entity) const {
+        uint32_t page = entity.id / SPARSE_PAGE_SIZE;
+        if (page >= m_sparsePages.size() || !m_sparsePages[page]) {
+            return INVALID_INDEX;
+        }
+        return m_sparsePages[page][entity.id % SPARSE_PAGE_SIZE];
+    }
+    
+    uint32_t FindIndex(Entity entity) const override {
+        return GetIndex(entity);
+    }
+    
+    void SwapEntries(size_t, size_t) override {
+        throw std::runtime_error("Shared components cannot be owned by a group");
+    }
+    
+    // ========================================
+    // Values and buckets (unlocked)
+    // ----------------------------------------
+    // Value indices are stable while the value is in use; slots in
+    // [0, GetValueSlotCount()) without entities are free.
+    // ========================================
+    size_t GetValueCount() const { return m_lookup.size(); }
+    size_t GetValueSlotCount() const { return m_values.size(); }
+    
+    // Index of the entity's value (INVALID_INDEX if it has none)
+    uint32_t GetValueIndex(Entity entity) const {
+        uint32_t index = GetIndex(entity);
+        return index != INVALID_INDEX ? m_valueOfIndex[index] : INVALID_INDEX;
+    }
+    
+    // Value of a slot in use
+    const T& GetValue(uint32_t valueIndex) const {
+        assert(m_values[valueIndex].value);
+        return *m_values[valueIndex].value;
+    }
+    
+    // Entities referencing a value (empty for free slots)
+    std::span<const Entity> GetValueEntities(uint32_t valueIndex) const {
+        return m_values[valueIndex].entities;
+    }
+    
+    // Invoke fn(uint32_t valueIndex, const T& value, std::span<const Entity> entities) per value in use
+    template<typename Func>
+    void ForEachValue(Func&& fn) const {
+        for (uint32_t i = 0; i < m_values.size(); ++i) {
+            if (m_values[i].value) {
+                fn(i, *m_values[i].value, std::span<const Entity>(m_values[i].entities));
+            }
+        }
+    }
+    
+    // ========================================
+    // Change Tracking (unlocked, dense index)
+    // ========================================
+    uint32_t GetChangedTick(size_t index) const {
+        return m_changedTicks[index];
+    }
+    
+    uint32_t GetAddedTick(size_t index) const {
+        return m_addedTicks[index];
+    }
+    
+    // The value is unchanged; readers of the changed tick see the entity again
+    void MarkChanged(Entity entity) override {
+        uint32_t index = GetIndex(entity);
+        if (index != INVALID_INDEX) {
+            m_changedTicks[index] = CurrentTick();
+        }
+    }
+    
+    // ========================================
+    // Snapshot support
+    // ----------------------------------------
+    // Every value slot (free slots as T{}), then the dense entities and the value
+    // index of each. Values go through 'serializer' when T is not trivially copyable.
+    // Deserialize keeps the value indices; every restored component counts as added
+    // at the current tick.
+    // ========================================
+    std::type_index GetComponentType() const override { return typeid(T); }
+    size_t GetComponentSize() const override { return sizeof(T); }
+    std::span<const Entity> GetEntities() const override { return m_indexToEntity; }
+    
+    void Clear() override {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        ClearUnlocked();
+    }
+    
+    void Serialize(SnapshotWriter& writer, const IComponentSerializer* serializer) const override {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        
+        static const T freeSlot{};
+        writer.Write(static_cast<uint32_t>(m_values.size()));
+        for (const ValueSlot& slot : m_values) {
+            const T& value = slot.value ? *slot.value : freeSlot;
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                writer.Write(value);
+            } else {
+                RequireSerializer(serializer).Save(value, writer);
+            }
+        }
+        writer.BeginSection();
+        writer.WriteArray(std::span<const Entity>(m_indexToEntity));
+        writer.WriteArray(std::span<const uint32_t>(m_valueOfIndex));
+    }
+    
+    void Deserialize(SnapshotReader& reader, const IComponentSerializer* serializer) override {
+        // Read everything before touching the array so a bad snapshot leaves it intact
+        std::vector<T> values(reader.Read<uint32_t>());
+        for (T& value : values) {
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                value = reader.Read<T>();
+            } else {
+                RequireSerializer(serializer).Load(reader, value);
+            }
+        }
+        std::vector<Entity> entities;
+        std::vector<uint32_t> valueIndices;
+        reader.ReadArray(entities);
+        reader.ReadArray(valueIndices);
+        if (valueIndices.size() != entities.size()) {
+            throw std::runtime_error("Snapshot: shared value and entity counts differ");
+        }
+        
+        std::vector<bool> used(values.size());
+        for (uint32_t valueIndex : valueIndices) {
+            if (valueIndex >= values.size()) {
+                throw std::runtime_error("Snapshot: invalid shared value index");
+            }
+            used[valueIndex] = true;
+        }
+        
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        ClearUnlocked();
+        
+        m_values.resize(values.size());
+        for (uint32_t i = static_cast<uint32_t>(values.size()); i-- > 0;) {
+            if (!used[i]) {
+                m_freeValues.push_back(i); // Lowest index is reused first
+                continue;
+            }
+            auto [it, inserted] = m_lookup.emplace(std::move(values[i]), i);
+            if (!inserted) {
+                ClearUnlocked();
+                throw std::runtime_error("Snapshot: duplicate shared value");
+            }
+            m_values[i].value = &it->first;
+        }
+        
+        uint32_t tick = CurrentTick();
+        for (size_t i = 0; i < entities.size(); ++i) {
+            uint32_t& slot = AcquireSparseSlot(entities[i].id);
+            InsertUnlocked(entities[i], slot, valueIndices[i], tick);
+        }
+    }
+
+private:
+    static constexpr uint32_t SPARSE_PAGE_SIZE = 1024; // 4 KB of uint32_t indices
+    static constexpr size_t SWAP_REMOVE_RATIO = 4;     // See ComponentArray::RemoveDataBulk
+    
+    // Move the last dense entry into slot 'index' (caller holds the write lock)
+    void RemoveAtIndex(uint32_t index) {
+        LeaveBucket(index);
+        
+        Entity entity = m_indexToEntity[index];
+        size_t last = m_indexToEntity.size() - 1;
+        Entity lastEntity = m_indexToEntity[last];
+        m_indexToEntity[index] = lastEntity;
+        m_valueOfIndex[index] = m_valueOfIndex[last];
+        m_bucketPositions[index] = m_bucketPositions[last];
+        m_addedTicks[index] = m_addedTicks[last];
+        m_changedTicks[index] = m_changedTicks[last];
+        SparseSlot(lastEntity.id) = index;
+        
+        SparseSlot(entity.id) = INVALID_INDEX;
+        m_indexToEntity.pop_back();
+        m_valueOfIndex.pop_back();
+        m_bucketPositions.pop_back();
+        m_addedTicks.pop_back();
+        m_changedTicks.pop_back();
+    }
+    
+    using ValueLookup = std::unordered_map<T, uint32_t, SharedComponentHash<T>>;
+    
+    struct ValueSlot {
+        const T* value = nullptr;      // Key in m_lookup (node-based: stable); nullptr when free
+        std::vector<Entity> entities;  // Bucket: entities referencing the value
+    };
+    
+    // Index of 'value', storing it if it is new (caller holds the write lock)
+    uint32_t AcquireValue(const T& value) {
+        auto it = m_lookup.find(value);
+        if (it != m_lookup.end()) {
+            return it->second;
+        }
+        
+        uint32_t valueIndex;
+        if (!m_freeValues.empty()) {
+            valueIndex = m_freeValues.back();
+            m_freeValues.pop_back();
+        } else {
+            valueIndex = static_cast<uint32_t>(m_values.size());
+            m_values.emplace_back();
+        }
+        it = m_lookup.emplace(value, valueIndex).first;
+        m_values[valueIndex].value = &it->first;
+        return valueIndex;
+    }
+    
+    void ReleaseValue(uint32_t valueIndex) {
+        ValueSlot& slot = m_values[valueIndex];
+        m_lookup.erase(m_lookup.find(*slot.value));
+        slot.value = nullptr;
+        m_freeValues.push_back(valueIndex);
+    }
+    
+    // Give 'entity' (sparse slot 'slot') the value 'valueIndex'
+    void InsertUnlocked(Entity entity, uint32_t& slot, uint32_t valueIndex, uint32_t tick) {
+        if (slot != INVALID_INDEX) {
+            if (m_valueOfIndex[slot] == valueIndex) {
+                return; // Same value: nothing changes
+            }
+            LeaveBucket(slot);
+            JoinBucket(slot, valueIndex);
+            m_changedTicks[slot] = tick;
+            return;
+        }
+        
+        slot = static_cast<uint32_t>(m_indexToEntity.size());
+        m_indexToEntity.push_back(entity);
+        m_valueOfIndex.push_back(INVALID_INDEX);
+        m_bucketPositions.push_back(0);
+        m_addedTicks.push_back(tick);
+        m_changedTicks.push_back(tick);
+        JoinBucket(slot, valueIndex);
+    }
+    
+    void JoinBucket(uint32_t index, uint32_t valueIndex) {
+        std::vector<Entity>& bucket = m_values[valueIndex].entities;
+        m_valueOfIndex[index] = valueIndex;
+        m_bucketPositions[index] = static_cast<uint32_t>(bucket.size());
+        bucket.push_back(m_indexToEntity[index]);
+    }
+    
+    // Remove the entity at dense 'index' from its bucket, releasing the value if it was the last
+    void LeaveBucket(uint32_t index) {
+        uint32_t valueIndex = m_valueOfIndex[index];
+        std::vector<Entity>& bucket = m_values[valueIndex].entities;
+        uint32_t position = m_bucketPositions[index];
+        
+        Entity moved = bucket.back();
+        bucket[position] = moved;
+        m_bucketPositions[SparseSlot(moved.id)] = position;
+        bucket.pop_back();
+        
+        if (bucket.empty()) {
+            ReleaseValue(valueIndex);
+        }
+    }
+    
+    uint32_t& SparseSlot(uint32_t id) {
+        return m_sparsePages[id / SPARSE_PAGE_SIZE][id % SPARSE_PAGE_SIZE];
+    }
+    
+    uint32_t& AcquireSparseSlot(uint32_t id) {
+        if (id >= MAX_ENTITIES) {
+            throw std::runtime_error("Entity ID out of range.");
+        }
+        
+        uint32_t page = id / SPARSE_PAGE_SIZE;
+        if (page >= m_sparsePages.size()) {
+            m_sparsePages.resize(static_cast<size_t>(page) + 1);
+        }
+        if (!m_sparsePages[page]) {
+            m_sparsePages[page] = std::make_unique<uint32_t[]>(SPARSE_PAGE_SIZE);
+            std::fill_n(m_sparsePages[page].get(), SPARSE_PAGE_SIZE, INVALID_INDEX);
+        }
+        return SparseSlot(id);
+    }
+    
+    uint32_t CurrentTick() const {
+        return m_changeTick ? m_changeTick->load(std::memory_order_relaxed) : 0;
+    }
+    
+    void ClearUnlocked() {
+        for (Entity entity : m_indexToEntity) {
+            SparseSlot(entity.id) = INVALID_INDEX;
+        }
+        m_indexToEntity.clear();
+        m_valueOfIndex.clear();
+        m_bucketPositions.clear();
+        m_addedTicks.clear();
+        m_changedTicks.clear();
+        m_values.clear();
+        m_freeValues.clear();
+        m_lookup.clear();
+    }
+    
+    static const ComponentSerializer<T>& RequireSerializer(const IComponentSerializer* serializer) {
+        if (!serializer) {
+            throw std::runtime_error(std::string("Snapshot: no serializer registered for non-trivially copyable component ") + typeid(T).name());
+        }
+        return static_cast<const ComponentSerializer<T>&>(*serializer);
+    }
+    
+    ValueLookup m_lookup;                   // Value -> value index (owns the values)
+    std::vector<ValueSlot> m_values;        // Value index -> value and bucket
+    std::vector<uint32_t> m_freeValues;     // Released value indices
+    std::vector<std::unique_ptr<uint32_t[]>> m_sparsePages; // Paged sparse array: Entity ID -> Index
+    std::vector<Entity> m_indexToEntity;    // Dense array: Index -> Entity
+    std::vector<uint32_t> m_valueOfIndex;   // Dense: value index of each entity
+    std::vector<uint32_t> m_bucketPositions; // Dense: position inside its bucket
+    std::vector<uint32_t> m_addedTicks;     // Dense: tick at which each component was added
+    std::vector<uint32_t> m_changedTicks;   // Dense: tick at which the entity last changed value
+    mutable std::shared_mutex m_mutex;      // Read/write lock for thread safety
+    const std::atomic<uint32_t>* m_changeTick; // Owner's change tick (nullptr: always 0)
+};
+
+// ========================================
+// Storage Mode
+// Selected once at ComponentManager construction
+//
+// Archetype mode is storage plus the chunk API only: ForEachChunk, View::Each
+// (without Changed/Added filters) and per-entity component access. The engine
+// systems cannot run on it. PhysicsSystem, RenderSystem, TransformSystem,
+// SpatialOrder and RewindBuffer need GetComponentArray, owning groups, change
+// ticks or snapshots, and those throw in this mode. The game always uses
+// SparseSet. See the Archetype benchmark for the iteration cost of both.
+// ========================================
+enum class StorageMode {
+    SparseSet,  // One ComponentArray<T> per type (default, supports raw array access)
+    Archetype   // Entities with identical signatures packed into SoA chunks
 };
 
 // ==================================================================================
@@ -187,6 +1025,7 @@ private:
 // Responsible for:
 // - Creating and destroying entities (with versioning)
 // - Managing component arrays (Sparse Sets) for each component type
+//   or archetype chunks (see StorageMode)
 // - Tracking component signatures for efficient querying
 // - Providing fast access to components for Systems
 // - Thread-safe component operations
@@ -194,43 +1033,128 @@ private:
 // ==================================================================================
 class ComponentManager {
 public:
-    ComponentManager() = default;
+    explicit ComponentManager(StorageMode storageMode = StorageMode::SparseSet)
+        : m_storageMode(storageMode) {
+        if (m_storageMode == StorageMode::Archetype) {
+            m_archetypeStorage = std::make_unique<ArchetypeStorage>();
+        }
+        RegisterBuiltInSerializers();
+    }
     ~ComponentManager() = default;
+
+    StorageMode GetStorageMode() const { return m_storageMode; }
     
     // Set event bus for component events
     void SetEventBus(EventBus* eventBus) {
         m_eventBus = eventBus;
     }
     
+    // ========================================
+    // Batching
+    // ----------------------------------------
+    // Between BeginBatch() and EndBatch() component added/removed notifications are
+    // collected instead of published; EndBatch() publishes one ComponentsAddedEvent /
+    // ComponentsRemovedEvent per component type with all affected entities.
+    // Batches nest; only the outermost EndBatch() publishes.
+    // ========================================
+    void BeginBatch() { ++m_batchDepth; }
+    void EndBatch();
+    bool IsBatching() const { return m_batchDepth > 0; }
+    
+    // RAII helper for BeginBatch/EndBatch
+    class BatchScope {
+    public:
+        explicit BatchScope(ComponentManager& componentManager) : m_componentManager(componentManager) {
+            m_componentManager.BeginBatch();
+        }
+        ~BatchScope() { m_componentManager.EndBatch(); }
+        
+        BatchScope(const BatchScope&) = delete;
+        BatchScope& operator=(const BatchScope&) = delete;
+        
+    private:
+        ComponentManager& m_componentManager;
+    };
+    
+    // ========================================
+    // Change Ticks
+    // ----------------------------------------
+    // Component writes are stamped with the current tick. A reader that remembers
+    // the value AdvanceChangeTick() returned on its previous run sees exactly the
+    // components stamped after it (Changed<T>/Added<T> view filters, see View.h).
+    // SystemManager advances the tick before every System::Update.
+    // ========================================
+    uint32_t GetChangeTick() const {
+        return m_changeTick.load(std::memory_order_relaxed);
+    }
+    
+    // Start a new tick; returns the previous one (the 'since' value for the next run)
+    uint32_t AdvanceChangeTick() {
+        return m_changeTick.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    // Flag a component as changed after writing it through raw array access
+    template<typename T>
+    void MarkChanged(Entity entity) {
+        static_assert(!IsSharedComponent<T>::value, "Shared components are immutable");
+        if (!m_archetypeStorage) {
+            GetComponentArray<T>()->MarkChanged(entity);
+        }
+    }
+    
+    // ========================================
+    // Snapshots
+    // ----------------------------------------
+    // Snapshot() captures entity IDs, signatures, enabled flags and every component array into one
+    // binary WorldSnapshot; Restore() replaces the whole world with it. SparseSet mode
+    // only; call both outside of system updates (like any structural change).
+    //
+    // Restore() publishes a ComponentsRemovedEvent per type for the old world, then a
+    // ComponentsAddedEvent per type for the restored one, so caches rebuild themselves.
+    // Restored components count as added at the current change tick. If the snapshot
+    // is invalid, Restore() throws and leaves the manager empty.
+    // ========================================
+    WorldSnapshot Snapshot() const {
+        WorldSnapshot snapshot;
+        Snapshot(snapshot);
+        return snapshot;
+    }
+    void Snapshot(WorldSnapshot& snapshot) const; // Reuses the snapshot's buffer
+    void Restore(const WorldSnapshot& snapshot);
+    
+    // Serializer for a component type that is not trivially copyable (trivially
+    // copyable types are stored as raw memory and need none)
+    template<typename T>
+    void RegisterSerializer(typename ComponentSerializer<T>::SaveFn save, typename ComponentSerializer<T>::LoadFn load) {
+        m_serializers[ComponentTypeID<T>()] = std::make_unique<ComponentSerializer<T>>(save, load);
+    }
+    
     // ========================================
     // Component Type Registration
     // ========================================
     
+    // Component type IDs are static (see ComponentTypeID<T>()); registering only
+    // matters in Archetype mode, where the storage needs each type's layout.
+    // Types are registered automatically on first use.
     template<typename T>
     void RegisterComponent() {
-        std::type_index typeIndex(typeid(T));
-        
-        if (m_componentTypeIDs.find(typeIndex) != m_componentTypeIDs.end()) {
-            return; // Already registered
+        uint32_t typeID = ComponentTypeID<T>();
+        if (!m_archetypeStorage || m_registeredTypes[typeID].load(std::memory_order_acquire)) {
+            return;
         }
         
-        if (m_nextComponentTypeID >= MAX_COMPONENTS) {
-            throw std::runtime_error("Maximum component types exceeded");
+        std::unique_lock<std::shared_mutex> lock(m_registryMutex);
+        if (m_registeredTypes[typeID].load(std::memory_order_relaxed)) {
+            return; // Registered by another thread meanwhile
         }
-        
-        m_componentTypeIDs[typeIndex] = m_nextComponentTypeID++;
+        m_archetypeStorage->RegisterType(typeID, ComponentTypeInfo::Create<T>());
+        m_registeredTypes[typeID].store(true, std::memory_order_release);
     }
     
     template<typename T>
     uint32_t GetComponentTypeID() {
-        std::type_index typeIndex(typeid(T));
-        auto it = m_componentTypeIDs.find(typeIndex);
-        if (it == m_componentTypeIDs.end()) {
-            // Auto-register if not registered
-            RegisterComponent<T>();
-            return m_componentTypeIDs[typeIndex];
-        }
-        return it->second;
+        RegisterComponent<T>();
+        return ComponentTypeID<T>();
     }
     
     // ========================================
@@ -238,31 +1162,54 @@ public:
     // ========================================
     Entity CreateEntity() {
         Entity entity = m_idGenerator.Create();
-        if (entity.id >= MAX_ENTITIES) {
-            throw std::runtime_error("Maximum entity count exceeded.");
-        }
         
-        // Initialize signature
-        m_signatures[entity] = Signature();
+        // Initialize signature (the table grows with the highest id in use)
+        if (entity.id >= m_signatures.size()) {
+            m_signatures.resize(m_idGenerator.GetIDCapacity());
+        }
+        m_signatures[entity.id].reset();
         
         return entity;
     }
+    
+    // Create 'count' entities at once
+    std::vector<Entity> CreateEntities(size_t count) {
+        std::vector<Entity> entities;
+        entities.reserve(count);
+        
+        for (size_t i = 0; i < count; ++i) {
+            entities.push_back(CreateEntity());
+        }
+        return entities;
+    }
 
     void DestroyEntity(Entity entity) {
         if (!m_idGenerator.IsValid(entity)) {
             return; // Already destroyed or invalid
         }
         
-        // Remove from signatures
-        m_signatures.erase(entity);
+        // Notify the arrays of the components it has, then clear its signature
+        Signature signature = m_signatures[entity.id];
+        m_signatures[entity.id].reset();
+        ClearDisabled(entity);
         
-        // Notify all component arrays
-        for (auto const& pair : m_componentArrays) {
-            auto& componentArray = pair.second;
-            if (componentArray) {
-                componentArray->EntityDestroyed(entity);
+        if (m_archetypeStorage) {
+            m_archetypeStorage->DestroyEntity(entity);
+        } else {
+            for (const auto& group : m_groups) {
+                RemoveFromGroup(*group, entity);
             }
         }
+        // Per-type arrays: every component in SparseSet mode, shared components in both modes
+        for (uint32_t typeID = 0; typeID < MAX_COMPONENTS; ++typeID) {
+            if (signature.test(typeID)) {
+                if (IComponentArray* componentArray = m_arrayLookup[typeID].load(std::memory_order_acquire)) {
+                    componentArray->EntityDestroyed(entity);
+                }
+            }
+        }
+        
+        QueueEntityChange(ReactiveChange::Kind::EntityDestroyed, entity, signature);
         
         // Fire entity destroyed event
         if (m_eventBus) {
@@ -273,14 +1220,65 @@ public:
         m_idGenerator.Destroy(entity);
     }
     
+    // Destroy many entities at once: each component array is touched once, for the
+    // entities whose signature has its type (one lock, one compaction pass), and
+    // listeners receive a single EntitiesDestroyedEvent instead of one
+    // EntityDestroyedEvent per entity. Invalid and repeated entities are skipped.
+    void DestroyEntities(std::span<const Entity> entities);
+    
     bool IsEntityValid(Entity entity) const {
         return m_idGenerator.IsValid(entity);
     }
+    
+    // ========================================
+    // Enabled State
+    // ----------------------------------------
+    // A disabled entity keeps its id and components, but View, Group and
+    // QueryEntities skip it. Toggling is not a structural change: nothing moves in
+    // storage and no component events fire, so pooled entities (EntityPool.h) can be
+    // parked and reused at no cost to the arrays or listeners.
+    //
+    // SetEntityEnabled() publishes an EntityEnabledChangedEvent. Enabling also marks
+    // every component of the entity as changed so Changed<T> readers (caches,
+    // spatial grid, transforms) pick it up again. Like structural changes, it must
+    // not run during system updates: record CommandBuffer::SetEntityEnabled instead.
+    // Code that walks component arrays directly should check IsEntityEnabled().
+    // ========================================
+    void SetEntityEnabled(Entity entity, bool enabled);
+    
+    bool IsEntityEnabled(Entity entity) const {
+        return m_disabledCount == 0 || entity.id >= m_disabled.size() || !m_disabled[entity.id];
+    }
+    
+    size_t GetDisabledEntityCount() const { return m_disabledCount; }
 
     size_t GetEntityCount() const { return m_idGenerator.GetActiveCount(); }
 
+    // ========================================
+    // Reactive Queues
+    // ----------------------------------------
+    // A registered ReactiveQueue receives every component addition/removal of a
+    // type it watches, and the destruction and enabling/disabling of entities
+    // that have one (Restore() reports the old world as removed and the restored
+    // one as added). Batches don't delay them. The queue is not owned: unregister
+    // it before it is destroyed. Not during system updates (see System::WatchComponents).
+    // ========================================
+    void RegisterReactiveQueue(ReactiveQueue* queue) {
+        if (std::find(m_reactiveQueues.begin(), m_reactiveQueues.end(), queue) == m_reactiveQueues.end()) {
+            m_reactiveQueues.push_back(queue);
+        }
+    }
+    
+    void UnregisterReactiveQueue(ReactiveQueue* queue) {
+        std::erase(m_reactiveQueues, queue);
+    }
+
     // ========================================
     // Component Management
+    // ----------------------------------------
+    // Shared components (IsSharedComponent<T>) live in a SharedComponentArray in both
+    // storage modes. They are read-only through GetComponent: AddComponent replaces
+    // an entity's value.
     // ========================================
     
     template<typename T>
@@ -289,11 +1287,20 @@ public:
             throw std::runtime_error("Cannot add component to invalid entity");
         }
         
-        GetComponentArray<T>()->InsertData(entity, component);
-        
         // Update signature
         uint32_t componentTypeID = GetComponentTypeID<T>();
-        m_signatures[entity].set(componentTypeID);
+
+        if constexpr (IsSharedComponent<T>::value) {
+            GetSharedComponentArray<T>()->InsertData(entity, component);
+        } else if (m_archetypeStorage) {
+            m_archetypeStorage->Insert(entity, componentTypeID, component);
+        } else {
+            GetComponentArray<T>()->InsertData(entity, component);
+        }
+        
+        m_signatures[entity.id].set(componentTypeID);
+        OnOwnedComponentAdded(componentTypeID, entity);
+        QueueComponentChange(ReactiveChange::Kind::ComponentAdded, entity, componentTypeID, typeid(T));
         
         // Fire component added event
         if (m_eventBus) {
@@ -301,17 +1308,65 @@ public:
         }
     }
 
+    // Add one component per entity (components[i] goes to entities[i]).
+    // Listeners receive a single ComponentsAddedEvent for the whole range.
+    template<typename T>
+    void AddComponents(std::span<const Entity> entities, std::span<const T> components) {
+        if (entities.size() != components.size()) {
+            throw std::runtime_error("AddComponents: entity and component counts differ");
+        }
+        for (Entity entity : entities) {
+            if (!m_idGenerator.IsValid(entity)) {
+                throw std::runtime_error("Cannot add component to invalid entity");
+            }
+        }
+        
+        uint32_t componentTypeID = GetComponentTypeID<T>();
+        
+        if constexpr (IsSharedComponent<T>::value) {
+            GetSharedComponentArray<T>()->InsertDataBulk(entities, components);
+        } else if (m_archetypeStorage) {
+            for (size_t i = 0; i < entities.size(); ++i) {
+                m_archetypeStorage->Insert(entities[i], componentTypeID, components[i]);
+            }
+        } else {
+            GetComponentArray<T>()->InsertDataBulk(entities, components);
+        }
+        
+        BatchScope batch(*this);
+        for (Entity entity : entities) {
+            m_signatures[entity.id].set(componentTypeID);
+            OnOwnedComponentAdded(componentTypeID, entity);
+            if (m_eventBus) {
+                FireComponentAddedEvent(entity, typeid(T));
+            }
+        }
+        QueueComponentChanges(ReactiveChange::Kind::ComponentAdded, entities, componentTypeID, typeid(T));
+    }
+
     template<typename T>
     void RemoveComponent(Entity entity) {
         if (!m_idGenerator.IsValid(entity)) {
             return;
         }
         
-        GetComponentArray<T>()->RemoveData(entity);
-        
         // Update signature
         uint32_t componentTypeID = GetComponentTypeID<T>();
-        m_signatures[entity].reset(componentTypeID);
+        const bool hadComponent = m_signatures[entity.id].test(componentTypeID);
+        OnOwnedComponentRemoving(componentTypeID, entity);
+
+        if constexpr (IsSharedComponent<T>::value) {
+            GetSharedComponentArray<T>()->RemoveData(entity);
+        } else if (m_archetypeStorage) {
+            m_archetypeStorage->Remove(entity, componentTypeID);
+        } else {
+            GetComponentArray<T>()->RemoveData(entity);
+        }
+        
+        m_signatures[entity.id].reset(componentTypeID);
+        if (hadComponent) {
+            QueueComponentChange(ReactiveChange::Kind::ComponentRemoved, entity, componentTypeID, typeid(T));
+        }
         
         // Fire component removed event
         if (m_eventBus) {
@@ -321,16 +1376,35 @@ public:
 
     template<typename T>
     T& GetComponent(Entity entity) {
+        static_assert(!IsSharedComponent<T>::value,
+                      "Shared components are immutable: read them through a const ComponentManager, change them with AddComponent");
+        if (m_archetypeStorage) {
+            return GetArchetypeComponent<T>(entity);
+        }
         return GetComponentArray<T>()->GetData(entity);
     }
     
+    // Const access does not mark the component as changed
     template<typename T>
     const T& GetComponent(Entity entity) const {
-        return GetComponentArray<T>()->GetData(entity);
+        if constexpr (IsSharedComponent<T>::value) {
+            return GetSharedComponentArray<T>()->GetData(entity);
+        } else {
+            if (m_archetypeStorage) {
+                return GetArchetypeComponent<T>(entity);
+            }
+            const ComponentArray<T>& array = *GetComponentArray<T>();
+            return array.GetData(entity);
+        }
     }
     
     template<typename T>
     T* GetComponentPtr(Entity entity) {
+        static_assert(!IsSharedComponent<T>::value,
+                      "Shared components are immutable: read them through a const ComponentManager, change them with AddComponent");
+        if (m_archetypeStorage) {
+            return FindArchetypeComponent<T>(entity);
+        }
         auto array = GetComponentArray<T>();
         if (array->HasData(entity)) {
             return &array->GetData(entity);
@@ -340,11 +1414,19 @@ public:
     
     template<typename T>
     const T* GetComponentPtr(Entity entity) const {
-        auto array = GetComponentArray<T>();
-        if (array->HasData(entity)) {
-            return &array->GetData(entity);
+        if constexpr (IsSharedComponent<T>::value) {
+            const SharedComponentArray<T>& array = *GetSharedComponentArray<T>();
+            return array.HasData(entity) ? &array.GetData(entity) : nullptr;
+        } else {
+            if (m_archetypeStorage) {
+                return FindArchetypeComponent<T>(entity);
+            }
+            const ComponentArray<T>& array = *GetComponentArray<T>();
+            if (array.HasData(entity)) {
+                return &array.GetData(entity);
+            }
+            return nullptr;
         }
-        return nullptr;
     }
 
     template<typename T>
@@ -352,42 +1434,72 @@ public:
         if (!m_idGenerator.IsValid(entity)) {
             return false;
         }
-        return GetComponentArray<T>()->HasData(entity);
+        if constexpr (IsSharedComponent<T>::value) {
+            return GetSharedComponentArray<T>()->HasData(entity);
+        } else {
+            if (m_archetypeStorage) {
+                return FindArchetypeComponent<T>(entity) != nullptr;
+            }
+            return GetComponentArray<T>()->HasData(entity);
+        }
     }
     
     // Get entity signature
     Signature GetSignature(Entity entity) const {
-        auto it = m_signatures.find(entity);
-        if (it != m_signatures.end()) {
-            return it->second;
+        if (!m_idGenerator.IsValid(entity)) {
+            return Signature();
         }
-        return Signature();
+        return m_signatures[entity.id];
     }
     
     // ========================================
     // Query System
     // ========================================
     
-    // Query entities with specific components
-    // Query entities with specific components
+    // Query enabled entities with specific components
     template<typename... Components>
     std::vector<Entity> QueryEntities() const {
         // Build required signature
         Signature requiredSignature;
-        (requiredSignature.set(GetComponentTypeID_Const<Components>()), ...);
+        (requiredSignature.set(ComponentTypeID<Components>()), ...);
+        
+        if (m_archetypeStorage) {
+            // Shared components are not part of the archetype: check them per entity
+            Signature archetypeSignature;
+            ((IsSharedComponent<Components>::value ? void() : void(archetypeSignature.set(ComponentTypeID<Components>()))), ...);
+            const bool anyShared = (IsSharedComponent<Components>::value || ...);
+            
+            std::vector<Entity> result;
+            m_archetypeStorage->ForEachArchetype(archetypeSignature, [&](const Archetype& archetype) {
+                for (size_t chunk = 0; chunk < archetype.GetChunkCount(); ++chunk) {
+                    const Entity* entities = archetype.GetEntities(chunk);
+                    const size_t count = archetype.GetChunkEntityCount(chunk);
+                    if (!anyShared && m_disabledCount == 0) {
+                        result.insert(result.end(), entities, entities + count);
+                        continue;
+                    }
+                    for (size_t i = 0; i < count; ++i) {
+                        if (EntityMatchesSignature(entities[i], requiredSignature) && IsEntityEnabled(entities[i])) {
+                            result.push_back(entities[i]);
+                        }
+                    }
+                }
+            });
+            return result;
+        }
         
         // Find the smallest component array to iterate
-        std::shared_ptr<IComponentArray> smallestArray = nullptr;
+        IComponentArray* smallestArray = nullptr;
         size_t minSize = (std::numeric_limits<size_t>::max)();
         
         // Helper lambda to check array size
-        auto checkArray = [&](std::type_index typeIdx) {
-            auto it = m_componentArrays.find(typeIdx);
-            if (it != m_componentArrays.end()) {
-                size_t size = it->second->GetSize();
+        auto checkArray = [&](uint32_t typeID) {
+            IComponentArray* array = m_arrayLookup[typeID].load(std::memory_order_acquire);
+            if (array) {
+                size_t size = array->GetSize();
                 if (size < minSize) {
                     minSize = size;
-                    smallestArray = it->second;
+                    smallestArray = array;
                 }
             } else {
                 // If a component array doesn't exist, no entities have this component
@@ -398,7 +1510,7 @@ public:
         };
         
         // Check all component types
-        (checkArray(std::type_index(typeid(Components))), ...);
+        (checkArray(ComponentTypeID<Components>()), ...);
         
         std::vector<Entity> result;
         
@@ -413,7 +1525,7 @@ public:
             Entity entity = smallestArray->GetEntityAtIndex(i);
             
             // Check against signature (O(1))
-            if (EntityMatchesSignature(entity, requiredSignature)) {
+            if (EntityMatchesSignature(entity, requiredSignature) && IsEntityEnabled(entity)) {
                 result.push_back(entity);
             }
         }
@@ -421,63 +1533,286 @@ public:
         return result;
     }
     
+    // Iterate archetype chunks containing all Components (Archetype mode only).
+    // fn(size_t count, Entity* entities, Components*... columns) is called once per chunk;
+    // element i of every column belongs to entities[i], so iteration is linear in memory.
+    // Disabled entities are included and nothing is marked as changed.
+    template<typename... Components, typename Func>
+    void ForEachChunk(Func&& fn) const {
+        static_assert(!(IsSharedComponent<Components>::value || ...), "Shared components are not stored in chunks");
+        if (!m_archetypeStorage) {
+            throw std::runtime_error("ForEachChunk requires Archetype storage mode");
+        }
+
+        Signature requiredSignature;
+        (requiredSignature.set(ComponentTypeID<Components>()), ...);
+
+        m_archetypeStorage->ForEachArchetype(requiredSignature, [&](const Archetype& archetype) {
+            for (size_t chunk = 0; chunk < archetype.GetChunkCount(); ++chunk) {
+                fn(archetype.GetChunkEntityCount(chunk),
+                   archetype.GetEntities(chunk),
+                   reinterpret_cast<Components*>(archetype.GetColumn(chunk, ComponentTypeID<Components>()))...);
+            }
+        });
+    }
+    
+    // ========================================
+    // Owning Groups
+    // ----------------------------------------
+    // An owning group keeps the dense arrays of its component types sorted so that
+    // the first GetOwningGroupSize() slots of every owned array hold the entities that
+    // have all owned components, in the same order. Group<Owned...> (Group.h) walks
+    // them in lockstep without sparse lookups.
+    //
+    // Membership follows AddComponent(s)/RemoveComponent/DestroyEntity/Restore by
+    // swapping dense slots (O(owned types) per change); declaring a group sorts the
+    // existing entities once. A component type can be owned by one group only.
+    // SparseSet mode only; declare groups outside of system updates.
+    // ========================================
+    template<typename... Owned>
+    uint32_t DeclareOwningGroup() {
+        static_assert(sizeof...(Owned) >= 2, "An owning group needs at least two component types");
+        if (m_archetypeStorage) {
+            throw std::runtime_error("Owning groups are not available in Archetype storage mode");
+        }
+        (GetComponentArray<Owned>(), ...);
+        return DeclareOwningGroupByIDs({ ComponentTypeID<Owned>()... });
+    }
+    
+    size_t GetOwningGroupSize(uint32_t groupIndex) const { return m_groups[groupIndex]->size; }
+    size_t GetOwningGroupCount() const { return m_groups.size(); }
+    
+    // ========================================
+    // Dense Order
+    // ----------------------------------------
+    // The order of a type's dense array only decides iteration order and memory
+    // locality; reordering changes no component values or change ticks. Used by
+    // SpatialOrder. SparseSet mode only; not while systems iterate.
+    // ========================================
+    
+    // Slots [0, n) of the type's array that belong to its owning group (0 if not owned)
+    size_t GetOwnedPrefixSize(uint32_t typeID) const;
+    
+    // Exchange two dense slots of a type. Owned types swap in every array of their
+    // group, keeping the group aligned; swaps across the group boundary (or out of
+    // range) are refused and return false.
+    bool SwapDenseSlots(uint32_t typeID, size_t first, size_t second);
+    
     // Check if entity matches signature
     bool EntityMatchesSignature(Entity entity, const Signature& requiredSignature) const {
-        auto it = m_signatures.find(entity);
-        if (it == m_signatures.end()) {
+        if (!m_idGenerator.IsValid(entity)) {
             return false;
         }
-        return (it->second & requiredSignature) == requiredSignature;
+        return (m_signatures[entity.id] & requiredSignature) == requiredSignature;
     }
     
     // Helper to get the raw array for systems
+    // Only available in SparseSet mode: archetype storage has no per-type array
     template<typename T>
     std::shared_ptr<ComponentArray<T>> GetComponentArray() const {
-        std::type_index typeIndex(typeid(T));
-
-        auto it = m_componentArrays.find(typeIndex);
-        if (it == m_componentArrays.end()) {
-            // Auto-create component array if not exists
-            auto array = std::make_shared<ComponentArray<T>>();
-            m_componentArrays[typeIndex] = array;
-            return array;
+        static_assert(!IsSharedComponent<T>::value, "Shared components are stored in GetSharedComponentArray<T>()");
+        if (m_archetypeStorage) {
+            throw std::runtime_error("GetComponentArray is not available in Archetype storage mode");
         }
 
-        return std::static_pointer_cast<ComponentArray<T>>(it->second);
+        uint32_t typeID = ComponentTypeID<T>();
+        if (!m_arrayLookup[typeID].load(std::memory_order_acquire)) {
+            // Auto-create component array if not exists (re-checked under the write lock)
+            std::unique_lock<std::shared_mutex> lock(m_registryMutex);
+            if (!m_componentArrays[typeID]) {
+                m_componentArrays[typeID] = CreateComponentArray<T>(&m_changeTick);
+                m_arrayLookup[typeID].store(m_componentArrays[typeID].get(), std::memory_order_release);
+                GetArrayFactories()[typeID].store(&CreateComponentArray<T>, std::memory_order_release);
+            }
+        }
+        
+        // Slots are never reassigned once published, so reading the owner is safe here
+        return std::static_pointer_cast<ComponentArray<T>>(m_componentArrays[typeID]);
+    }
+    
+    // Storage of a shared component type (available in both storage modes)
+    template<typename T>
+    std::shared_ptr<SharedComponentArray<T>> GetSharedComponentArray() const {
+        static_assert(IsSharedComponent<T>::value, "T is not a shared component (see IsSharedComponent)");
+        
+        uint32_t typeID = ComponentTypeID<T>();
+        if (!m_arrayLookup[typeID].load(std::memory_order_acquire)) {
+            std::unique_lock<std::shared_mutex> lock(m_registryMutex);
+            if (!m_componentArrays[typeID]) {
+                m_componentArrays[typeID] = CreateSharedComponentArray<T>(&m_changeTick);
+                m_arrayLookup[typeID].store(m_componentArrays[typeID].get(), std::memory_order_release);
+                GetArrayFactories()[typeID].store(&CreateSharedComponentArray<T>, std::memory_order_release);
+            }
+        }
+        
+        return std::static_pointer_cast<SharedComponentArray<T>>(m_componentArrays[typeID]);
     }
 
 private:
-    // Const version for query (doesn't modify m_componentTypeIDs)
+    // Archetype lookups (only valid when m_archetypeStorage is set)
     template<typename T>
-    uint32_t GetComponentTypeID_Const() const {
-        std::type_index typeIndex(typeid(T));
-        auto it = m_componentTypeIDs.find(typeIndex);
-        if (it == m_componentTypeIDs.end()) {
-            throw std::runtime_error("Component type not registered");
+    T* FindArchetypeComponent(Entity entity) const {
+        return static_cast<T*>(m_archetypeStorage->Get(entity, ComponentTypeID<T>()));
+    }
+
+    template<typename T>
+    T& GetArchetypeComponent(Entity entity) const {
+        T* component = FindArchetypeComponent<T>(entity);
+        if (!component) {
+            throw std::runtime_error("Retrieving non-existent component.");
         }
-        return it->second;
+        return *component;
+    }
+    
+    // Snapshot helpers
+    static constexpr uint32_t SNAPSHOT_MAGIC = 0x53534345; // "ECSS"
+    static constexpr uint32_t SNAPSHOT_VERSION = 3;
+    
+    using ComponentArrayFactory = std::shared_ptr<IComponentArray> (*)(const std::atomic<uint32_t>*);
+    
+    template<typename T>
+    static std::shared_ptr<IComponentArray> CreateComponentArray(const std::atomic<uint32_t>* changeTick) {
+        return std::make_shared<ComponentArray<T>>(changeTick);
+    }
+    
+    template<typename T>
+    static std::shared_ptr<IComponentArray> CreateSharedComponentArray(const std::atomic<uint32_t>* changeTick) {
+        return std::make_shared<SharedComponentArray<T>>(changeTick);
     }
     
+    // Component type IDs are process-wide, so are the factories: Restore() can create
+    // arrays for any type some ComponentManager has used
+    static std::array<std::atomic<ComponentArrayFactory>, MAX_COMPONENTS>& GetArrayFactories() {
+        static std::array<std::atomic<ComponentArrayFactory>, MAX_COMPONENTS> factories{};
+        return factories;
+    }
+    
+    IComponentArray* GetOrCreateComponentArray(uint32_t typeID);
+    void ClearAllComponentArrays();
+    
+    // Owning group helpers
+    static constexpr uint8_t NO_GROUP = 0xFF;
+    
+    struct OwningGroup {
+        Signature signature;
+        std::vector<IComponentArray*> arrays; // Owned arrays; members occupy [0, size) of each
+        size_t size = 0;
+    };
+    
+    uint32_t DeclareOwningGroupByIDs(std::initializer_list<uint32_t> typeIDs);
+    void AddToGroup(OwningGroup& group, Entity entity);
+    void RemoveFromGroup(OwningGroup& group, Entity entity);
+    void RebuildGroup(OwningGroup& group);
+    
+    void OnOwnedComponentAdded(uint32_t typeID, Entity entity) {
+        if (m_groupOfType[typeID] != NO_GROUP) {
+            AddToGroup(*m_groups[m_groupOfType[typeID]], entity);
+        }
+    }
+    
+    void OnOwnedComponentRemoving(uint32_t typeID, Entity entity) {
+        if (m_groupOfType[typeID] != NO_GROUP) {
+            RemoveFromGroup(*m_groups[m_groupOfType[typeID]], entity);
+        }
+    }
+    void RegisterBuiltInSerializers();
+    
     // Event firing helpers
     void FireComponentAddedEvent(Entity entity, std::type_index componentType);
     void FireComponentRemovedEvent(Entity entity, std::type_index componentType);
     void FireEntityDestroyedEvent(Entity entity);
+    
+    // Reactive queue helpers
+    void QueueComponentChange(ReactiveChange::Kind kind, Entity entity, uint32_t typeID, std::type_index componentType) {
+        for (ReactiveQueue* queue : m_reactiveQueues) {
+            if (queue->IsWatching(typeID)) {
+                queue->Push(kind, entity, componentType);
+            }
+        }
+    }
+    
+    void QueueComponentChanges(ReactiveChange::Kind kind, std::span<const Entity> entities, uint32_t typeID, std::type_index componentType) {
+        for (ReactiveQueue* queue : m_reactiveQueues) {
+            if (!queue->IsWatching(typeID)) continue;
+            for (Entity entity : entities) {
+                queue->Push(kind, entity, componentType);
+            }
+        }
+    }
+    
+    // 'signature': the entity's components (before they were cleared, for destruction)
+    void QueueEntityChange(ReactiveChange::Kind kind, Entity entity, const Signature& signature) {
+        for (ReactiveQueue* queue : m_reactiveQueues) {
+            if (queue->IsWatchingAny(signature)) {
+                queue->Push(kind, entity, typeid(void));
+            }
+        }
+    }
+    
+    // Forget the disabled flag of a destroyed entity
+    void ClearDisabled(Entity entity) {
+        if (entity.id < m_disabled.size() && m_disabled[entity.id]) {
+            m_disabled[entity.id] = 0;
+            --m_disabledCount;
+        }
+    }
 
+    // Storage backend
+    StorageMode m_storageMode = StorageMode::SparseSet;
+    std::unique_ptr<ArchetypeStorage> m_archetypeStorage; // Only set in Archetype mode
+    
     // Entity ID generator
     EntityIDGenerator m_idGenerator;
     
-    // Component type registration
-    mutable std::unordered_map<std::type_index, uint32_t> m_componentTypeIDs;
-    uint32_t m_nextComponentTypeID = 0;
+    // Archetype mode: component types whose layout was handed to m_archetypeStorage
+    std::array<std::atomic<bool>, MAX_COMPONENTS> m_registeredTypes{};
     
-    // Entity signatures (which components each entity has)
-    std::unordered_map<Entity, Signature> m_signatures;
+    // Entity signatures (which components each entity has), indexed by entity id
+    std::vector<Signature> m_signatures;
     
-    // Map from type index to component array
-    mutable std::unordered_map<std::type_index, std::shared_ptr<IComponentArray>> m_componentArrays;
+    // Disabled flags, indexed by entity id (grown on demand; see SetEntityEnabled)
+    std::vector<uint8_t> m_disabled;
+    size_t m_disabledCount = 0;
+    
+    // Component arrays (ComponentArray or SharedComponentArray) indexed by component
+    // type ID; in Archetype mode only shared types have one. m_componentArrays owns
+    // them; m_arrayLookup publishes each one once created so lookups take no lock.
+    mutable std::array<std::shared_ptr<IComponentArray>, MAX_COMPONENTS> m_componentArrays;
+    mutable std::array<std::atomic<IComponentArray*>, MAX_COMPONENTS> m_arrayLookup{};
+    
+    // Owning groups (unique_ptr: helpers hold references across declarations) and the
+    // group that owns each component type
+    std::vector<std::unique_ptr<OwningGroup>> m_groups;
+    std::array<uint8_t, MAX_COMPONENTS> m_groupOfType = [] {
+        std::array<uint8_t, MAX_COMPONENTS> groups{};
+        groups.fill(NO_GROUP);
+        return groups;
+    }();
+    
+    // Snapshot serializers for non-trivially copyable component types, by type ID
+    std::array<std::unique_ptr<IComponentSerializer>, MAX_COMPONENTS> m_serializers;
+
+    // Serializes lazy creation of component arrays and archetype type registration:
+    // systems scheduled concurrently may create them at the same time
+    mutable std::shared_mutex m_registryMutex;
     
     // Event bus for component lifecycle events
     EventBus* m_eventBus = nullptr;
+    
+    // Current change tick (starts at 1 so that everything is newer than a 'since' of 0)
+    std::atomic<uint32_t> m_changeTick{ 1 };
+    
+    // Notifications collected while batching, grouped by component type
+    struct PendingNotification {
+        std::type_index componentType;
+        std::vector<Entity> entities;
+    };
+    uint32_t m_batchDepth = 0;
+    std::vector<PendingNotification> m_pendingAdded;
+    std::vector<PendingNotification> m_pendingRemoved;
+    
+    // Registered reactive queues (not owned)
+    std::vector<ReactiveQueue*> m_reactiveQueues;
 };
 
 } // namespace ECS
@@ -1,8 +1,13 @@
 #pragma once
 
 #include <DirectXMath.h>
+#include <cstddef>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <type_traits>
 #include "../Physics/Collision.h"
+#include "Entity.h"
 #include "Components/InputComponent.h"
 
 // Forward declarations
@@ -21,7 +26,34 @@ struct TransformComponent {
     DirectX::XMFLOAT3 scale = { 1.0f, 1.0f, 1.0f };
 };
 
+// ========================================
+// Parent Component
+// Makes the TransformComponent relative to
+// another entity's world transform
+// ========================================
+struct ParentComponent {
+    Entity parent = NULL_ENTITY;
+};
+
+// ========================================
+// World Matrix Component
+// Cached local-to-world matrix (written by
+// TransformSystem, read-only elsewhere)
+// 'previous' is the matrix of the tick
+// before; renderers blend the two between
+// fixed simulation ticks. Equal to 'world'
+// once the entity stops moving
+// ========================================
+struct WorldMatrixComponent {
+    DirectX::XMFLOAT4X4 world = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f };
+    DirectX::XMFLOAT4X4 previous = world;
 
+    bool IsMoving() const { return std::memcmp(&world, &previous, sizeof(world)) != 0; }
+};
 
 // ========================================
 // Physics Component
@@ -41,13 +73,44 @@ struct PhysicsComponent {
     bool isGrounded = false;
 };
 
+// ========================================
+// Shared Components
+// Types marked with IsSharedComponent store
+// one copy per distinct value; entities
+// reference it and are bucketed by value
+// (see SharedComponentArray). They need
+// operator== and a SharedComponentHash.
+// ========================================
+template<typename T> struct IsSharedComponent : std::false_type {};
+
+template<typename T>
+struct SharedComponentHash {
+    size_t operator()(const T& value) const { return std::hash<T>()(value); }
+};
+
 // ========================================
 // Render Component
 // Mesh and material for rendering
+// Shared: entities with the same mesh and
+// material reference a single value
 // ========================================
 struct RenderComponent {
     Mesh* mesh = nullptr;
     std::shared_ptr<Material> material;
+
+    bool operator==(const RenderComponent& other) const {
+        return mesh == other.mesh && material == other.material;
+    }
+};
+
+template<> struct IsSharedComponent<RenderComponent> : std::true_type {};
+
+template<>
+struct SharedComponentHash<RenderComponent> {
+    size_t operator()(const RenderComponent& render) const {
+        size_t hash = std::hash<const void*>()(render.mesh);
+        return hash ^ (std::hash<const void*>()(render.material.get()) + 0x9e3779b9 + (hash << 6) + (hash >> 2));
+    }
 };
 
 // ========================================
@@ -119,6 +182,7 @@ struct CameraComponent {
     // Cached matrices (updated by CameraSystem)
     DirectX::XMFLOAT4X4 viewMatrix;
     DirectX::XMFLOAT4X4 projectionMatrix;
+    DirectX::XMFLOAT3 eyePosition = { 0.0f, 0.0f, 0.0f }; // Interpolated position the view was built from
 };
 
 // ========================================
@@ -1,16 +1,21 @@
 #pragma once
 
 #include "EntityHandle.h"
+#include "WorldSnapshot.h"
 #include <cstdint>
 #include <vector>
 #include <stdexcept>
+#include <span>
+#include <utility>
 
 namespace ECS {
 
 // Entity is now an EntityHandle with versioning
 using Entity = EntityHandle;
 constexpr Entity NULL_ENTITY = NULL_ENTITY_HANDLE;
-constexpr uint32_t MAX_ENTITIES = 5000;
+// Upper bound on entity IDs. Nothing is sized by it: ID tables, signatures and
+// component sparse sets grow on demand with the highest ID in use.
+constexpr uint32_t MAX_ENTITIES = 1u << 24;
 
 // ==================================================================================
 // EntityIDGenerator
@@ -18,11 +23,12 @@ constexpr uint32_t MAX_ENTITIES = 5000;
 // Manages entity ID generation, recycling, and versioning.
 // When an entity is destroyed, its ID goes into a free list but the version increments.
 // This prevents stale entity handles from being used after the entity is destroyed.
+// The version table grows as new IDs are handed out.
 // ==================================================================================
 class EntityIDGenerator {
 public:
     EntityIDGenerator() : m_nextID(1) {
-        m_versions.resize(MAX_ENTITIES, 0);
+        m_versions.resize(1, 0); // ID 0 is the null entity
     }
     
     // Create a new entity handle
@@ -35,11 +41,11 @@ public:
             m_freeList.pop_back();
         } else {
             // Generate new ID
+            if (m_nextID >= MAX_ENTITIES) {
+                throw std::runtime_error("Maximum entity count exceeded");
+            }
             id = m_nextID++;
-        }
-        
-        if (id >= MAX_ENTITIES) {
-            throw std::runtime_error("Maximum entity count exceeded");
+            m_versions.push_back(0);
         }
         
         // Return handle with current version for this ID
@@ -51,7 +57,7 @@ public:
         if (!entity.IsValid()) return;
         
         uint32_t id = entity.id;
-        if (id >= MAX_ENTITIES) return;
+        if (id >= m_versions.size()) return;
         
         // Verify this is the current version (prevent double-free)
         if (m_versions[id] != entity.version) {
@@ -68,10 +74,15 @@ public:
     // Check if an entity handle is still valid
     bool IsValid(Entity entity) const {
         if (!entity.IsValid()) return false;
-        if (entity.id >= MAX_ENTITIES) return false;
+        if (entity.id >= m_versions.size()) return false;
         return m_versions[entity.id] == entity.version;
     }
     
+    // One past the highest ID handed out so far (size for tables indexed by ID)
+    uint32_t GetIDCapacity() const {
+        return static_cast<uint32_t>(m_versions.size());
+    }
+    
     // Get total number of IDs created (including recycled)
     uint32_t GetTotalCreated() const {
         return m_nextID - 1;
@@ -82,6 +93,27 @@ public:
         return (m_nextID - 1) - static_cast<uint32_t>(m_freeList.size());
     }
     
+    // Snapshot support: versions and the free list are written as raw arrays
+    void Serialize(SnapshotWriter& writer) const {
+        writer.Write(m_nextID);
+        writer.WriteArray(std::span<const uint32_t>(m_versions));
+        writer.WriteArray(std::span<const uint32_t>(m_freeList));
+    }
+    
+    void Deserialize(SnapshotReader& reader) {
+        uint32_t nextID = reader.Read<uint32_t>();
+        std::vector<uint32_t> versions;
+        std::vector<uint32_t> freeList;
+        reader.ReadArray(versions);
+        reader.ReadArray(freeList);
+        if (versions.empty() || nextID != versions.size()) {
+            throw std::runtime_error("Snapshot: corrupt entity ID table");
+        }
+        m_nextID = nextID;
+        m_versions = std::move(versions);
+        m_freeList = std::move(freeList);
+    }
+    
 private:
     uint32_t m_nextID;                  // Next ID to assign
     std::vector<uint32_t> m_freeList;   // Recycled IDs
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "ComponentManager.h"
+#include "CommandBuffer.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace ECS {
+
+// ==================================================================================
+// EntityPool
+// ----------------------------------------------------------------------------------
+// Pre-created entities for high-churn spawns (projectiles, effects). Parked entities
+// are disabled (ComponentManager::SetEntityEnabled), so they keep their components
+// but no View, Group or system sees them. Acquire() and Release() only toggle that
+// flag through the command buffer: a warm pool causes no structural changes, no
+// component events and no array moves.
+//
+// The prefab adds the components every pooled entity carries. An acquired entity
+// keeps the values it had when released; overwrite them with
+// CommandBuffer::SetComponent, recorded after Acquire() in the same buffer.
+//
+// Example Usage:
+//     EntityPool projectiles(componentManager, 64, [&](ComponentManager& components, Entity entity) {
+//         components.AddComponent(entity, TransformComponent{});
+//         components.AddComponent(entity, ProjectileComponent{});
+//     });
+//
+//     // In a system update
+//     Entity projectile = projectiles.Acquire(Commands());
+//     if (projectile != NULL_ENTITY) {
+//         Commands().SetComponent(projectile, TransformComponent{ spawnPos });
+//     }
+//     ...
+//     projectiles.Release(projectile, Commands());
+//
+// Notes:
+// - Acquire() returns NULL_ENTITY when every entity is in use; Grow() adds more
+//   (outside of system updates, it creates entities).
+// - Acquire()/Release() may be called concurrently from systems; the state change
+//   they record runs at playback and refers to the pool, which must outlive it.
+// - The enabled flags are the source of truth: after ComponentManager::Restore the
+//   pool re-derives its free list from them. Entities destroyed behind the pool's
+//   back are dropped.
+// ==================================================================================
+class EntityPool {
+public:
+    using Prefab = std::function<void(ComponentManager&, Entity)>;
+
+    EntityPool(ComponentManager& componentManager, size_t capacity, Prefab prefab);
+
+    EntityPool(const EntityPool&) = delete;
+    EntityPool& operator=(const EntityPool&) = delete;
+
+    // Create 'count' more parked entities (structural: not during system updates)
+    void Grow(size_t count);
+
+    // Hand out a parked entity; it is enabled when 'commands' is played back.
+    // Returns NULL_ENTITY if the pool is exhausted.
+    Entity Acquire(CommandBuffer& commands);
+
+    // Park 'entity' again when 'commands' is played back. Returns false if the entity
+    // does not belong to the pool (the caller should destroy it instead).
+    bool Release(Entity entity, CommandBuffer& commands);
+
+    bool Owns(Entity entity) const;
+
+    size_t GetCapacity() const;
+    size_t GetFreeCount() const;
+
+private:
+    enum class SlotState : uint8_t {
+        Free,       // Parked (disabled)
+        Acquiring,  // Handed out, enable not played back yet
+        Active,     // Enabled
+        Releasing,  // Disable not played back yet
+        Lost        // Entity destroyed outside the pool
+    };
+
+    struct Slot {
+        Entity entity;
+        SlotState state = SlotState::Free;
+    };
+
+    // Re-derive the free list from the enabled flags (after a Restore); needs m_mutex
+    void RefreshFreeList();
+
+    ComponentManager& m_componentManager;
+    Prefab m_prefab;
+
+    mutable std::mutex m_mutex;
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_freeSlots;
+    std::unordered_map<Entity, uint32_t> m_slotOfEntity;
+};
+
+} // namespace ECS
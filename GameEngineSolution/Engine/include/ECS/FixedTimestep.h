@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace ECS {
+
+// ==================================================================================
+// FixedTimestep
+// ----------------------------------------------------------------------------------
+// Accumulator for a fixed-rate simulation driven by a variable frame rate. Each
+// frame adds its duration; every whole step in the accumulator is one simulation
+// tick, and the remainder becomes the interpolation factor renderers blend the
+// last two ticks with (see WorldMatrixComponent::previous).
+//
+// Frames that would need more than maxStepsPerFrame ticks drop the excess time, so
+// a slow frame can't make the next one slower still; the simulation runs slow
+// instead.
+//
+// Example Usage:
+//     const uint32_t steps = timestep.Advance(frameSeconds);
+//     for (uint32_t i = 0; i < steps; ++i) systemManager.UpdateSimulation(timestep.GetStep());
+//     renderSystem->SetInterpolationAlpha(timestep.GetAlpha());
+// ==================================================================================
+class FixedTimestep {
+public:
+    FixedTimestep(float tickRate, uint32_t maxStepsPerFrame)
+        : m_step(1.0f / tickRate)
+        , m_maxStepsPerFrame((std::max)(maxStepsPerFrame, 1u)) {}
+
+    // Add a frame's duration; returns the ticks to simulate this frame
+    uint32_t Advance(float frameSeconds) {
+        m_accumulator += (std::max)(frameSeconds, 0.0f);
+
+        uint32_t steps = static_cast<uint32_t>(m_accumulator / m_step);
+        m_accumulator -= static_cast<float>(steps) * m_step; // Sub-step remainder
+        if (steps > m_maxStepsPerFrame) {
+            m_droppedSeconds += static_cast<float>(steps - m_maxStepsPerFrame) * m_step;
+            steps = m_maxStepsPerFrame;
+        }
+        return steps;
+    }
+
+    float GetStep() const { return m_step; }
+    float GetTickRate() const { return 1.0f / m_step; }
+
+    // How far the frame is between the last tick and the next one, in [0, 1)
+    float GetAlpha() const { return std::clamp(m_accumulator / m_step, 0.0f, 1.0f); }
+
+    // Simulation time lost to the per-frame step limit so far
+    float GetDroppedSeconds() const { return m_droppedSeconds; }
+
+    // Forget the partial step (e.g. after loading or rewinding)
+    void Reset() { m_accumulator = 0.0f; }
+
+private:
+    float m_step;
+    uint32_t m_maxStepsPerFrame;
+    float m_accumulator = 0.0f;
+    float m_droppedSeconds = 0.0f;
+};
+
+} // namespace ECS
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "ComponentManager.h"
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ECS {
+
+// ==================================================================================
+// Group<Owned...>
+// ----------------------------------------------------------------------------------
+// Iteration over an owning group (see ComponentManager::DeclareOwningGroup): the
+// first Size() slots of every owned dense array belong to the same entities, so the
+// walk is a straight loop over parallel arrays with no sparse lookups (disabled
+// entities are skipped, see ComponentManager::SetEntityEnabled).
+// Constructing a Group declares it on first use and sorts the existing entities.
+//
+// Component access follows View:
+// - Group<T>       : T& is passed and every visited T is marked as changed
+// - Group<const T> : const T& is passed, nothing is marked
+// Constness does not change which group is used: Group<A, const B> and Group<A, B>
+// share the same storage order.
+//
+// Example Usage:
+//     Group<PhysicsComponent, TransformComponent> bodies(componentManager);
+//     bodies.Each([](Entity entity, PhysicsComponent& physics, TransformComponent& transform) {
+//         ...
+//     });
+//
+//     Jobs::ParallelFor(bodies, 256, [](Entity, PhysicsComponent&, TransformComponent&) { ... });
+//
+// Notes:
+// - Structural changes to owned types reorder the arrays: do not add or remove owned
+//   components while iterating (use the command buffer).
+// - A type owned by this group cannot be owned by another one; iterate other
+//   combinations with View.
+// ==================================================================================
+template<typename... Owned>
+class Group {
+    static_assert(sizeof...(Owned) >= 2, "Group requires at least two component types");
+
+    template<typename T>
+    using Storage = ComponentArray<std::remove_const_t<T>>;
+
+public:
+    explicit Group(ComponentManager& componentManager)
+        : m_componentManager(componentManager)
+        , m_groupIndex(componentManager.DeclareOwningGroup<std::remove_const_t<Owned>...>())
+        , m_arrays(componentManager.GetComponentArray<std::remove_const_t<Owned>>().get()...)
+    {
+    }
+
+    // Number of entities that have every owned component (disabled ones included;
+    // Each skips them)
+    size_t Size() const {
+        return m_componentManager.GetOwningGroupSize(m_groupIndex);
+    }
+
+    bool IsEmpty() const { return Size() == 0; }
+
+    Entity GetEntity(size_t index) const {
+        return std::get<0>(m_arrays)->GetEntityArray()[index];
+    }
+
+    // Invoke fn(Entity, Owned&...) for every member
+    template<typename Func>
+    void Each(Func&& fn) const {
+        EachInRange(0, Size(), fn);
+    }
+
+    // Invoke fn(Entity, Owned&...) for members [begin, end) (used by Jobs::ParallelFor)
+    template<typename Func>
+    void EachInRange(size_t begin, size_t end, Func& fn) const {
+        EachInRange(begin, end, fn, std::index_sequence_for<Owned...>{});
+    }
+
+private:
+    template<typename Func, size_t... I>
+    void EachInRange(size_t begin, size_t end, Func& fn, std::index_sequence<I...>) const {
+        const Entity* entities = std::get<0>(m_arrays)->GetEntityArray().data();
+        std::tuple<std::remove_const_t<Owned>*...> columns(std::get<I>(m_arrays)->GetComponentArray().data()...);
+
+        for (size_t i = begin; i < end; ++i) {
+            if (!m_componentManager.IsEntityEnabled(entities[i])) continue;
+            (MarkChanged<I>(i), ...);
+            fn(entities[i], static_cast<Owned&>(std::get<I>(columns)[i])...);
+        }
+    }
+
+    template<size_t I>
+    void MarkChanged(size_t index) const {
+        if constexpr (!std::is_const_v<std::tuple_element_t<I, std::tuple<Owned...>>>) {
+            std::get<I>(m_arrays)->MarkChangedAtIndex(index);
+        }
+    }
+
+    ComponentManager& m_componentManager;
+    uint32_t m_groupIndex;
+    std::tuple<Storage<Owned>*...> m_arrays;
+};
+
+} // namespace ECS
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Entity.h"
+#include "Signature.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <typeindex>
+#include <vector>
+
+namespace ECS {
+
+// ==================================================================================
+// ReactiveChange
+// ----------------------------------------------------------------------------------
+// One structural change recorded into a ReactiveQueue. componentType is the added or
+// removed component; entity-level changes carry typeid(void).
+// ==================================================================================
+struct ReactiveChange {
+    enum class Kind : uint8_t {
+        ComponentAdded,
+        ComponentRemoved,
+        EntityDestroyed,  // The entity had at least one watched component
+        EntityEnabled,    // Ditto (see ComponentManager::SetEntityEnabled)
+        EntityDisabled
+    };
+
+    Kind kind;
+    Entity entity;
+    std::type_index componentType;
+};
+
+// ==================================================================================
+// ReactiveQueue
+// ----------------------------------------------------------------------------------
+// Structural changes that touch a set of watched component types, appended by the
+// ComponentManager as they happen and consumed later in one pass - instead of a
+// synchronous EventBus callback per change that filters every component type.
+// Systems get one through System::WatchComponents(); it is drained before each
+// Update().
+//
+// Changes are kept in the order they were made, so a component added and removed
+// again before the drain ends up removed. Entities may have been destroyed since
+// a change was recorded: consumers check what they read.
+//
+// The queue is bounded: an owner that is not drained for a long time (disabled,
+// time-sliced out) would otherwise grow it without limit. Past GetCapacity()
+// changes the queue drops everything and records nothing more until the next
+// drain, which reports the overflow instead (see Drain) - the owner rebuilds from
+// the current world, which is cheaper than replaying that many changes anyway.
+//
+// Threading: no locks. Appends happen inside structural changes (command buffer
+// playback at phase boundaries, loading), draining happens inside the owner's
+// update; the engine never runs both at the same time, and the phase boundary
+// orders one after the other.
+// ==================================================================================
+class ReactiveQueue {
+public:
+    template<typename... Components>
+    void Watch() {
+        (m_watched.set(ComponentTypeID<Components>()), ...);
+    }
+
+    const Signature& GetWatched() const { return m_watched; }
+    bool IsWatching(uint32_t typeID) const { return m_watched.test(typeID); }
+    bool IsWatchingAny(const Signature& signature) const { return (signature & m_watched).any(); }
+
+    // Changes kept before the queue overflows
+    void SetCapacity(size_t capacity) { m_capacity = capacity; }
+    size_t GetCapacity() const { return m_capacity; }
+
+    // Called by the ComponentManager
+    void Push(ReactiveChange::Kind kind, Entity entity, std::type_index componentType) {
+        if (m_overflowed) return;
+        if (m_changes.size() >= m_capacity) {
+            m_changes.clear();
+            m_changes.shrink_to_fit();
+            m_overflowed = true;
+            return;
+        }
+        m_changes.push_back({ kind, entity, componentType });
+    }
+
+    // Hand the queued changes to fn(std::span<const ReactiveChange>) and empty the
+    // queue. Changes recorded by fn itself are kept for the next drain.
+    // After an overflow nothing is handed over: returns false once (the owner must
+    // rescan everything it tracks) and records again from then on.
+    template<typename Func>
+    bool Drain(Func&& fn) {
+        if (m_overflowed) {
+            m_overflowed = false;
+            return false;
+        }
+        if (m_changes.empty()) return true;
+        m_draining.swap(m_changes);
+        fn(std::span<const ReactiveChange>(m_draining));
+        m_draining.clear(); // Keeps the capacity for the next swap
+        return true;
+    }
+
+    // Drop the queued changes (e.g. after rebuilding from the current world)
+    void Clear() {
+        m_changes.clear();
+        m_overflowed = false;
+    }
+
+    size_t GetSize() const { return m_changes.size(); }
+    bool IsEmpty() const { return m_changes.empty() && !m_overflowed; }
+    bool HasOverflowed() const { return m_overflowed; }
+
+    static constexpr size_t DEFAULT_CAPACITY = 1u << 16;
+
+private:
+    Signature m_watched;
+    size_t m_capacity = DEFAULT_CAPACITY;
+    bool m_overflowed = false;
+    std::vector<ReactiveChange> m_changes;
+    std::vector<ReactiveChange> m_draining;
+};
+
+} // namespace ECS
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "ComponentManager.h"
+#include "WorldSnapshot.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace ECS {
+
+// ==================================================================================
+// RewindBuffer
+// ----------------------------------------------------------------------------------
+// History of the last N simulation ticks of a ComponentManager, for rollback and
+// "rewind N seconds" debugging.
+//
+// - Capture(tick) takes a WorldSnapshot (entity IDs, signatures, every component
+//   array) and stores it as a delta against the previous tick: each array is XORed
+//   with its previous version (snapshot sections, so one array growing does not
+//   shift the others) and the result run-length encoded; unchanged components cost
+//   a few bytes. Ticks that are a multiple of KeyframeInterval (and the first tick of a
+//   history) are stored as full, RLE-only keyframes.
+// - Rewind(tick) rebuilds the state from the nearest keyframe (at most
+//   KeyframeInterval - 1 deltas, independent of the history length), restores it
+//   and drops the newer ticks so the simulation can continue from there.
+// - Slots and their encode buffers are reused once the ring is full, so memory
+//   stays bounded by the capacity. The capacity is rounded up to a multiple of
+//   KeyframeInterval so keyframes keep landing in the same slots. Evicting a
+//   keyframe also evicts the deltas that depend on it, so between
+//   Capacity - KeyframeInterval + 1 and Capacity ticks are available.
+//
+// Ticks must be captured in consecutive order; a gap starts a new history.
+// Snapshots are process-local (see WorldSnapshot), so is the history.
+// ==================================================================================
+class RewindBuffer {
+public:
+    static constexpr size_t DEFAULT_KEYFRAME_INTERVAL = 30;
+
+    RewindBuffer(ComponentManager& componentManager, size_t capacity,
+                 size_t keyframeInterval = DEFAULT_KEYFRAME_INTERVAL);
+
+    // Stores the current state of the world as 'tick'
+    void Capture(uint64_t tick);
+
+    // Restores the world to 'tick' and forgets every newer tick.
+    // Throws std::runtime_error if the tick is not stored.
+    void Rewind(uint64_t tick);
+
+    // Decodes a stored tick without touching the world (e.g. to compare states)
+    bool GetSnapshot(uint64_t tick, WorldSnapshot& snapshot) const;
+
+    void Clear();
+
+    bool Contains(uint64_t tick) const { return m_count > 0 && tick >= GetOldestTick() && tick <= GetNewestTick(); }
+    bool IsEmpty() const { return m_count == 0; }
+    uint64_t GetOldestTick() const { return m_count > 0 ? m_frames[m_head].tick : 0; }
+    uint64_t GetNewestTick() const { return m_count > 0 ? m_frames[SlotAt(m_count - 1)].tick : 0; }
+
+    // Debug statistics
+    size_t GetCapacity() const { return m_frames.size(); }
+    size_t GetStoredTickCount() const { return m_count; }
+    size_t GetMemoryUsage() const;                                     // Bytes reserved by the history
+    size_t GetLastRawSize() const { return m_lastRawSize; }            // Uncompressed size of the last capture
+    size_t GetLastEncodedSize() const { return m_lastEncodedSize; }    // Stored size of the last capture
+    double GetLastCaptureTimeMs() const { return m_lastCaptureTimeMs; }
+
+private:
+    // References are shared between consecutive ticks while the asset set is unchanged
+    using ReferenceTable = std::vector<std::shared_ptr<void>>;
+
+    struct Frame
+    {
+        uint64_t tick = 0;
+        bool keyframe = false;
+        size_t size = 0;                               // Decoded snapshot size
+        std::vector<uint8_t> encoded;                  // XOR+RLE against the previous tick (or zeros)
+        std::vector<size_t> sections;                  // WorldSnapshot section offsets
+        std::shared_ptr<const ReferenceTable> references;
+    };
+
+    size_t SlotAt(size_t offset) const { return (m_head + offset) % m_frames.size(); }
+    void EvictOldest();
+    void DecodeInto(size_t offset, WorldSnapshot& snapshot) const;
+
+    // Lays 'base' out with the new section offsets: section k of 'aligned' is section k
+    // of 'base', truncated or zero-padded
+    static void AlignBase(std::span<const std::byte> base, const std::vector<size_t>& baseSections,
+                          const std::vector<size_t>& sections, size_t size, std::vector<std::byte>& aligned);
+
+    // Run-length encoded XOR of 'current' against 'base' (bytes past the end of 'base' are zero)
+    static void EncodeDelta(std::span<const std::byte> current, std::span<const std::byte> base,
+                            std::vector<uint8_t>& encoded);
+    // XORs an encoded delta into the aligned base
+    static void ApplyDelta(const std::vector<uint8_t>& encoded, std::vector<std::byte>& data);
+
+    ComponentManager& m_componentManager;
+    size_t m_keyframeInterval;
+
+    std::vector<Frame> m_frames; // Ring: oldest at m_head, always a keyframe
+    size_t m_head = 0;
+    size_t m_count = 0;
+
+    WorldSnapshot m_capture;          // Reused capture buffer
+    std::vector<std::byte> m_latest;  // Decoded newest tick: base of the next delta
+    std::vector<size_t> m_latestSections;
+    std::vector<std::byte> m_aligned; // Scratch for AlignBase
+
+    size_t m_lastRawSize = 0;
+    size_t m_lastEncodedSize = 0;
+    double m_lastCaptureTimeMs = 0.0;
+};
+
+} // namespace ECS
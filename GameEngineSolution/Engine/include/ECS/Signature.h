@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ECS {
+
+// ========================================
+// Component Signature
+// One bit per registered component type
+// ========================================
+constexpr size_t MAX_COMPONENTS = 64;
+using Signature = std::bitset<MAX_COMPONENTS>;
+
+// ==================================================================================
+// Component Type IDs
+// ----------------------------------------------------------------------------------
+// Every component type gets a small integral ID the first time ComponentTypeID<T>()
+// is called. IDs are process-wide (identical for every ComponentManager), dense
+// from 0, and index signatures and per-type storage directly - no type_index hash.
+// ==================================================================================
+namespace Detail {
+    inline uint32_t NextComponentTypeID() {
+        static std::atomic<uint32_t> s_nextID{ 0 };
+        uint32_t id = s_nextID.fetch_add(1, std::memory_order_relaxed);
+        if (id >= MAX_COMPONENTS) {
+            throw std::runtime_error("Maximum component types exceeded");
+        }
+        return id;
+    }
+
+    template<typename T>
+    uint32_t ComponentTypeIDOf() {
+        static const uint32_t s_id = NextComponentTypeID();
+        return s_id;
+    }
+}
+
+template<typename T>
+uint32_t ComponentTypeID() {
+    return Detail::ComponentTypeIDOf<std::remove_cv_t<T>>();
+}
+
+} // namespace ECS
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "ComponentManager.h"
+#include "Components.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ECS {
+
+// ==================================================================================
+// SpatialOrder
+// ----------------------------------------------------------------------------------
+// Background maintenance that reorders component arrays so entities close in space
+// are close in memory. Collision queries and render batches visit spatial
+// neighbourhoods; in insertion/swap-remove order every neighbour is a cache miss.
+//
+// Each tracked array is sorted by the Morton (Z-order) code of its entities'
+// TransformComponent position: x/z on a 256x256 grid over the bounds of the set
+// (a counting sort, so entities sharing a cell keep their relative order).
+// A pass runs in stages spread over many Step() calls, each doing at most
+// 'entriesPerStep' entries of work:
+//   Gather  - record entities and positions, grow the bounds
+//   Key     - grid cell per entity, cell histogram
+//   Scatter - target order
+//   Apply   - move each entity to its target slot (one swap per entity)
+// Tracked arrays take turns; when the last one finishes, the first starts again.
+//
+// Owned types (see ComponentManager::DeclareOwningGroup) stay valid: group members
+// are sorted inside the group prefix and move in lockstep in every owned array, so
+// tracking one type of a group orders the group's other arrays too.
+// Entities added or removed mid-pass only make that pass less exact; the next one
+// picks them up.
+//
+// Reordering changes no component values or change ticks. Call Step() between
+// updates, never while systems iterate (it moves dense slots). SparseSet mode only.
+//
+// Example Usage:
+//     SpatialOrder order(componentManager, 4096);
+//     order.Track<TransformComponent>(); // Also orders PhysicsComponent (Physics+Transform group)
+//     order.Track<ColliderComponent>();
+//     ...
+//     order.Step(); // Once per frame, after the simulation ticks
+// ==================================================================================
+class SpatialOrder {
+public:
+    static constexpr size_t DEFAULT_ENTRIES_PER_STEP = 4096;
+
+    explicit SpatialOrder(ComponentManager& componentManager, size_t entriesPerStep = DEFAULT_ENTRIES_PER_STEP);
+
+    SpatialOrder(const SpatialOrder&) = delete;
+    SpatialOrder& operator=(const SpatialOrder&) = delete;
+
+    template<typename T>
+    void Track() {
+        m_tracks.push_back({ ComponentTypeID<T>(), m_componentManager.GetComponentArray<T>() });
+    }
+
+    // Advance the current pass by up to 'entriesPerStep' entries
+    void Step();
+
+    // Run passes over every tracked array to completion (loading, benchmarks)
+    void SortAll();
+
+    void SetEntriesPerStep(size_t entries) { m_entriesPerStep = entries > 0 ? entries : 1; }
+    size_t GetEntriesPerStep() const { return m_entriesPerStep; }
+
+    // Debug statistics
+    size_t GetCompletedPassCount() const { return m_completedPasses; }
+    size_t GetLastPassSwapCount() const { return m_lastPassSwaps; } // Entities the last finished pass moved
+
+private:
+    static constexpr uint32_t GRID_BITS = 8;
+    static constexpr uint32_t CELL_COUNT = 1u << (2 * GRID_BITS);
+    static constexpr uint32_t BUCKET_COUNT = 2 * CELL_COUNT; // Owned-group members first, then the rest
+
+    enum class Stage : uint8_t { Gather, Key, Scatter, Apply };
+
+    struct TrackedArray {
+        uint32_t typeID;
+        std::shared_ptr<IComponentArray> array;
+    };
+
+    struct Item {
+        Entity entity;
+        float x = 0.0f;
+        float z = 0.0f;
+        uint32_t bucket = 0;   // Gather: region (0 owned, 1 not); Key: region + Morton cell
+        bool hasPosition = false;
+    };
+
+    // Each stage returns the entries it processed
+    size_t Gather(const TrackedArray& track, size_t budget);
+    size_t Key(size_t budget);
+    size_t Scatter(size_t budget);
+    size_t Apply(const TrackedArray& track, size_t budget);
+    void FinishPass();
+
+    static uint32_t MortonCode(uint32_t x, uint32_t z);
+
+    ComponentManager& m_componentManager;
+    std::shared_ptr<ComponentArray<TransformComponent>> m_transforms;
+    std::vector<TrackedArray> m_tracks;
+    size_t m_entriesPerStep;
+
+    // Current pass
+    size_t m_trackIndex = 0;
+    Stage m_stage = Stage::Gather;
+    size_t m_cursor = 0;
+    std::vector<Item> m_items;
+    std::vector<uint32_t> m_bucketOffsets; // Counts, then running target offsets
+    std::vector<Entity> m_order;           // Target dense order
+    float m_minX = 0.0f, m_maxX = 0.0f, m_minZ = 0.0f, m_maxZ = 0.0f;
+    size_t m_passSwaps = 0;
+
+    size_t m_completedPasses = 0;
+    size_t m_lastPassSwaps = 0;
+};
+
+} // namespace ECS
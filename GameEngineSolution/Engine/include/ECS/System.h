@@ -2,7 +2,14 @@
 
 #include "ComponentManager.h"
 #include "SystemPhase.h"
+#include "SystemAccess.h"
+#include "CommandBuffer.h"
+#include "ReactiveQueue.h"
+#include "TimeSlicer.h"
+#include <span>
+#include <type_traits>
 #include <typeindex>
+#include <utility>
 
 // Forward declarations
 class EventBus;
@@ -17,8 +24,13 @@ namespace ECS {
 // 
 // New Features:
 // - System phases for execution order control
-// - Parallelization support flag
-// - Component event callbacks
+// - Declared component read/write access for parallel scheduling
+// - Deferred structural changes through per-thread command buffers
+// - Change detection: GetLastRunTick() feeds Changed<T>/Added<T> view filters
+// - Reactive queues: structural changes to watched component types are delivered
+//   to the component callbacks in one batch before each Update()
+// - Time slicing: with a SystemBudget, EachSliced() processes a rotating slice of
+//   the entity set per update and reports how stale the entities get
 // - Cached component arrays for performance
 // ==================================================================================
 class System {
@@ -26,7 +38,11 @@ public:
     explicit System(ComponentManager& componentManager) 
         : m_componentManager(componentManager) {}
     
-    virtual ~System() = default;
+    virtual ~System() {
+        if (m_watchingComponents) {
+            m_componentManager.UnregisterReactiveQueue(&m_reactiveQueue);
+        }
+    }
 
     // Lifecycle methods
     virtual void Init() {}
@@ -35,21 +51,125 @@ public:
     
     // System scheduling
     virtual SystemPhase GetPhase() const { return SystemPhase::Update; }
-    virtual bool CanParallelize() const { return false; }  // Override to true if thread-safe
+    virtual SystemAccess GetAccess() const { return {}; }  // Undeclared = exclusive (see SystemAccess)
+    
+    // Display name (debug UI)
+    virtual const char* GetName() const { return "System"; }
+    
+    // Time slicing budget for EachSliced() (unlimited by default) and the resulting
+    // coverage/latency, as of the last update
+    void SetBudget(const SystemBudget& budget) { m_timeSlicer.SetBudget(budget); }
+    const SystemBudget& GetBudget() const { return m_timeSlicer.GetBudget(); }
+    const TimeSliceStats& GetTimeSliceStats() const { return m_timeSlicer.GetStats(); }
     
-    // Component event callbacks (optional)
+    // Changes the reactive queue keeps between updates before it overflows
+    void SetReactiveQueueCapacity(size_t capacity) { m_reactiveQueue.SetCapacity(capacity); }
+    
+    // Component callbacks (optional): called for the component types passed to
+    // WatchComponents(), from the reactive queue drained before each Update()
     virtual void OnComponentAdded(Entity entity, std::type_index componentType) {}
     virtual void OnComponentRemoved(Entity entity, std::type_index componentType) {}
     virtual void OnEntityDestroyed(Entity entity) {}
+    virtual void OnEntityEnabledChanged(Entity entity, bool enabled) {}
+    // The reactive queue overflowed while the system was not updated (see
+    // ReactiveQueue): the changes since the last drain are lost, rebuild whatever is
+    // derived from the watched components from the current world
+    virtual void OnReactiveQueueOverflow() {}
     
     // Event bus integration
     void SetEventBus(EventBus* eventBus) {
         m_eventBus = eventBus;
     }
+    
+    // Command buffers (set by SystemManager)
+    void SetCommandBuffers(CommandBuffers* commandBuffers) {
+        m_commandBuffers = commandBuffers;
+    }
+    
+    // Called by SystemManager: drains the reactive queue, then Update() with change
+    // ticks advanced around it
+    void RunUpdate(float deltaTime) {
+        uint32_t tick = m_componentManager.AdvanceChangeTick();
+        DrainReactiveQueue();
+        Update(deltaTime);
+        m_lastRunTick = tick;
+    }
 
 protected:
+    // Command buffer of the calling thread; recorded changes are applied at the end
+    // of the current phase. Use it instead of structural ComponentManager calls
+    // inside Update().
+    CommandBuffer& Commands() {
+        if (!m_commandBuffers) {
+            throw std::runtime_error("System has no command buffers (not registered with a SystemManager)");
+        }
+        return m_commandBuffers->Local();
+    }
+    
+    // Change tick of this system's previous run (0 before the first run).
+    // View<..., Changed<T>>(m_componentManager, GetLastRunTick()) visits what changed since.
+    uint32_t GetLastRunTick() const { return m_lastRunTick; }
+    
+    // Queue structural changes to these component types for this system (call from
+    // the constructor or Init()). RunUpdate() drains the queue before Update(),
+    // calling OnComponentAdded/OnComponentRemoved for each change, and
+    // OnEntityDestroyed/OnEntityEnabledChanged for entities with a watched
+    // component, in the order the changes were made. Changes that happen while the
+    // system is not updated accumulate up to the queue's capacity; past it they are
+    // dropped and OnReactiveQueueOverflow() is called instead.
+    template<typename... Components>
+    void WatchComponents() {
+        m_reactiveQueue.Watch<Components...>();
+        if (!m_watchingComponents) {
+            m_componentManager.RegisterReactiveQueue(&m_reactiveQueue);
+            m_watchingComponents = true;
+        }
+    }
+    
+    // Deliver the queued changes now (RunUpdate() does this before Update())
+    void DrainReactiveQueue() {
+        bool complete = m_reactiveQueue.Drain([this](std::span<const ReactiveChange> changes) {
+            for (const ReactiveChange& change : changes) {
+                switch (change.kind) {
+                case ReactiveChange::Kind::ComponentAdded:   OnComponentAdded(change.entity, change.componentType); break;
+                case ReactiveChange::Kind::ComponentRemoved: OnComponentRemoved(change.entity, change.componentType); break;
+                case ReactiveChange::Kind::EntityDestroyed:  OnEntityDestroyed(change.entity); break;
+                case ReactiveChange::Kind::EntityEnabled:    OnEntityEnabledChanged(change.entity, true); break;
+                case ReactiveChange::Kind::EntityDisabled:   OnEntityEnabledChanged(change.entity, false); break;
+                }
+            }
+        });
+        if (!complete) {
+            OnReactiveQueueOverflow();
+        }
+    }
+    
+    // Forget the queued changes (after rebuilding state from the current world)
+    void ClearReactiveQueue() { m_reactiveQueue.Clear(); }
+    
+    // Process the next slice of the entities with a T, within this system's budget:
+    // fn(Entity, T&, float elapsed), 'elapsed' being the seconds since that entity was
+    // last processed (use it instead of deltaTime). Call once per Update().
+    // EachSliced<const T> passes const T& and marks nothing as changed.
+    template<typename T, typename Func>
+    void EachSliced(float deltaTime, Func&& fn) {
+        auto array = m_componentManager.GetComponentArray<std::remove_const_t<T>>();
+        if constexpr (std::is_const_v<T>) {
+            m_timeSlicer.Each(m_componentManager, std::as_const(*array), deltaTime, std::forward<Func>(fn));
+        } else {
+            m_timeSlicer.Each(m_componentManager, *array, deltaTime, std::forward<Func>(fn));
+        }
+    }
+
     ComponentManager& m_componentManager;
     EventBus* m_eventBus = nullptr;
+    CommandBuffers* m_commandBuffers = nullptr;
+    uint32_t m_lastRunTick = 0;
+
+private:
+    ReactiveQueue m_reactiveQueue;
+    bool m_watchingComponents = false;
+    TimeSlicer m_timeSlicer;
 };
 
 } // namespace ECS
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <typeindex>
+#include <vector>
+
+namespace ECS {
+
+// ==================================================================================
+// SystemAccess
+// ----------------------------------------------------------------------------------
+// The set of component types a system reads and writes during Update().
+// SystemManager uses it to decide which systems of a phase may run concurrently:
+// two systems conflict when one writes a component type the other reads or writes.
+//
+// A system that does not declare its access is treated as exclusive: it conflicts
+// with every other system and always runs on the calling thread. Systems that make
+// structural changes (create/destroy entities, add/remove components) must either
+// record them through System::Commands() or stay exclusive.
+//
+// Example Usage:
+//     SystemAccess GetAccess() const override {
+//         return Access<Read<ColliderComponent>, Write<TransformComponent>>::Get();
+//     }
+// ==================================================================================
+struct SystemAccess {
+    std::vector<std::type_index> reads;
+    std::vector<std::type_index> writes;
+    bool declared = false;
+
+    bool Reads(std::type_index type) const {
+        return std::find(reads.begin(), reads.end(), type) != reads.end();
+    }
+
+    bool Writes(std::type_index type) const {
+        return std::find(writes.begin(), writes.end(), type) != writes.end();
+    }
+
+    bool ConflictsWith(const SystemAccess& other) const {
+        if (!declared || !other.declared) {
+            return true;
+        }
+
+        for (const auto& type : writes) {
+            if (other.Reads(type) || other.Writes(type)) return true;
+        }
+        for (const auto& type : other.writes) {
+            if (Reads(type)) return true;
+        }
+        return false;
+    }
+};
+
+// Access tags
+template<typename T> struct Read {};
+template<typename T> struct Write {};
+
+namespace Detail {
+
+template<typename Tag>
+struct AccessEntry;
+
+template<typename T>
+struct AccessEntry<Read<T>> {
+    static void Add(SystemAccess& access) { access.reads.emplace_back(typeid(T)); }
+};
+
+template<typename T>
+struct AccessEntry<Write<T>> {
+    static void Add(SystemAccess& access) { access.writes.emplace_back(typeid(T)); }
+};
+
+} // namespace Detail
+
+// Compile-time access declaration: Access<Read<A>, Write<B>, ...>::Get()
+template<typename... Entries>
+struct Access {
+    static SystemAccess Get() {
+        SystemAccess access;
+        access.declared = true;
+        (Detail::AccessEntry<Entries>::Add(access), ...);
+        return access;
+    }
+};
+
+} // namespace ECS
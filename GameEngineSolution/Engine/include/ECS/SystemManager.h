@@ -2,11 +2,13 @@
 
 #include "System.h"
 #include "SystemPhase.h"
+#include "SystemAccess.h"
+#include "CommandBuffer.h"
+#include "../Jobs/JobSystem.h"
 #include <vector>
 #include <memory>
 #include <algorithm>
-#include <thread>
-#include <future>
+#include <atomic>
 
 namespace ECS {
 
@@ -14,89 +16,99 @@ namespace ECS {
 // SystemManager
 // ----------------------------------------------------------------------------------
 // Manages the lifecycle and execution of all ECS systems.
-// 
+//
 // Features:
 // - Phase-based execution ordering
-// - Parallel execution of thread-safe systems
+// - Dependency-graph scheduling from declared component access (see SystemAccess):
+//   within a phase, systems whose accesses don't conflict run concurrently on the
+//   persistent JobSystem; conflicting systems keep their registration order
+// - Undeclared (exclusive) systems run alone on the calling thread
+// - Per-thread command buffers played back at the end of every phase, so structural
+//   changes never happen while systems iterate
+// - Time-sliced systems: a system's SystemBudget caps the entities it processes
+//   per update (System::EachSliced); staleness stats per system
+// - Simulation phases (PreUpdate..PostUpdate) and the presentation phase (PreRender)
+//   can run at different rates, for fixed-step loops (see FixedTimestep)
 // - System registration and retrieval
 // - Automatic initialization and shutdown
 // ==================================================================================
 class SystemManager {
 public:
-    SystemManager() = default;
-    
+    SystemManager()
+        : m_jobSystem(&Jobs::JobSystem::Get())
+        , m_commandBuffers(std::make_unique<CommandBuffers>(*m_jobSystem))
+    {
+    }
+
     ~SystemManager() {
         Shutdown();
     }
 
-    // Register a new system
     // Register a new system
     template<typename T, typename... Args>
     T* AddSystem(ComponentManager& componentManager, Args&&... args) {
         auto system = std::make_unique<T>(componentManager, std::forward<Args>(args)...);
         T* systemPtr = system.get();
-        
+
         // Set event bus if available (BEFORE Init so system can subscribe)
         if (m_eventBus) {
             systemPtr->SetEventBus(m_eventBus);
         }
-        
+        systemPtr->SetCommandBuffers(m_commandBuffers.get());
+        m_componentManager = &componentManager;
+
         m_systems.push_back(std::move(system));
+        m_needsSort = true;
         systemPtr->Init();
         return systemPtr;
     }
 
-    // Update all systems in phase order
+    // Update all systems in phase order (one variable-length step per frame)
     void Update(float deltaTime) {
-        // Sort systems by phase if needed
-        if (m_needsSort) {
-            SortSystemsByPhase();
-            m_needsSort = false;
-        }
-        
-        // Execute each phase in order
-        for (int phaseInt = static_cast<int>(SystemPhase::PreUpdate); 
-             phaseInt <= static_cast<int>(SystemPhase::PreRender); 
+        UpdateSimulation(deltaTime);
+        UpdatePresentation(deltaTime);
+    }
+
+    // One simulation tick: PreUpdate, Update and PostUpdate. Fixed-step loops call
+    // this zero or more times per frame (see FixedTimestep), then UpdatePresentation once.
+    void UpdateSimulation(float deltaTime) {
+        for (int phaseInt = static_cast<int>(SystemPhase::PreUpdate);
+             phaseInt <= static_cast<int>(SystemPhase::PostUpdate);
              ++phaseInt) {
-            
-            SystemPhase phase = static_cast<SystemPhase>(phaseInt);
-            UpdatePhase(phase, deltaTime);
+            UpdatePhase(static_cast<SystemPhase>(phaseInt), deltaTime);
         }
     }
-    
+
+    // Once per rendered frame: PreRender (camera, render caches), with the frame's
+    // real duration
+    void UpdatePresentation(float deltaTime) {
+        UpdatePhase(SystemPhase::PreRender, deltaTime);
+    }
+
     // Update a specific phase
     void UpdatePhase(SystemPhase phase, float deltaTime) {
-        // Collect systems for this phase
-        std::vector<System*> parallelSystems;
-        std::vector<System*> sequentialSystems;
-        
-        for (auto& system : m_systems) {
-            if (system->GetPhase() == phase) {
-                if (system->CanParallelize()) {
-                    parallelSystems.push_back(system.get());
-                } else {
-                    sequentialSystems.push_back(system.get());
-                }
-            }
+        if (m_needsSort) {
+            SortSystemsByPhase();
+            BuildSchedules();
+            m_needsSort = false;
         }
-        
-        // Execute parallel systems concurrently
-        if (!parallelSystems.empty()) {
-            std::vector<std::future<void>> futures;
-            for (auto* system : parallelSystems) {
-                futures.push_back(std::async(std::launch::async, [system, deltaTime]() {
-                    system->Update(deltaTime);
-                }));
-            }
-            // Wait for all parallel systems to complete
-            for (auto& future : futures) {
-                future.wait();
+
+        for (auto& segment : m_schedules[static_cast<size_t>(phase)]) {
+            if (segment.exclusive) {
+                segment.exclusive->RunUpdate(deltaTime);
+            } else {
+                RunGraph(segment, deltaTime);
             }
         }
-        
-        // Execute sequential systems
-        for (auto* system : sequentialSystems) {
-            system->Update(deltaTime);
+
+        // Phase boundary: apply structural changes recorded by this phase's systems
+        PlaybackCommands();
+    }
+
+    // Apply all recorded command buffers now (also done at the end of every phase)
+    void PlaybackCommands() {
+        if (m_componentManager) {
+            m_commandBuffers->Playback(*m_componentManager);
         }
     }
 
@@ -110,7 +122,18 @@ public:
         }
         return nullptr;
     }
-    
+
+    // Visit every system with a limited budget (see System::SetBudget), e.g. to
+    // display their coverage and latency
+    template<typename Func>
+    void ForEachTimeSlicedSystem(Func&& fn) const {
+        for (const auto& system : m_systems) {
+            if (system->GetBudget().IsLimited()) {
+                fn(static_cast<const System&>(*system));
+            }
+        }
+    }
+
     // Set event bus for all systems
     void SetEventBus(EventBus* eventBus) {
         m_eventBus = eventBus;
@@ -118,27 +141,144 @@ public:
             system->SetEventBus(eventBus);
         }
     }
-    
+
+    // Job system used for concurrent systems (nullptr = run everything on the calling thread).
+    // Call between frames: pending commands are played back before the buffers are replaced.
+    void SetJobSystem(Jobs::JobSystem* jobSystem) {
+        PlaybackCommands();
+
+        m_jobSystem = jobSystem;
+        m_commandBuffers = std::make_unique<CommandBuffers>(jobSystem ? *jobSystem : Jobs::JobSystem::Get());
+        for (auto& system : m_systems) {
+            system->SetCommandBuffers(m_commandBuffers.get());
+        }
+    }
+
     // Shutdown all systems
     void Shutdown() {
         for (auto& system : m_systems) {
             system->Shutdown();
         }
         m_systems.clear();
+        for (auto& schedule : m_schedules) {
+            schedule.clear();
+        }
     }
 
 private:
+    static constexpr size_t PHASE_COUNT = static_cast<size_t>(SystemPhase::Render) + 1;
+
+    // A run of systems inside one phase: either one exclusive system, or a
+    // dependency graph of systems with declared access
+    struct Segment {
+        System* exclusive = nullptr;
+        std::vector<System*> systems;
+        std::vector<std::vector<size_t>> dependents;  // Edges: node -> nodes that must wait for it
+        std::vector<uint32_t> dependencyCounts;       // Incoming edge count per node
+    };
+
+    // Per-frame execution state of a Segment graph
+    struct GraphRun {
+        const Segment* segment = nullptr;
+        std::unique_ptr<std::atomic<uint32_t>[]> remaining;
+        Jobs::JobCounter counter;
+        float deltaTime = 0.0f;
+    };
+
     void SortSystemsByPhase() {
-        std::sort(m_systems.begin(), m_systems.end(),
+        // Stable so registration order decides the order of conflicting systems
+        std::stable_sort(m_systems.begin(), m_systems.end(),
             [](const std::unique_ptr<System>& a, const std::unique_ptr<System>& b) {
                 return static_cast<int>(a->GetPhase()) < static_cast<int>(b->GetPhase());
             });
     }
 
+    void BuildSchedules() {
+        for (auto& schedule : m_schedules) {
+            schedule.clear();
+        }
+
+        std::vector<SystemAccess> accesses;
+        for (auto& system : m_systems) {
+            auto& schedule = m_schedules[static_cast<size_t>(system->GetPhase())];
+            SystemAccess access = system->GetAccess();
+
+            if (!access.declared) {
+                Segment segment;
+                segment.exclusive = system.get();
+                schedule.push_back(std::move(segment));
+                continue;
+            }
+
+            if (schedule.empty() || schedule.back().exclusive) {
+                schedule.push_back(Segment{});
+                accesses.clear();
+            }
+
+            // Add node and an edge from every earlier conflicting node
+            Segment& segment = schedule.back();
+            size_t node = segment.systems.size();
+            segment.systems.push_back(system.get());
+            segment.dependents.emplace_back();
+            segment.dependencyCounts.push_back(0);
+
+            for (size_t earlier = 0; earlier < node; ++earlier) {
+                if (accesses[earlier].ConflictsWith(access)) {
+                    segment.dependents[earlier].push_back(node);
+                    segment.dependencyCounts[node]++;
+                }
+            }
+            accesses.push_back(std::move(access));
+        }
+    }
+
+    void RunGraph(const Segment& segment, float deltaTime) {
+        // Nothing to overlap with: skip scheduling overhead
+        if (!m_jobSystem || segment.systems.size() == 1) {
+            for (System* system : segment.systems) {
+                system->RunUpdate(deltaTime);
+            }
+            return;
+        }
+
+        GraphRun run;
+        run.segment = &segment;
+        run.deltaTime = deltaTime;
+        run.remaining = std::make_unique<std::atomic<uint32_t>[]>(segment.systems.size());
+        for (size_t i = 0; i < segment.systems.size(); ++i) {
+            run.remaining[i].store(segment.dependencyCounts[i], std::memory_order_relaxed);
+        }
+
+        for (size_t i = 0; i < segment.systems.size(); ++i) {
+            if (segment.dependencyCounts[i] == 0) {
+                ScheduleNode(run, i);
+            }
+        }
+
+        m_jobSystem->Wait(run.counter);
+    }
+
+    void ScheduleNode(GraphRun& run, size_t node) {
+        m_jobSystem->Run([this, &run, node]() {
+            run.segment->systems[node]->RunUpdate(run.deltaTime);
+
+            // Release dependents whose last dependency just finished.
+            // Scheduled before this job's counter decrement, so Wait() can't return early.
+            for (size_t dependent : run.segment->dependents[node]) {
+                if (run.remaining[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    ScheduleNode(run, dependent);
+                }
+            }
+        }, run.counter);
+    }
+
     std::vector<std::unique_ptr<System>> m_systems;
+    std::vector<Segment> m_schedules[PHASE_COUNT];
     EventBus* m_eventBus = nullptr;
+    Jobs::JobSystem* m_jobSystem;
+    std::unique_ptr<CommandBuffers> m_commandBuffers;
+    ComponentManager* m_componentManager = nullptr;
     bool m_needsSort = true;
 };
 
 } // namespace ECS
-
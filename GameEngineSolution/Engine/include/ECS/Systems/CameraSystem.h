@@ -11,7 +11,10 @@ namespace ECS {
 // ==================================================================================
 // CameraSystem
 // ----------------------------------------------------------------------------------
-// Updates camera view and projection matrices
+// Updates camera view and projection matrices once per rendered frame. The eye
+// follows the entity's interpolated position between simulation ticks (see
+// SetInterpolationAlpha), so the view moves smoothly at any frame rate.
+// ==================================================================================
 class CameraSystem : public System {
 public:
     explicit CameraSystem(ComponentManager& cm) : System(cm) {}
@@ -21,7 +24,12 @@ public:
     
     // System phase
     SystemPhase GetPhase() const override { return SystemPhase::PreRender; }
-    bool CanParallelize() const override { return true; } // Read-only operations
+    SystemAccess GetAccess() const override {
+        return Access<Write<CameraComponent>, Read<TransformComponent>, Read<WorldMatrixComponent>, Read<PlayerControllerComponent>>::Get();
+    }
+
+    // Position of the frame between the last two simulation ticks (FixedTimestep::GetAlpha)
+    void SetInterpolationAlpha(float alpha) { m_interpolationAlpha = alpha; }
     
     // Get active camera's matrices  (returns false if no active camera)
     bool GetActiveCamera(DirectX::XMMATRIX& viewOut, DirectX::XMMATRIX& projOut);
@@ -33,6 +41,8 @@ private:
     // Cached component arrays
     std::shared_ptr<ComponentArray<CameraComponent>> m_cameraArray;
     std::shared_ptr<ComponentArray<TransformComponent>> m_transformArray;
+
+    float m_interpolationAlpha = 1.0f;
 };
 
 }
@@ -10,8 +10,10 @@ public:
     explicit MovementSystem(ComponentManager& cm) : System(cm) {}
     void Update(float deltaTime) override;
     
-    // Enable parallel execution
-    bool CanParallelize() const override { return true; }
+    // Rotate/Orbit -> Transform, safe alongside systems that don't touch transforms
+    SystemAccess GetAccess() const override {
+        return Access<Read<RotateComponent>, Write<OrbitComponent>, Write<TransformComponent>>::Get();
+    }
 };
 
 } // namespace ECS
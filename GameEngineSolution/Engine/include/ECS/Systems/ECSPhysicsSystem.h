@@ -14,10 +14,14 @@ namespace ECS {
 // Handles physics simulation for entities with PhysicsComponent + TransformComponent
 // 
 // Improvements:
-// - Spatial grid for O(n·k) collision detection
+// - Spatial grid for O(n·k) collision detection, updated incrementally from
+//   change ticks (only moved/resized colliders are re-inserted)
+// - Force/velocity integration split across the JobSystem (ParallelFor)
+// - Owns the Physics+Transform group: both dense arrays are kept in matching order,
+//   so bodies are walked in lockstep without sparse lookups
 // - Cached component arrays for performance
 // - PostUpdate phase for physics integration
-// - Can run in parallel (thread-safe reads, careful writes)
+// - Declares its component access so it can run alongside non-conflicting systems
 // ==================================================================================
 class PhysicsSystem : public System {
 public:
@@ -27,9 +31,17 @@ public:
     void Init() override;
     void Update(float deltaTime) override;
     
+    // Reactive queue callbacks (grid removals)
+    void OnComponentRemoved(Entity entity, std::type_index componentType) override;
+    void OnEntityDestroyed(Entity entity) override;
+    void OnEntityEnabledChanged(Entity entity, bool enabled) override;
+    void OnReactiveQueueOverflow() override;
+    
     // Phase and parallelization
     SystemPhase GetPhase() const override { return SystemPhase::PostUpdate; }
-    bool CanParallelize() const override { return false; } // Writes to transforms
+    SystemAccess GetAccess() const override {
+        return Access<Write<PhysicsComponent>, Write<TransformComponent>, Read<ColliderComponent>>::Get();
+    }
     
     // Expose spatial grid for other systems
     const Physics::SpatialGrid& GetSpatialGrid() const { return m_spatialGrid; }
@@ -42,7 +54,8 @@ private:
     void IntegrateVelocity(TransformComponent& transform, PhysicsComponent& physics, float dt);
     
     // Collision detection
-    void RebuildSpatialGrid();
+    void UpdateSpatialGrid();
+    void InsertIntoSpatialGrid(Entity entity, const ColliderComponent& collider, const TransformComponent& transform);
     void CheckGroundCollision(Entity entity, TransformComponent& transform, PhysicsComponent& physics);
     
     // Cached component arrays
@@ -56,6 +69,9 @@ private:
     // Physics constants
     static constexpr float MIN_DELTA_TIME = 0.0001f;
     static constexpr float MAX_DELTA_TIME = 0.1f;
+    
+    // Entities per integration job
+    static constexpr size_t INTEGRATION_GRAIN_SIZE = 256;
 };
 
 } // namespace ECS
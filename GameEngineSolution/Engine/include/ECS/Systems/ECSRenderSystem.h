@@ -4,6 +4,7 @@
 #include "../System.h"
 #include "../../Renderer/Renderer.h"
 #include "../../Renderer/Camera.h"
+#include <memory>
 
 namespace ECS {
 
@@ -11,10 +12,23 @@ namespace ECS {
 // RenderSystem
 // Handles rendering for entities with
 // RenderComponent + TransformComponent
+// Instances use the cached world matrix
+// from TransformSystem (PreRender phase)
+// The cache mirrors the shared
+// RenderComponent buckets: one batch per
+// mesh/material value, handed to the
+// renderer without sorting
+// Structural changes arrive through the
+// reactive queue, drained before Update
+// Moving entities are drawn between their
+// previous and current tick matrices
+// (see SetInterpolationAlpha)
 // ========================================
 class RenderSystem : public System {
 public:
-    explicit RenderSystem(ComponentManager& cm) : System(cm) {}
+    explicit RenderSystem(ComponentManager& cm)
+        : System(cm)
+        , m_renderValues(cm.GetSharedComponentArray<RenderComponent>()) {}
     
     // Render all renderable entities
     void Render(Renderer* renderer, Camera& camera, const struct DirectionalLight& dirLight);
@@ -24,37 +38,65 @@ public:
     
     // Lifecycle
     void Init() override;
-    void Shutdown() override;
     
     // Update cache (called by SystemManager)
     void Update(float deltaTime) override;
+    SystemPhase GetPhase() const override { return SystemPhase::PreRender; }
+    SystemAccess GetAccess() const override {
+        return Access<Read<TransformComponent>, Read<WorldMatrixComponent>, Read<RenderComponent>, Read<ColliderComponent>>::Get();
+    }
     
-    // Event handlers
-    void OnComponentAdded(Entity entity);
-    void OnComponentRemoved(Entity entity);
+    // Reactive queue callbacks (update only the affected cache entry)
+    void OnComponentAdded(Entity entity, std::type_index componentType) override;
+    void OnComponentRemoved(Entity entity, std::type_index componentType) override;
+    void OnEntityDestroyed(Entity entity) override;
+    void OnEntityEnabledChanged(Entity entity, bool enabled) override;
+    void OnReactiveQueueOverflow() override;
     
     // Force cache rebuild (useful after scene load)
     void RebuildRenderCache();
 
+    // Position of the frame between the last two simulation ticks (FixedTimestep::GetAlpha);
+    // 1 draws the latest tick as is. Set before the PreRender phase.
+    void SetInterpolationAlpha(float alpha) { m_interpolationAlpha = alpha; }
+    float GetInterpolationAlpha() const { return m_interpolationAlpha; }
+
 private:
-    void UpdateRenderCache();
-    void CreateRenderCacheEntry(Entity entity, const TransformComponent* transform, const RenderComponent* render);
-    void RemoveRenderCacheEntry(size_t index);
-    void RefreshRenderCacheEntry(size_t index, const TransformComponent* transform, const RenderComponent* render);
-    bool TryComputeWorldBounds(Entity entity, const TransformComponent* transform, Renderer::RenderInstance& instance);
+    // Entry 'index' of batch 'batch'
+    struct CacheLocation
+    {
+        uint32_t batch = 0;
+        uint32_t index = 0;
+    };
 
-    struct RenderCacheEntry
+    // Instances of the entities whose RenderComponent has shared value index 'batch'
+    // (parallel arrays; the instances are passed to the renderer as they are)
+    struct RenderBatchCache
     {
-        Entity entity = NULL_ENTITY;
-        Renderer::RenderInstance instance{};
-        DirectX::XMFLOAT3 lastPosition{ 0.0f,0.0f,0.0f };
-        DirectX::XMFLOAT3 lastRotation{ 0.0f,0.0f,0.0f };
-        DirectX::XMFLOAT3 lastScale{ 1.0f,1.0f,1.0f };
+        std::vector<Entity> entities;
+        std::vector<Renderer::RenderInstance> instances;
+        std::vector<uint8_t> dirty; // Queued in m_dirtyEntries this frame
     };
 
-    std::vector<RenderCacheEntry> m_renderCache;
-    std::unordered_map<Entity, size_t> m_entityToRenderCacheIndex;
-    std::vector<int> m_eventSubscriptions; // Using int for SubscriptionId (it's a typedef)
+    void UpdateRenderCache();
+    void UpdateCacheEntry(Entity entity); // Add, refresh or move the entity's entry
+    void RemoveCacheEntry(Entity entity);
+    void CreateRenderCacheEntry(Entity entity, uint32_t batch, const TransformComponent& transform, const RenderComponent& render);
+    void RemoveRenderCacheEntry(CacheLocation location);
+    void RefreshRenderCacheEntry(CacheLocation location, const TransformComponent& transform, const RenderComponent& render);
+    bool TryComputeWorldBounds(Entity entity, const RenderComponent& render, Renderer::RenderInstance& instance);
+
+    // Cache entries per refresh job
+    static constexpr size_t CACHE_UPDATE_GRAIN_SIZE = 128;
+
+    std::shared_ptr<SharedComponentArray<RenderComponent>> m_renderValues;
+    std::vector<RenderBatchCache> m_batches; // Indexed by RenderComponent value index
+    std::unordered_map<Entity, CacheLocation> m_entityToCacheLocation;
+    std::vector<CacheLocation> m_dirtyEntries;            // Reused every frame
+    std::vector<Entity> m_interpolating;                  // Cached entities whose previous != world
+    std::vector<Entity> m_nextInterpolating;              // Reused every frame
+    float m_interpolationAlpha = 1.0f;
+    std::vector<Renderer::RenderBatch> m_frameBatches;    // Reused every frame
 };
 
 } // namespace ECS
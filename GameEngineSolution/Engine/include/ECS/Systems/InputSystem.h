@@ -15,7 +15,7 @@ public:
     void Update(float deltaTime) override;
 
     SystemPhase GetPhase() const override { return SystemPhase::PreUpdate; }
-    bool CanParallelize() const override { return false; } // Reads hardware input (not thread safe usually)
+    // No access declaration: reads hardware input, so it stays exclusive on the main thread
 
 private:
     Input& m_input;
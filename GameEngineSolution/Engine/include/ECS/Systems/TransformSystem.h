@@ -0,0 +1,123 @@
+#pragma once
+
+#include "../ComponentManager.h"
+#include "../System.h"
+#include "../SystemPhase.h"
+#include <DirectXMath.h>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ECS {
+
+// ==================================================================================
+// TransformSystem
+// ----------------------------------------------------------------------------------
+// Resolves TransformComponent (+ optional ParentComponent) into a cached
+// WorldMatrixComponent once per simulation tick, after physics has moved things.
+//
+// - Entities are kept in a flat array sorted by hierarchy depth (roots first), so a
+//   parent's world matrix is always computed before its children read it.
+// - Only dirty subtrees are recomputed: entities whose transform changed since the
+//   last run, plus everything below them (one linear pass over the sorted array).
+// - Each depth level is composed in parallel batches with DirectXMath (SIMD).
+// - The hierarchy is re-sorted only when parent links change or transforms are
+//   removed; transforms added without a parent are appended as roots.
+//
+// Each recomputed matrix keeps the one it replaces in WorldMatrixComponent::previous;
+// one run after an entity stops moving, previous catches up with world. Renderers
+// interpolate between the two when the simulation runs at a fixed tick rate.
+// New nodes and re-enabled entities (pooled, respawned) start with previous equal
+// to world, so they are not blended in from wherever they were parked.
+//
+// Entities with a TransformComponent but no WorldMatrixComponent get one added
+// through the command buffer; it is available from the next phase on.
+// Consumers should use GetWorldMatrix() instead of composing TRS themselves.
+// ==================================================================================
+class TransformSystem : public System {
+public:
+    explicit TransformSystem(ComponentManager& cm) : System(cm) {}
+
+    // Lifecycle
+    void Init() override;
+    void Update(float deltaTime) override;
+
+    // Reactive queue callbacks (flag the hierarchy for re-sorting)
+    void OnComponentAdded(Entity entity, std::type_index componentType) override;
+    void OnComponentRemoved(Entity entity, std::type_index componentType) override;
+    void OnEntityDestroyed(Entity entity) override;
+    void OnEntityEnabledChanged(Entity entity, bool enabled) override;
+    void OnReactiveQueueOverflow() override;
+
+    // Runs after physics integration; renderers read the result in PreRender
+    SystemPhase GetPhase() const override { return SystemPhase::PostUpdate; }
+    SystemAccess GetAccess() const override {
+        return Access<Read<TransformComponent>, Read<ParentComponent>, Write<WorldMatrixComponent>>::Get();
+    }
+
+    // Local matrix: Scale * Rotation (Euler) * Translation
+    static DirectX::XMMATRIX ComposeLocalMatrix(const TransformComponent& transform);
+
+    // Cached world matrix if the entity has one, otherwise its local matrix
+    static DirectX::XMMATRIX GetWorldMatrix(const ComponentManager& componentManager, Entity entity,
+                                            const TransformComponent& transform);
+
+    // World-space AABB of 'localBounds' under GetWorldMatrix() (parents and rotation included)
+    static AABB GetWorldBounds(const ComponentManager& componentManager, Entity entity,
+                               const TransformComponent& transform, const AABB& localBounds);
+
+    // World matrix 'alpha' of the way from previous to world: scale and translation
+    // are lerped, rotation is slerped. alpha >= 1 (or a resting entity) returns world.
+    static DirectX::XMMATRIX InterpolateWorldMatrix(const WorldMatrixComponent& matrices, float alpha);
+
+    // The next run starts 'entity' at its new matrix instead of blending from the old
+    // one (teleports, respawns of entities that stay enabled). Thread-safe.
+    void Teleport(Entity entity);
+
+    // Debug statistics (last Update)
+    size_t GetNodeCount() const { return m_nodes.size(); }
+    size_t GetHierarchyDepth() const { return m_levelOffsets.empty() ? 0 : m_levelOffsets.size() - 1; }
+    size_t GetLastUpdatedCount() const { return m_lastUpdatedCount; }
+
+private:
+    static constexpr uint32_t NO_PARENT = 0xFFFFFFFF;
+
+    struct HierarchyNode
+    {
+        Entity entity = NULL_ENTITY;
+        uint32_t parent = NO_PARENT; // Index into m_nodes (always lower than this node's index)
+    };
+
+    void RebuildHierarchy();
+    void AddNode(Entity entity);
+    void MarkChangedTransforms();
+    void PropagateDirtyFlags();
+    void ComposeLevel(size_t begin, size_t end);
+    void SettleStoppedNodes();
+
+    // Depth-sorted nodes; level d occupies [m_levelOffsets[d], m_levelOffsets[d + 1])
+    std::vector<HierarchyNode> m_nodes;
+    std::vector<size_t> m_levelOffsets;
+    std::vector<DirectX::XMFLOAT4X4> m_worldMatrices; // Parallel to m_nodes
+    std::vector<uint8_t> m_dirty;                     // Parallel to m_nodes
+    std::vector<uint8_t> m_moved;                     // Dirty flags of the previous run
+    std::vector<uint8_t> m_snap;                      // Parallel to m_nodes: previous = world this run
+    std::vector<Entity> m_snapRequests;               // Re-enabled/teleported entities, applied in Update()
+    std::mutex m_snapMutex;
+    std::unordered_map<Entity, uint32_t> m_nodeIndex;
+    std::unordered_set<Entity> m_danglingParents; // Referenced as parent but without a transform
+    bool m_hierarchyDirty = true;
+    size_t m_lastUpdatedCount = 0;
+
+    // Cached component arrays
+    std::shared_ptr<ComponentArray<TransformComponent>> m_transformArray;
+    std::shared_ptr<ComponentArray<WorldMatrixComponent>> m_worldArray;
+
+    // Nodes per composition job
+    static constexpr size_t COMPOSE_GRAIN_SIZE = 256;
+};
+
+} // namespace ECS
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "ComponentManager.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace ECS {
+
+// ==================================================================================
+// SystemBudget
+// ----------------------------------------------------------------------------------
+// How much of its entity set a time-sliced system processes per update: at most
+// maxEntities entities and/or maxMicroseconds of work. Zero means no limit; the
+// default (both zero) processes every entity every update.
+// ==================================================================================
+struct SystemBudget {
+    uint32_t maxEntities = 0;
+    float maxMicroseconds = 0.0f;
+
+    static SystemBudget Entities(uint32_t count) { return { count, 0.0f }; }
+    static SystemBudget Microseconds(float microseconds) { return { 0, microseconds }; }
+
+    bool IsLimited() const { return maxEntities > 0 || maxMicroseconds > 0.0f; }
+};
+
+// Staleness of a time-sliced entity set, as of the last update
+struct TimeSliceStats {
+    size_t entityCount = 0;      // Entities in the set
+    size_t processedCount = 0;   // Entities processed by the last update
+    float averageLatency = 0.0f; // Seconds since the entities processed last were processed before
+    float maxLatency = 0.0f;
+    uint32_t sweepFrames = 0;    // Updates the last complete pass over the set took (0: none yet)
+    float sweepSeconds = 0.0f;
+
+    // Share of the set processed per update
+    float GetCoverage() const {
+        return entityCount > 0 ? static_cast<float>(processedCount) / static_cast<float>(entityCount) : 1.0f;
+    }
+};
+
+// ==================================================================================
+// TimeSlicer
+// ----------------------------------------------------------------------------------
+// Walks a component array in rotating slices: each Each() call resumes where the
+// previous one stopped, wraps around at the end and stops when the budget is spent.
+// Every visit reports the seconds elapsed since that entity was last visited, so
+// per-second work (regeneration, decay, cooldowns) stays correct however long the
+// entity waited. The first visit of an entity counts as one update.
+//
+// Arrays reorder when components are removed, so a pass may skip or repeat an
+// entity; the elapsed time keeps the work correct either way.
+// Disabled entities are skipped and not charged to the budget.
+//
+// Example Usage (see System::EachSliced):
+//     slicer.SetBudget(SystemBudget::Entities(64));
+//     slicer.Each(componentManager, *healthArray, deltaTime,
+//         [](Entity entity, HealthComponent& health, float elapsed) { ... });
+// ==================================================================================
+class TimeSlicer {
+public:
+    void SetBudget(const SystemBudget& budget) { m_budget = budget; }
+    const SystemBudget& GetBudget() const { return m_budget; }
+    const TimeSliceStats& GetStats() const { return m_stats; }
+
+    // Process the next slice of 'array': fn(Entity, T&, float elapsedSeconds).
+    // Call once per update, always with the same array (SparseSet storage). Visited
+    // components are marked changed; fn must not make structural changes (record
+    // them in a command buffer).
+    template<typename T, typename Func>
+    void Each(const ComponentManager& componentManager, ComponentArray<T>& array, float deltaTime, Func&& fn) {
+        EachInSlice(componentManager, array, deltaTime, fn);
+    }
+
+    // Same with fn(Entity, const T&, float): nothing is marked changed, so callbacks
+    // that rarely write can write through ComponentManager::GetComponent instead
+    template<typename T, typename Func>
+    void Each(const ComponentManager& componentManager, const ComponentArray<T>& array, float deltaTime, Func&& fn) {
+        EachInSlice(componentManager, array, deltaTime, fn);
+    }
+
+private:
+    template<typename Array, typename Func>
+    void EachInSlice(const ComponentManager& componentManager, Array& array, float deltaTime, Func& fn) {
+        using Clock = std::chrono::steady_clock;
+
+        m_time += deltaTime;
+        ++m_frame;
+
+        const std::vector<Entity>& entities = array.GetEntityArray();
+        auto& components = array.GetComponentArray();
+        const size_t count = entities.size();
+
+        m_stats.entityCount = count;
+        m_stats.processedCount = 0;
+        m_stats.averageLatency = 0.0f;
+        m_stats.maxLatency = 0.0f;
+        if (count == 0) {
+            m_cursor = 0;
+            return;
+        }
+        if (m_cursor >= count) {
+            m_cursor = 0; // The set shrank past the cursor: that pass is over
+            m_sweepStarted = false;
+        }
+
+        const size_t limit = m_budget.maxEntities > 0 ? std::min<size_t>(m_budget.maxEntities, count) : count;
+        const bool timed = m_budget.maxMicroseconds > 0.0f;
+        const Clock::time_point deadline = timed
+            ? Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float, std::micro>(m_budget.maxMicroseconds))
+            : Clock::time_point{};
+
+        double latencySum = 0.0;
+        for (size_t step = 0; step < count && m_stats.processedCount < limit; ++step) {
+            const size_t index = m_cursor;
+            if (++m_cursor == count) {
+                m_cursor = 0;
+            }
+
+            const Entity entity = entities[index];
+            if (componentManager.IsEntityEnabled(entity)) {
+                if (!m_sweepStarted) {
+                    m_sweepStarted = true;
+                    m_sweepStartFrame = m_frame;
+                    m_sweepStartTime = m_time - deltaTime;
+                }
+
+                const float elapsed = RecordVisit(entity, deltaTime);
+                latencySum += elapsed;
+                m_stats.maxLatency = std::max(m_stats.maxLatency, elapsed);
+                ++m_stats.processedCount;
+
+                if constexpr (!std::is_const_v<Array>) {
+                    array.MarkChangedAtIndex(index);
+                }
+                fn(entity, components[index], elapsed);
+            }
+
+            if (m_cursor == 0 && m_sweepStarted) {
+                m_stats.sweepFrames = static_cast<uint32_t>(m_frame - m_sweepStartFrame + 1);
+                m_stats.sweepSeconds = static_cast<float>(m_time - m_sweepStartTime);
+                m_sweepStarted = false;
+            }
+
+            // Reading the clock costs more than most per-entity work: check it in steps
+            if (timed && (step + 1) % TIME_CHECK_INTERVAL == 0 && Clock::now() >= deadline) {
+                break;
+            }
+        }
+
+        if (m_stats.processedCount > 0) {
+            m_stats.averageLatency = static_cast<float>(latencySum / static_cast<double>(m_stats.processedCount));
+        }
+    }
+
+    // Entities between deadline checks
+    static constexpr size_t TIME_CHECK_INTERVAL = 16;
+
+    struct Visit {
+        Entity entity = NULL_ENTITY; // Who the slot was last visited for (ids are recycled)
+        double time = 0.0;
+    };
+
+    // Seconds since the entity's previous visit (deltaTime on its first)
+    float RecordVisit(Entity entity, float deltaTime) {
+        if (entity.id >= m_visits.size()) {
+            m_visits.resize(static_cast<size_t>(entity.id) + 1);
+        }
+        Visit& visit = m_visits[entity.id];
+        const float elapsed = visit.entity == entity ? static_cast<float>(m_time - visit.time) : deltaTime;
+        visit.entity = entity;
+        visit.time = m_time;
+        return elapsed;
+    }
+
+    SystemBudget m_budget;
+    TimeSliceStats m_stats;
+
+    size_t m_cursor = 0;          // Dense index the next slice starts at
+    double m_time = 0.0;          // Sum of the update delta times
+    uint64_t m_frame = 0;         // Updates so far
+
+    bool m_sweepStarted = false;
+    uint64_t m_sweepStartFrame = 0;
+    double m_sweepStartTime = 0.0;
+
+    std::vector<Visit> m_visits;  // Indexed by entity id
+};
+
+} // namespace ECS
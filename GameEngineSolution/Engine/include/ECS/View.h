@@ -0,0 +1,297 @@
+#pragma once
+
+#include "ComponentManager.h"
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ECS {
+
+// ==================================================================================
+// Query Filters
+// ----------------------------------------------------------------------------------
+// Restrict a View to entities whose T was changed / added after the view's 'since'
+// tick. Filters require T but do not pass it to the callback.
+// ==================================================================================
+template<typename T>
+struct Changed { using Component = T; };
+
+template<typename T>
+struct Added { using Component = T; };
+
+namespace Detail {
+
+template<typename... Types>
+struct TypeList {};
+
+template<typename T> struct IsViewFilter : std::false_type {};
+template<typename T> struct IsViewFilter<Changed<T>> : std::true_type {};
+template<typename T> struct IsViewFilter<Added<T>> : std::true_type {};
+
+// Split View parameters into components and filters (order preserved)
+template<typename Components, typename Filters, typename... Params>
+struct SplitViewParams {
+    using ComponentList = Components;
+    using FilterList = Filters;
+};
+
+template<typename... Components, typename... Filters, typename First, typename... Rest>
+struct SplitViewParams<TypeList<Components...>, TypeList<Filters...>, First, Rest...>
+    : std::conditional_t<IsViewFilter<First>::value,
+        SplitViewParams<TypeList<Components...>, TypeList<Filters..., First>, Rest...>,
+        SplitViewParams<TypeList<Components..., First>, TypeList<Filters...>, Rest...>> {};
+
+} // namespace Detail
+
+template<typename ComponentList, typename FilterList>
+class BasicView;
+
+// ==================================================================================
+// View<Components..., Filters...>
+// ----------------------------------------------------------------------------------
+// Zero-allocation iteration over every enabled entity that has all of Components
+// (see ComponentManager::SetEntityEnabled).
+// The smallest component array drives the walk; the other components are resolved
+// through their sparse index directly, without QueryEntities' result vector,
+// signature lookups or per-element locking.
+//
+// Component access:
+// - View<T>       : T& is passed and every visited T is marked as changed
+// - View<const T> : const T& is passed, nothing is marked (use for read-only access)
+// Marking does not look at what the callback did: pass const for every component
+// it only reads, and when writes are rare (e.g. a death check) iterate const and
+// write through ComponentManager::GetComponent, which marks just that entity.
+//
+// Example Usage:
+//     View<PhysicsComponent, TransformComponent> view(componentManager);
+//     view.Each([](Entity entity, PhysicsComponent& physics, TransformComponent& transform) {
+//         ...
+//     });
+//
+//     for (auto [entity, physics, transform] : view) { ... }
+//
+//     // Only transforms touched since this system's previous run
+//     View<const TransformComponent, Changed<TransformComponent>> moved(componentManager, GetLastRunTick());
+//
+// Notes:
+// - Do not make structural changes while iterating: adding a component can
+//   reallocate a dense array under the view, and removing or destroying swaps
+//   another entity into the visited slot. Record them in a CommandBuffer and play
+//   it back after the walk.
+// - In Archetype storage mode only Each() is supported; it walks matching chunks.
+//   Change filters are not available there.
+// - Shared components (IsSharedComponent) have no per-entity array and cannot be
+//   viewed; walk their buckets with SharedComponentArray::ForEachValue.
+// ==================================================================================
+template<typename... Params>
+using View = BasicView<
+    typename Detail::SplitViewParams<Detail::TypeList<>, Detail::TypeList<>, Params...>::ComponentList,
+    typename Detail::SplitViewParams<Detail::TypeList<>, Detail::TypeList<>, Params...>::FilterList>;
+
+template<typename... Components, typename... Filters>
+class BasicView<Detail::TypeList<Components...>, Detail::TypeList<Filters...>> {
+    static_assert(sizeof...(Components) > 0, "View requires at least one component type");
+    static_assert(!(IsSharedComponent<std::remove_const_t<Components>>::value || ...) &&
+                  !(IsSharedComponent<typename Filters::Component>::value || ...),
+                  "Shared components are iterated per value (SharedComponentArray::ForEachValue), not by View");
+
+    template<typename T>
+    using Storage = ComponentArray<std::remove_const_t<T>>;
+
+public:
+    // 'sinceTick' is only used by Changed/Added filters
+    explicit BasicView(ComponentManager& componentManager, uint32_t sinceTick = 0)
+        : m_componentManager(componentManager)
+        , m_sinceTick(sinceTick)
+    {
+        if (componentManager.GetStorageMode() == StorageMode::Archetype) {
+            return;
+        }
+
+        m_arrays = std::make_tuple(componentManager.GetComponentArray<std::remove_const_t<Components>>().get()...);
+        m_filterArrays = std::make_tuple(componentManager.GetComponentArray<typename Filters::Component>().get()...);
+        SelectLeadArray(std::index_sequence_for<Components...>{});
+    }
+
+    // Invoke fn(Entity, Components&...) for every matching entity
+    template<typename Func>
+    void Each(Func&& fn) const {
+        if (m_componentManager.GetStorageMode() == StorageMode::Archetype) {
+            if constexpr (sizeof...(Filters) > 0) {
+                throw std::runtime_error("Change filters are not available in Archetype storage mode");
+            } else {
+                m_componentManager.ForEachChunk<std::remove_const_t<Components>...>(
+                    [&](size_t count, Entity* entities, std::remove_const_t<Components>*... columns) {
+                        for (size_t i = 0; i < count; ++i) {
+                            if (m_componentManager.IsEntityEnabled(entities[i])) {
+                                fn(entities[i], columns[i]...);
+                            }
+                        }
+                    });
+            }
+            return;
+        }
+
+        EachSparse(fn, std::index_sequence_for<Components...>{});
+    }
+
+    // Upper bound on the number of matching entities (size of the lead array)
+    size_t SizeHint() const {
+        return m_leadEntities ? m_leadEntities->size() : 0;
+    }
+
+    // ========================================
+    // Range-for support (SparseSet mode)
+    // ========================================
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::tuple<Entity, Components&...>;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator(const BasicView* view, size_t index) : m_view(view), m_index(index) {
+            SkipNonMatching();
+        }
+
+        value_type operator*() const {
+            return m_view->Resolve(m_index, std::index_sequence_for<Components...>{});
+        }
+
+        Iterator& operator++() {
+            ++m_index;
+            SkipNonMatching();
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+
+    private:
+        void SkipNonMatching() {
+            size_t size = m_view->SizeHint();
+            while (m_index < size && !m_view->Matches(m_index, std::index_sequence_for<Components...>{})) {
+                ++m_index;
+            }
+            if (m_index > size) m_index = size;
+        }
+
+        const BasicView* m_view;
+        size_t m_index;
+    };
+
+    Iterator begin() const {
+        RequireSparseSet();
+        return Iterator(this, 0);
+    }
+
+    Iterator end() const {
+        RequireSparseSet();
+        return Iterator(this, SizeHint());
+    }
+
+private:
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+    template<size_t... I>
+    void SelectLeadArray(std::index_sequence<I...>) {
+        std::array<size_t, sizeof...(Components)> sizes = { std::get<I>(m_arrays)->GetSize()... };
+        size_t minSize = (std::numeric_limits<size_t>::max)();
+        for (size_t i = 0; i < sizes.size(); ++i) {
+            if (sizes[i] < minSize) {
+                minSize = sizes[i];
+                m_leadIndex = i;
+            }
+        }
+        ((I == m_leadIndex ? (m_leadEntities = &std::get<I>(m_arrays)->GetEntityArray(), 0) : 0), ...);
+    }
+
+    // Dense index of component I for the entity at lead position 'index' (INVALID_INDEX if missing)
+    template<size_t I>
+    uint32_t IndexOf(size_t index, Entity entity) const {
+        if (I == m_leadIndex) {
+            return static_cast<uint32_t>(index);
+        }
+        return std::get<I>(m_arrays)->GetIndex(entity);
+    }
+
+    // Component I at dense index 'slot'; mutable access marks it as changed
+    template<size_t I>
+    auto& Access(uint32_t slot) const {
+        using Component = std::tuple_element_t<I, std::tuple<Components...>>;
+        auto* array = std::get<I>(m_arrays);
+        if constexpr (!std::is_const_v<Component>) {
+            array->MarkChangedAtIndex(slot);
+        }
+        return static_cast<Component&>(array->GetComponentArray()[slot]);
+    }
+
+    template<size_t... F>
+    bool PassesFilters(Entity entity, std::index_sequence<F...>) const {
+        return (PassesFilter<F>(entity) && ...);
+    }
+
+    template<size_t F>
+    bool PassesFilter(Entity entity) const {
+        using Filter = std::tuple_element_t<F, std::tuple<Filters...>>;
+        auto* array = std::get<F>(m_filterArrays);
+        uint32_t slot = array->GetIndex(entity);
+        if (slot == INVALID_INDEX) {
+            return false;
+        }
+        if constexpr (std::is_same_v<Filter, Added<typename Filter::Component>>) {
+            return array->GetAddedTick(slot) > m_sinceTick;
+        } else {
+            return array->GetChangedTick(slot) > m_sinceTick;
+        }
+    }
+
+    template<size_t... I>
+    bool Matches(size_t index, std::index_sequence<I...>) const {
+        Entity entity = (*m_leadEntities)[index];
+        return ((IndexOf<I>(index, entity) != INVALID_INDEX) && ...) &&
+               PassesFilters(entity, std::index_sequence_for<Filters...>{}) &&
+               m_componentManager.IsEntityEnabled(entity);
+    }
+
+    template<size_t... I>
+    std::tuple<Entity, Components&...> Resolve(size_t index, std::index_sequence<I...>) const {
+        Entity entity = (*m_leadEntities)[index];
+        return std::tuple<Entity, Components&...>(entity, Access<I>(IndexOf<I>(index, entity))...);
+    }
+
+    template<typename Func, size_t... I>
+    void EachSparse(Func& fn, std::index_sequence<I...>) const {
+        if (!m_leadEntities) return;
+
+        // Size is re-read every step so appends to the lead array cannot run past the end
+        for (size_t index = 0; index < m_leadEntities->size(); ++index) {
+            Entity entity = (*m_leadEntities)[index];
+            std::array<uint32_t, sizeof...(Components)> slots = { IndexOf<I>(index, entity)... };
+            if (((slots[I] != INVALID_INDEX) && ...) &&
+                PassesFilters(entity, std::index_sequence_for<Filters...>{}) &&
+                m_componentManager.IsEntityEnabled(entity)) {
+                fn(entity, Access<I>(slots[I])...);
+            }
+        }
+    }
+
+    void RequireSparseSet() const {
+        if (!m_leadEntities && m_componentManager.GetStorageMode() == StorageMode::Archetype) {
+            throw std::runtime_error("View range-for is not available in Archetype storage mode; use Each()");
+        }
+    }
+
+    ComponentManager& m_componentManager;
+    uint32_t m_sinceTick = 0;
+    std::tuple<Storage<Components>*...> m_arrays{};
+    std::tuple<ComponentArray<typename Filters::Component>*...> m_filterArrays{};
+    const std::vector<Entity>* m_leadEntities = nullptr;
+    size_t m_leadIndex = 0;
+};
+
+} // namespace ECS
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace ECS {
+
+class SnapshotWriter;
+class SnapshotReader;
+
+// ==================================================================================
+// WorldSnapshot
+// ----------------------------------------------------------------------------------
+// Binary capture of a ComponentManager (see ComponentManager::Snapshot/Restore):
+// entity ID generator state, signatures and every component array, written into
+// one contiguous byte buffer. Trivially copyable components are stored as raw
+// memory; other types go through serializers registered with the ComponentManager.
+//
+// Assets (meshes, materials) are not serialized: components store them as indices
+// into the snapshot's reference table, which keeps shared assets alive. Snapshots
+// are therefore only valid inside the process that took them (quick-save, level
+// restart, regression captures) and are not a file format.
+//
+// A snapshot can be re-captured into the same object to reuse its buffer. Array
+// payloads are recorded as sections so delta encoders (see RewindBuffer) can compare
+// each array with its previous version even when the arrays before it changed size.
+// ==================================================================================
+class WorldSnapshot {
+public:
+    WorldSnapshot() = default;
+
+    bool IsEmpty() const { return m_data.empty(); }
+    size_t GetSize() const { return m_data.size(); }
+    const std::byte* GetData() const { return m_data.data(); }
+    size_t GetReferenceCount() const { return m_references.size(); }
+
+    void Clear() {
+        m_data.clear();
+        m_references.clear();
+        m_sections.clear();
+    }
+
+private:
+    friend class SnapshotWriter;
+    friend class SnapshotReader;
+    friend class RewindBuffer;
+
+    std::vector<std::byte> m_data;
+    std::vector<std::shared_ptr<void>> m_references; // Index 0 is reserved for null
+    std::vector<size_t> m_sections;                  // Offsets where sections start (first one at 0 is implicit)
+};
+
+// ==================================================================================
+// SnapshotWriter
+// ----------------------------------------------------------------------------------
+// Appends values to a WorldSnapshot (clears it first). Used by ComponentManager and
+// by component serializers.
+// ==================================================================================
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(WorldSnapshot& snapshot) : m_snapshot(snapshot) {
+        m_snapshot.Clear();
+        m_snapshot.m_references.push_back(nullptr);
+    }
+
+    void Reserve(size_t size) {
+        m_snapshot.m_data.reserve(size);
+    }
+
+    void WriteBytes(const void* data, size_t size) {
+        const std::byte* bytes = static_cast<const std::byte*>(data);
+        m_snapshot.m_data.insert(m_snapshot.m_data.end(), bytes, bytes + size);
+    }
+
+    template<typename T>
+    void Write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Write<T> requires a trivially copyable type");
+        WriteBytes(&value, sizeof(T));
+    }
+
+    // Element count followed by the raw elements (in a section of their own)
+    template<typename T>
+    void WriteArray(std::span<const T> values) {
+        static_assert(std::is_trivially_copyable_v<T>, "WriteArray<T> requires a trivially copyable type");
+        Write(static_cast<uint64_t>(values.size()));
+        BeginSection();
+        WriteBytes(values.data(), values.size_bytes());
+        BeginSection();
+    }
+
+    // Starts a new section at the current offset
+    void BeginSection() {
+        m_snapshot.m_sections.push_back(m_snapshot.m_data.size());
+    }
+
+    // Shared asset: kept alive by the snapshot, stored as a reference index
+    template<typename T>
+    void WriteReference(const std::shared_ptr<T>& reference) {
+        Write(AddReference(std::const_pointer_cast<std::remove_const_t<T>>(reference)));
+    }
+
+    // Non-owning asset pointer (owner must outlive the snapshot, e.g. AssetManager meshes)
+    template<typename T>
+    void WriteReference(T* reference) {
+        Write(AddReference(std::shared_ptr<void>(std::shared_ptr<void>(), const_cast<std::remove_const_t<T>*>(reference))));
+    }
+
+private:
+    uint32_t AddReference(std::shared_ptr<void> reference) {
+        if (!reference) return 0;
+
+        auto [it, inserted] = m_referenceIndex.try_emplace(reference.get(),
+            static_cast<uint32_t>(m_snapshot.m_references.size()));
+        if (inserted) {
+            m_snapshot.m_references.push_back(std::move(reference));
+        }
+        return it->second;
+    }
+
+    WorldSnapshot& m_snapshot;
+    std::unordered_map<const void*, uint32_t> m_referenceIndex;
+};
+
+// ==================================================================================
+// SnapshotReader
+// ----------------------------------------------------------------------------------
+// Reads values back in the order they were written. Reading past the end or an
+// unknown reference throws std::runtime_error.
+// ==================================================================================
+class SnapshotReader {
+public:
+    explicit SnapshotReader(const WorldSnapshot& snapshot) : m_snapshot(snapshot) {}
+
+    void ReadBytes(void* data, size_t size) {
+        if (size == 0) return;
+        if (size > m_snapshot.m_data.size() - m_offset) {
+            throw std::runtime_error("Snapshot: read past the end of the data");
+        }
+        std::memcpy(data, m_snapshot.m_data.data() + m_offset, size);
+        m_offset += size;
+    }
+
+    template<typename T>
+    T Read() {
+        static_assert(std::is_trivially_copyable_v<T>, "Read<T> requires a trivially copyable type");
+        T value;
+        ReadBytes(&value, sizeof(T));
+        return value;
+    }
+
+    // Replaces 'values' with an array written by WriteArray
+    template<typename T>
+    void ReadArray(std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>, "ReadArray<T> requires a trivially copyable type");
+        uint64_t count = Read<uint64_t>();
+        if (count > (m_snapshot.m_data.size() - m_offset) / (sizeof(T) > 0 ? sizeof(T) : 1)) {
+            throw std::runtime_error("Snapshot: array larger than the remaining data");
+        }
+        values.resize(static_cast<size_t>(count));
+        ReadBytes(values.data(), values.size() * sizeof(T));
+    }
+
+    // Reference written by WriteReference (nullptr stays nullptr); use .get() for non-owning ones
+    template<typename T>
+    std::shared_ptr<T> ReadReference() {
+        uint32_t index = Read<uint32_t>();
+        if (index >= m_snapshot.m_references.size()) {
+            throw std::runtime_error("Snapshot: invalid reference index");
+        }
+        return std::static_pointer_cast<T>(m_snapshot.m_references[index]);
+    }
+
+    bool IsAtEnd() const { return m_offset == m_snapshot.m_data.size(); }
+
+private:
+    const WorldSnapshot& m_snapshot;
+    size_t m_offset = 0;
+};
+
+// ==================================================================================
+// Component serializers
+// ----------------------------------------------------------------------------------
+// Required for component types that are not trivially copyable (see
+// ComponentManager::RegisterSerializer). Components are default-constructed before
+// load() is called.
+// ==================================================================================
+class IComponentSerializer {
+public:
+    virtual ~IComponentSerializer() = default;
+};
+
+template<typename T>
+class ComponentSerializer : public IComponentSerializer {
+public:
+    using SaveFn = void (*)(const T&, SnapshotWriter&);
+    using LoadFn = void (*)(SnapshotReader&, T&);
+
+    ComponentSerializer(SaveFn save, LoadFn load) : m_save(save), m_load(load) {}
+
+    void Save(const T& component, SnapshotWriter& writer) const { m_save(component, writer); }
+    void Load(SnapshotReader& reader, T& component) const { m_load(reader, component); }
+
+private:
+    SaveFn m_save;
+    LoadFn m_load;
+};
+
+} // namespace ECS
@@ -0,0 +1,233 @@
+#pragma once
+
+#include "Event.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ==================================================================================
+// DeferredEventQueue
+// ----------------------------------------------------------------------------------
+// Storage for EventBus::QueueEvent<T>(): events are placement-constructed into a
+// per-frame linear arena instead of one heap allocation each.
+//
+// Two arenas alternate. Producers append to the open one while Drain() dispatches
+// the other, so an event queued during the drain (by a handler or another thread)
+// is delivered by the next Drain().
+//
+// Ordering: events from one thread are delivered in the order they were queued,
+// and an event queued before Drain() started is delivered by that Drain(). Events
+// queued concurrently with a Drain() go to it or to the next one. A producer that
+// picked the arena before a Drain() switched them re-checks after reserving and
+// moves to the open arena; it never lands in the drained one, which would hold its
+// event back until after the following frame's events.
+//
+// Append is lock-free for any number of producers: one fetch_add reserves the
+// bytes, the event is constructed in place, a second fetch_add commits them.
+// Drain() closes the arena, waits for reservations that are still being
+// constructed, dispatches in reservation order (destroying each event after its
+// dispatch) and rewinds the arena's offset to zero.
+//
+// Once an arena is full, further events are heap-allocated into that arena's
+// overflow list (under a mutex) and delivered right after its records, so overflow
+// keeps the ordering above. Drain() must not run on two threads at once.
+// ==================================================================================
+class DeferredEventQueue
+{
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024; // Bytes per arena
+
+    explicit DeferredEventQueue(size_t capacity = DEFAULT_CAPACITY)
+    {
+        for (Arena& arena : m_arenas) {
+            arena.capacity = capacity;
+            // Slack for the end marker written by the first reservation that doesn't fit
+            arena.memory = std::make_unique<std::byte[]>(capacity + sizeof(Record));
+        }
+    }
+
+    ~DeferredEventQueue()
+    {
+        auto discard = [](Event&) {};
+        for (Arena& arena : m_arenas) {
+            Consume(arena, arena.reserved.load(std::memory_order_relaxed) & ~CLOSED, discard);
+        }
+    }
+
+    DeferredEventQueue(const DeferredEventQueue&) = delete;
+    DeferredEventQueue& operator=(const DeferredEventQueue&) = delete;
+
+    // Construct a T in the open arena, or on the heap if the arena is full
+    template<typename T, typename... Args>
+    void Emplace(Args&&... args)
+    {
+        static_assert(std::is_base_of_v<Event, T>, "DeferredEventQueue: T must derive from Event");
+        static_assert(alignof(T) <= ALIGNMENT, "DeferredEventQueue: event type is over-aligned");
+        constexpr uint64_t size = sizeof(Record) + RoundUp(sizeof(T));
+
+        for (;;) {
+            const uint32_t index = m_open.load(std::memory_order_seq_cst);
+            Arena& arena = m_arenas[index];
+            const uint64_t offset = arena.reserved.fetch_add(size, std::memory_order_seq_cst);
+            if (offset & CLOSED) {
+                // Drain() closed this arena after we picked it; the other one is open
+                continue;
+            }
+
+            std::byte* slot = arena.memory.get() + offset;
+            if (m_open.load(std::memory_order_seq_cst) != index) {
+                // Picked before a Drain() switched arenas: this one may already have been
+                // drained and rewound, and would only be drained again after the open
+                // one. Give the bytes back as a skip record and queue in the open arena.
+                if (offset + size <= arena.capacity) {
+                    new (slot) Record{ nullptr, size };
+                } else if (offset <= arena.capacity) {
+                    new (slot) Record{ nullptr, 0 };
+                }
+                arena.committed.fetch_add(size, std::memory_order_seq_cst);
+                continue;
+            }
+
+            if (offset + size > arena.capacity) {
+                if (offset <= arena.capacity) {
+                    new (slot) Record{ nullptr, 0 };
+                }
+                // Listed before committing, so the Drain() that waits for this commit sees it
+                try {
+                    auto event = std::make_unique<T>(std::forward<Args>(args)...);
+                    std::lock_guard<std::mutex> lock(arena.overflowMutex);
+                    arena.overflow.push_back(std::move(event));
+                } catch (...) {
+                    arena.committed.fetch_add(size, std::memory_order_seq_cst);
+                    throw;
+                }
+                arena.committed.fetch_add(size, std::memory_order_seq_cst);
+                return;
+            }
+
+            try {
+                T* event = new (slot + sizeof(Record)) T(std::forward<Args>(args)...);
+                new (slot) Record{ event, size };
+            } catch (...) {
+                // Skipped by Drain(), but still committed so it doesn't wait forever
+                new (slot) Record{ nullptr, size };
+                arena.committed.fetch_add(size, std::memory_order_seq_cst);
+                throw;
+            }
+            arena.committed.fetch_add(size, std::memory_order_seq_cst);
+            return;
+        }
+    }
+
+    // Dispatch every event queued before the call, in queue order; returns the count
+    template<typename Dispatch>
+    size_t Drain(Dispatch&& dispatch)
+    {
+        const uint32_t index = m_open.load(std::memory_order_relaxed);
+        Arena& arena = m_arenas[index];
+        m_open.store(index ^ 1, std::memory_order_seq_cst);
+
+        const uint64_t reserved = arena.reserved.fetch_or(CLOSED, std::memory_order_seq_cst);
+        while (arena.committed.load(std::memory_order_seq_cst) != reserved) {
+            std::this_thread::yield();
+        }
+        return Consume(arena, reserved, dispatch);
+    }
+
+    size_t GetCapacity() const { return m_arenas[0].capacity; }
+
+private:
+    static constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+    static constexpr uint64_t CLOSED = uint64_t(1) << 63;
+
+    // Precedes each event. event == nullptr: skip 'size' bytes; size == 0: end of arena.
+    struct alignas(ALIGNMENT) Record
+    {
+        Event* event;
+        uint64_t size;
+    };
+
+    struct Arena
+    {
+        alignas(64) std::atomic<uint64_t> reserved{ 0 };  // Bytes handed out (| CLOSED while draining)
+        alignas(64) std::atomic<uint64_t> committed{ 0 }; // Bytes fully constructed
+        std::unique_ptr<std::byte[]> memory;
+        size_t capacity = 0;
+        std::mutex overflowMutex;
+        std::vector<std::unique_ptr<Event>> overflow; // Events that didn't fit, in queue order
+    };
+
+    static constexpr uint64_t RoundUp(size_t bytes)
+    {
+        return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    // Dispatch and destroy the records below 'reserved' and then the overflow list, and
+    // rewind the arena (also if a handler throws: remaining events are destroyed undelivered)
+    template<typename Dispatch>
+    static size_t Consume(Arena& arena, uint64_t reserved, Dispatch& dispatch)
+    {
+        struct Rewind
+        {
+            Arena& arena;
+            uint64_t offset;
+            uint64_t end;
+            Event* dispatching = nullptr;
+
+            ~Rewind()
+            {
+                if (dispatching) {
+                    dispatching->~Event();
+                }
+                for (Record* record; (record = Next()) != nullptr; ) {
+                    if (record->event) {
+                        record->event->~Event();
+                    }
+                }
+                // No producer touches the list while the arena is closed
+                arena.overflow.clear();
+                // committed first: a producer that sees the reopened offset commits after it
+                arena.committed.store(0, std::memory_order_seq_cst);
+                arena.reserved.store(0, std::memory_order_seq_cst);
+            }
+
+            Record* Next()
+            {
+                if (offset >= end) return nullptr;
+                Record* record = std::launder(reinterpret_cast<Record*>(arena.memory.get() + offset));
+                if (record->size == 0) return nullptr;
+                offset += record->size;
+                return record;
+            }
+        } rewind{ arena, 0, std::min<uint64_t>(reserved, arena.capacity) };
+
+        size_t count = 0;
+        for (Record* record; (record = rewind.Next()) != nullptr; ) {
+            if (record->event) {
+                rewind.dispatching = record->event;
+                dispatch(*record->event);
+                rewind.dispatching = nullptr;
+                record->event->~Event();
+                ++count;
+            }
+        }
+        for (auto& event : arena.overflow) {
+            dispatch(*event);
+            event.reset();
+            ++count;
+        }
+        return count;
+    }
+
+    std::array<Arena, 2> m_arenas;
+    alignas(64) std::atomic<uint32_t> m_open{ 0 }; // Arena producers append to
+};
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename Signature>
+class Delegate;
+
+// ==================================================================================
+// Delegate
+// ----------------------------------------------------------------------------------
+// Copyable callable wrapper like std::function, but the callable always lives in an
+// inline buffer (INLINE_SIZE bytes): constructing, copying and calling never
+// allocate. Callables that don't fit are a compile error - capture a pointer to the
+// state instead of the state.
+//
+// Trivially copyable callables (plain lambdas capturing pointers/references, free
+// functions) are copied with memcpy and need no destructor call.
+//
+// Example Usage:
+//     Delegate<void(ComponentAddedEvent&)> onAdded = [this](ComponentAddedEvent& e) { Track(e.entity); };
+//     onAdded(event);
+// ==================================================================================
+template<typename R, typename... Args>
+class Delegate<R(Args...)>
+{
+public:
+    static constexpr size_t INLINE_SIZE = 4 * sizeof(void*);
+
+    Delegate() = default;
+
+    template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Delegate>>>
+    Delegate(F&& callable)
+    {
+        using Callable = std::decay_t<F>;
+        static_assert(sizeof(Callable) <= INLINE_SIZE,
+            "Delegate: callable too large for the inline buffer (capture a pointer to the state instead)");
+        static_assert(alignof(Callable) <= alignof(void*), "Delegate: callable is over-aligned");
+        static_assert(std::is_copy_constructible_v<Callable>, "Delegate: callable must be copyable");
+
+        new (m_storage) Callable(std::forward<F>(callable));
+        m_invoke = &Invoke<Callable>;
+        if constexpr (!(std::is_trivially_copyable_v<Callable> && std::is_trivially_destructible_v<Callable>)) {
+            m_manage = &Manage<Callable>;
+        }
+    }
+
+    Delegate(const Delegate& other) { CopyFrom(other); }
+    Delegate(Delegate&& other) noexcept { MoveFrom(other); }
+
+    Delegate& operator=(const Delegate& other)
+    {
+        if (this != &other) {
+            Reset();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    Delegate& operator=(Delegate&& other) noexcept
+    {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    ~Delegate() { Reset(); }
+
+    // Call the stored callable; must not be empty
+    R operator()(Args... args) const
+    {
+        return m_invoke(const_cast<unsigned char*>(m_storage), std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const { return m_invoke != nullptr; }
+
+    void Reset()
+    {
+        if (m_manage) {
+            m_manage(Operation::Destroy, m_storage, nullptr);
+        }
+        m_invoke = nullptr;
+        m_manage = nullptr;
+    }
+
+private:
+    enum class Operation { Copy, Move, Destroy };
+
+    using InvokeFn = R(*)(void*, Args&&...);
+    using ManageFn = void(*)(Operation, void*, void*);
+
+    template<typename Callable>
+    static R Invoke(void* storage, Args&&... args)
+    {
+        return (*static_cast<Callable*>(storage))(std::forward<Args>(args)...);
+    }
+
+    template<typename Callable>
+    static void Manage(Operation operation, void* destination, void* source)
+    {
+        switch (operation) {
+            case Operation::Copy:    new (destination) Callable(*static_cast<const Callable*>(source)); break;
+            case Operation::Move:    new (destination) Callable(std::move(*static_cast<Callable*>(source))); break;
+            case Operation::Destroy: static_cast<Callable*>(destination)->~Callable(); break;
+        }
+    }
+
+    void CopyFrom(const Delegate& other)
+    {
+        if (other.m_manage) {
+            other.m_manage(Operation::Copy, m_storage, const_cast<unsigned char*>(other.m_storage));
+        } else {
+            std::memcpy(m_storage, other.m_storage, INLINE_SIZE);
+        }
+        m_invoke = other.m_invoke;
+        m_manage = other.m_manage;
+    }
+
+    void MoveFrom(Delegate& other)
+    {
+        if (other.m_manage) {
+            other.m_manage(Operation::Move, m_storage, other.m_storage);
+        } else {
+            std::memcpy(m_storage, other.m_storage, INLINE_SIZE);
+        }
+        m_invoke = other.m_invoke;
+        m_manage = other.m_manage;
+        other.Reset();
+    }
+
+    alignas(void*) unsigned char m_storage[INLINE_SIZE] = {};
+    InvokeFn m_invoke = nullptr;
+    ManageFn m_manage = nullptr; // nullptr: trivially copyable (memcpy, no destructor)
+};
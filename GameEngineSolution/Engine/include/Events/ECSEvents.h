@@ -2,6 +2,7 @@
 
 #include "Events/Event.h"
 #include "ECS/Entity.h"
+#include <span>
 #include <typeindex>
 
 // ==================================================================================
@@ -42,3 +43,57 @@ struct EntityDestroyedEvent : public Event {
     EVENT_CLASS_TYPE(EntityDestroyed)
     EVENT_CLASS_CATEGORY(EventCategoryECS)
 };
+
+// Fired by ComponentManager::SetEntityEnabled(); the entity keeps its components
+struct EntityEnabledChangedEvent : public Event {
+    ECS::Entity entity;
+    bool enabled;
+    
+    EntityEnabledChangedEvent(ECS::Entity e, bool isEnabled)
+        : entity(e), enabled(isEnabled) {}
+    
+    EVENT_CLASS_TYPE(EntityEnabledChanged)
+    EVENT_CLASS_CATEGORY(EventCategoryECS)
+};
+
+// ==================================================================================
+// Batched Component Events
+// ----------------------------------------------------------------------------------
+// Published by ComponentManager::EndBatch() (and bulk AddComponents) instead of one
+// ComponentAdded/ComponentRemoved event per entity. 'entities' is only valid for the
+// duration of the callback.
+// ==================================================================================
+
+struct ComponentsAddedEvent : public Event {
+    std::type_index componentType;
+    std::span<const ECS::Entity> entities;
+    
+    ComponentsAddedEvent(std::type_index type, std::span<const ECS::Entity> e)
+        : componentType(type), entities(e) {}
+    
+    EVENT_CLASS_TYPE(ComponentsAdded)
+    EVENT_CLASS_CATEGORY(EventCategoryECS)
+};
+
+struct ComponentsRemovedEvent : public Event {
+    std::type_index componentType;
+    std::span<const ECS::Entity> entities;
+    
+    ComponentsRemovedEvent(std::type_index type, std::span<const ECS::Entity> e)
+        : componentType(type), entities(e) {}
+    
+    EVENT_CLASS_TYPE(ComponentsRemoved)
+    EVENT_CLASS_CATEGORY(EventCategoryECS)
+};
+
+// Published by ComponentManager::DestroyEntities() instead of one EntityDestroyed
+// event per entity. The entities are already gone when it is published.
+struct EntitiesDestroyedEvent : public Event {
+    std::span<const ECS::Entity> entities;
+    
+    explicit EntitiesDestroyedEvent(std::span<const ECS::Entity> e)
+        : entities(e) {}
+    
+    EVENT_CLASS_TYPE(EntitiesDestroyed)
+    EVENT_CLASS_CATEGORY(EventCategoryECS)
+};
@@ -2,9 +2,10 @@
 
 #include <string>
 #include <functional>
+#include <cstddef>
 
 // Event Type Macros
-#define EVENT_CLASS_TYPE(type) static EventType GetStaticType() { return EventType::type; } \
+#define EVENT_CLASS_TYPE(type) static constexpr EventType GetStaticType() { return EventType::type; } \
                                virtual EventType GetEventType() const override { return GetStaticType(); } \
                                virtual const char* GetName() const override { return #type; }
 
@@ -16,7 +17,20 @@ enum class EventType
     WindowClose, WindowResize, WindowFocus, WindowLostFocus,
     KeyPressed, KeyReleased, KeyTyped,
     MouseButtonPressed, MouseButtonReleased, MouseMoved, MouseScrolled,
-    ComponentAdded, ComponentRemoved, EntityDestroyed
+    ComponentAdded, ComponentRemoved, EntityDestroyed,
+    ComponentsAdded, ComponentsRemoved, EntitiesDestroyed,
+    EntityEnabledChanged
+};
+
+// Number of EventType values (tables indexed by type); keep in sync with the last entry
+constexpr size_t EventTypeCount = static_cast<size_t>(EventType::EntityEnabledChanged) + 1;
+
+// Event priority levels (lower number = higher priority)
+enum class EventPriority 
+{
+    High = 0,
+    Normal = 1,
+    Low = 2
 };
 
 enum EventCategory
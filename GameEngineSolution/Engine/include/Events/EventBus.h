@@ -1,21 +1,22 @@
 #pragma once
 
 #include "Event.h"
+#include "DeferredEventQueue.h"
+#include "EventChannel.h"
+#include "EventTrace.h"
+#include "ReadCopyUpdate.h"
 #include <vector>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <unordered_map>
 #include <memory>
 #include <mutex>
 #include <algorithm>
+#include <iterator>
 #include <string>
-
-// Event priority levels (lower number = higher priority)
-enum class EventPriority 
-{
-    High = 0,
-    Normal = 1,
-    Low = 2
-};
+#include <type_traits>
 
 // Forward declaration
 class EventBus;
@@ -60,13 +61,59 @@ struct EventStats
     }
 };
 
+// ==================================================================================
+// EventBus
+// ----------------------------------------------------------------------------------
+// Synchronous publish/subscribe with priorities, category subscriptions and a
+// deferred queue.
+//
+// Subscriber lists are read-copy-update: Publish reads an immutable snapshot
+// (SubscriberTable) through one atomic pointer and takes no lock, so callbacks may
+// publish, subscribe or unsubscribe re-entrantly, and publishers on different
+// threads never wait for each other's handlers. Subscribe/Unsubscribe copy the
+// affected event type's lists under m_mutex and swap in a new table; other types'
+// lists are shared between tables, not copied.
+//
+// A replaced table is freed once no Publish is in flight (checked by the next
+// subscription change or ProcessEvents), so a Publish that started before a change
+// finishes on the lists it started with; one added mid-dispatch gets the next event.
+//
+// Unsubscribe (and SubscriptionGuard) called outside a callback waits for the
+// Publish calls already in flight, so once it returns the callback is never run
+// again and whatever it captured may be destroyed. Called from inside a callback
+// of this bus it cannot wait (that Publish is on its own stack): the removed
+// subscriber may still receive the events being delivered on other threads at that
+// moment. Don't unsubscribe while holding a lock that a callback may take.
+//
+// Channel<T>() is the typed, allocation-free alternative for hot event types (see
+// EventChannel); both APIs deliver to each other's subscribers.
+//
+// QueueEvent<T>(args...) constructs deferred events in a per-frame arena without a
+// lock (see DeferredEventQueue); ProcessEvents delivers them once per frame.
+//
+// StartRecording() traces every published and queued event into an EventRecorder
+// ring; SaveRecording() writes it for the EventReplay tool. Costs one atomic load
+// per event while no recording is active.
+// ==================================================================================
 class EventBus
 {
 public:
     using EventCallbackFn = std::function<void(Event&)>;
     using SubscriptionId = size_t;
 
-    EventBus() : m_nextId(0), m_debugMode(false) {}
+    EventBus()
+        : m_table(new SubscriberTable())
+    {
+    }
+
+    ~EventBus()
+    {
+        delete m_table.load(std::memory_order_relaxed);
+        delete m_recorder.load(std::memory_order_relaxed);
+    }
+
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
 
     // Subscribe to a specific event type with priority
     SubscriptionId Subscribe(EventType type, EventCallbackFn callback, EventPriority priority = EventPriority::Normal)
@@ -74,9 +121,16 @@ public:
         std::lock_guard<std::mutex> lock(m_mutex);
         
         SubscriptionId id = m_nextId++;
-        m_subscribers[type][static_cast<int>(priority)].push_back({id, std::move(callback)});
+        UpdateTable([&](SubscriberTable& table) {
+            auto& lists = table.byType[static_cast<size_t>(type)];
+            auto copy = lists ? std::make_shared<PriorityLists<Subscription>>(*lists)
+                              : std::make_shared<PriorityLists<Subscription>>();
+            (*copy)[static_cast<size_t>(priority)].push_back({id, std::move(callback)});
+            lists = std::move(copy);
+            return true;
+        });
         
-        if (m_debugMode) {
+        if (IsDebugMode()) {
             LogDebug("Subscribed to " + GetEventTypeName(type) + 
                     " (Priority: " + GetPriorityName(priority) + ", ID: " + std::to_string(id) + ")");
         }
@@ -91,15 +145,43 @@ public:
         return std::make_unique<SubscriptionGuard>(this, type, id);
     }
 
+    // Typed channel for event class T (created on first use, lives as long as the bus).
+    // The reference may be cached.
+    template<typename T>
+    EventChannel<T>& Channel()
+    {
+        static_assert(std::is_base_of_v<Event, T>, "EventBus::Channel: T must derive from Event");
+        constexpr size_t index = static_cast<size_t>(T::GetStaticType());
+        static_assert(index < EventTypeCount, "EventBus::Channel: EventType out of range (update EventTypeCount)");
+        
+        IEventChannel* channel = m_channels[index].load(std::memory_order_acquire);
+        if (!channel) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            channel = m_channels[index].load(std::memory_order_relaxed);
+            if (!channel) {
+                m_ownedChannels[index] = std::make_unique<EventChannel<T>>(*this);
+                channel = m_ownedChannels[index].get();
+                m_channels[index].store(channel, std::memory_order_release);
+            }
+        }
+        return static_cast<EventChannel<T>&>(*channel);
+    }
+
     // Subscribe to all events in a category
     SubscriptionId SubscribeByCategory(int categoryFlags, EventCallbackFn callback, EventPriority priority = EventPriority::Normal)
     {
         std::lock_guard<std::mutex> lock(m_mutex);
         
         SubscriptionId id = m_nextId++;
-        m_categorySubscribers[static_cast<int>(priority)].push_back({id, categoryFlags, std::move(callback)});
+        UpdateTable([&](SubscriberTable& table) {
+            auto copy = table.byCategory ? std::make_shared<PriorityLists<CategorySubscription>>(*table.byCategory)
+                                         : std::make_shared<PriorityLists<CategorySubscription>>();
+            (*copy)[static_cast<size_t>(priority)].push_back({id, categoryFlags, std::move(callback)});
+            table.byCategory = std::move(copy);
+            return true;
+        });
         
-        if (m_debugMode) {
+        if (IsDebugMode()) {
             LogDebug("Subscribed to category " + std::to_string(categoryFlags) + 
                     " (Priority: " + GetPriorityName(priority) + ", ID: " + std::to_string(id) + ")");
         }
@@ -107,183 +189,216 @@ public:
         return id;
     }
 
-    // Unsubscribe from a specific event type
+    // Unsubscribe from a specific event type. Outside a callback, waits for the
+    // Publish calls in flight (see class comment).
     void Unsubscribe(EventType type, SubscriptionId id)
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        if (static_cast<size_t>(type) >= EventTypeCount) return;
         
-        auto& priorityMap = m_subscribers[type];
-        for (auto& [priority, subscriptions] : priorityMap) {
-            auto it = std::remove_if(subscriptions.begin(), subscriptions.end(),
-                [id](const Subscription& sub) { return sub.id == id; });
-            subscriptions.erase(it, subscriptions.end());
-        }
-        
-        if (m_debugMode) {
-            LogDebug("Unsubscribed from " + GetEventTypeName(type) + " (ID: " + std::to_string(id) + ")");
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            
+            bool removed = false;
+            UpdateTable([&](SubscriberTable& table) {
+                auto& lists = table.byType[static_cast<size_t>(type)];
+                removed = lists && RemoveSubscription(lists, id);
+                return removed;
+            });
+            
+            // Typed subscription of this type's channel
+            if (!removed) {
+                if (IEventChannel* channel = m_channels[static_cast<size_t>(type)].load(std::memory_order_relaxed)) {
+                    channel->RemoveSubscription(id);
+                }
+            }
+            
+            if (IsDebugMode()) {
+                LogDebug("Unsubscribed from " + GetEventTypeName(type) + " (ID: " + std::to_string(id) + ")");
+            }
         }
+        WaitForPublishers();
     }
 
     // Unsubscribe from category subscription
     void UnsubscribeCategory(SubscriptionId id)
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        
-        for (auto& [priority, subscriptions] : m_categorySubscribers) {
-            auto it = std::remove_if(subscriptions.begin(), subscriptions.end(),
-                [id](const CategorySubscription& sub) { return sub.id == id; });
-            subscriptions.erase(it, subscriptions.end());
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            
+            UpdateTable([&](SubscriberTable& table) {
+                return table.byCategory && RemoveSubscription(table.byCategory, id);
+            });
+            
+            if (IsDebugMode()) {
+                LogDebug("Unsubscribed from category (ID: " + std::to_string(id) + ")");
+            }
         }
-        
-        if (m_debugMode) {
-            LogDebug("Unsubscribed from category (ID: " + std::to_string(id) + ")");
+        WaitForPublishers();
+    }
+
+    // Queue an event of type T for deferred processing, constructed in place in the
+    // frame arena (on the heap once it is full). Lock-free until the arena fills:
+    // safe to call from any thread and from inside callbacks.
+    template<typename T, typename... Args>
+    void QueueEvent(Args&&... args)
+    {
+        if (IsDebugMode()) {
+            LogDebug("Queued event: " + GetEventTypeName(T::GetStaticType()));
         }
+        RecordQueued(T::GetStaticType());
+        
+        m_deferredEvents.template Emplace<T>(std::forward<Args>(args)...);
     }
 
-    // Queue an event for deferred processing
+    // Queue a heap-allocated event for deferred processing
     void QueueEvent(std::unique_ptr<Event> event)
     {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_debugMode) {
+        if (IsDebugMode()) {
             LogDebug("Queued event: " + std::string(event->GetName()));
         }
+        RecordQueued(event->GetEventType());
         m_eventQueue.push_back(std::move(event));
     }
 
-    // Publish an event immediately (synchronous)
+    // Publish an event immediately (synchronous). Lock-free: safe to call from any
+    // thread and from inside callbacks.
     void Publish(Event& event)
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        
-        m_stats.totalPublished++;
-        m_stats.countByType[event.GetEventType()]++;
-        
-        if (m_debugMode) {
-            LogDebug("Publishing: " + std::string(event.GetName()));
-        }
+        RcuDomain::ReadScope scope(m_rcu);
         
-        // Process type-specific subscribers (High -> Normal -> Low)
-        auto& priorityMap = m_subscribers[event.GetEventType()];
-        for (int p = static_cast<int>(EventPriority::High); 
-             p <= static_cast<int>(EventPriority::Low); 
-             ++p) 
-        {
-            auto it = priorityMap.find(p);
-            if (it != priorityMap.end()) {
-                for (auto& subscription : it->second) {
-                    subscription.callback(event);
-                    if (event.Handled) {
-                        m_stats.totalHandled++;
-                        if (m_debugMode) {
-                            LogDebug("  -> Handled by subscriber (ID: " + std::to_string(subscription.id) + ")");
-                        }
-                        return;
-                    }
-                }
-            }
-        }
+        const size_t typeIndex = static_cast<size_t>(event.GetEventType());
+        CountPublished(event, typeIndex);
         
-        // Process category subscribers (High -> Normal -> Low)
-        int categoryFlags = event.GetCategoryFlags();
-        for (int p = static_cast<int>(EventPriority::High); 
-             p <= static_cast<int>(EventPriority::Low); 
-             ++p) 
-        {
-            auto it = m_categorySubscribers.find(p);
-            if (it != m_categorySubscribers.end()) {
-                for (auto& subscription : it->second) {
-                    if (categoryFlags & subscription.categoryFlags) {
-                        subscription.callback(event);
-                        if (event.Handled) {
-                            m_stats.totalHandled++;
-                            if (m_debugMode) {
-                                LogDebug("  -> Handled by category subscriber (ID: " + std::to_string(subscription.id) + ")");
-                            }
-                            return;
-                        }
-                    }
-                }
-            }
+        // Typed channel subscribers first, then EventType and category subscribers
+        const SubscriberTable& table = *m_table.load(std::memory_order_seq_cst);
+        IEventChannel* channel = typeIndex < EventTypeCount ? m_channels[typeIndex].load(std::memory_order_acquire) : nullptr;
+        bool handled = Dispatch(event, table, typeIndex, [&](size_t* channelSubscribers) {
+            return (channel && channel->DispatchErased(event, channelSubscribers)) || DispatchUntyped(event, typeIndex, table);
+        });
+        if (handled) {
+            m_totalHandled.fetch_add(1, std::memory_order_relaxed);
         }
     }
 
-    // Process all queued events
+    // Process all queued events: the frame arena in queue order, then heap-queued
+    // events. Events queued meanwhile are delivered by the next call. Call once per
+    // frame from one thread at a time, not from inside a callback.
     void ProcessEvents()
     {
+        std::lock_guard<std::mutex> processLock(m_processMutex);
         std::vector<std::unique_ptr<Event>> eventsToProcess;
         
         {
             std::lock_guard<std::mutex> lock(m_mutex);
             eventsToProcess = std::move(m_eventQueue);
             m_eventQueue.clear();
+            m_rcu.Reclaim();
         }
         
-        if (m_debugMode && !eventsToProcess.empty()) {
-            LogDebug("Processing " + std::to_string(eventsToProcess.size()) + " queued events");
-        }
+        size_t processed = m_deferredEvents.Drain([this](Event& event) { Publish(event); });
         
         for (auto& event : eventsToProcess) {
             Publish(*event);
         }
+        processed += eventsToProcess.size();
+        
+        if (IsDebugMode() && processed > 0) {
+            LogDebug("Processed " + std::to_string(processed) + " queued events");
+        }
     }
 
     // Enable/disable debug logging
     void SetDebugMode(bool enabled) 
     { 
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_debugMode = enabled;
+        m_debugMode.store(enabled, std::memory_order_relaxed);
         if (enabled) {
             LogDebug("EventBus debug mode enabled");
         }
     }
 
-    // Get event statistics
+    // Get event statistics (counters are updated without a lock; the copy is not an
+    // atomic snapshot while other threads publish)
     EventStats GetStats() const
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        return m_stats;
+        EventStats stats;
+        stats.totalPublished = m_totalPublished.load(std::memory_order_relaxed);
+        stats.totalHandled = m_totalHandled.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < EventTypeCount; ++i) {
+            size_t count = m_countByType[i].load(std::memory_order_relaxed);
+            if (count > 0) {
+                stats.countByType[static_cast<EventType>(i)] = count;
+            }
+        }
+        return stats;
     }
 
     // Reset statistics
     void ResetStats()
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_stats.Reset();
-        if (m_debugMode) {
+        m_totalPublished.store(0, std::memory_order_relaxed);
+        m_totalHandled.store(0, std::memory_order_relaxed);
+        for (auto& count : m_countByType) {
+            count.store(0, std::memory_order_relaxed);
+        }
+        if (IsDebugMode()) {
             LogDebug("Statistics reset");
         }
     }
 
-    // Get subscriber count for debugging
-    size_t GetSubscriberCount(EventType type) const
+    // Start tracing every published and queued event into a ring of 'capacity'
+    // records; replaces (and discards) an active recording
+    void StartRecording(size_t capacity = EventRecorder::DEFAULT_CAPACITY)
     {
+        auto recorder = std::make_unique<EventRecorder>(capacity);
         std::lock_guard<std::mutex> lock(m_mutex);
-        
-        size_t count = 0;
-        auto it = m_subscribers.find(type);
-        if (it != m_subscribers.end()) {
-            for (const auto& [priority, subscriptions] : it->second) {
-                count += subscriptions.size();
-            }
+        if (const EventRecorder* previous = m_recorder.exchange(recorder.release(), std::memory_order_seq_cst)) {
+            m_rcu.Retire(previous);
         }
-        return count;
     }
 
-private:
-    struct Subscription
+    // Stop tracing and discard the recording
+    void StopRecording()
     {
-        SubscriptionId id;
-        EventCallbackFn callback;
-    };
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (const EventRecorder* previous = m_recorder.exchange(nullptr, std::memory_order_seq_cst)) {
+            m_rcu.Retire(previous);
+        }
+    }
 
-    struct CategorySubscription
+    bool IsRecording() const { return m_recorder.load(std::memory_order_relaxed) != nullptr; }
+
+    // Write the recording as a trace file (EventRecorder::Save, throws on I/O errors);
+    // false if not recording. Recording continues.
+    bool SaveRecording(const std::string& path) const
     {
-        SubscriptionId id;
-        int categoryFlags;
-        EventCallbackFn callback;
-    };
+        // The ReadScope keeps a replaced recorder alive until the copy is written. No
+        // lock is held: publishing and subscribing continue meanwhile (an Unsubscribe
+        // on another thread waits for the save, like for any in-flight Publish).
+        RcuDomain::ReadScope scope(m_rcu);
+        const EventRecorder* recorder = m_recorder.load(std::memory_order_seq_cst);
+        if (!recorder) {
+            return false;
+        }
+        recorder->Save(path);
+        return true;
+    }
+
+    // Get subscriber count for debugging (EventType and typed channel subscribers)
+    size_t GetSubscriberCount(EventType type) const
+    {
+        const size_t typeIndex = static_cast<size_t>(type);
+        if (typeIndex >= EventTypeCount) return 0;
+        
+        RcuDomain::ReadScope scope(m_rcu);
+        size_t count = CountTypeSubscribers(*m_table.load(std::memory_order_seq_cst), typeIndex);
+        if (const IEventChannel* channel = m_channels[typeIndex].load(std::memory_order_acquire)) {
+            count += channel->GetSubscriberCount();
+        }
+        return count;
+    }
 
-    // Helper to get event type name
+    // Name of an event type (for debug output and tools)
     static std::string GetEventTypeName(EventType type)
     {
         switch (type) {
@@ -299,10 +414,203 @@ private:
             case EventType::MouseButtonReleased: return "MouseButtonReleased";
             case EventType::MouseMoved: return "MouseMoved";
             case EventType::MouseScrolled: return "MouseScrolled";
+            case EventType::ComponentAdded: return "ComponentAdded";
+            case EventType::ComponentRemoved: return "ComponentRemoved";
+            case EventType::EntityDestroyed: return "EntityDestroyed";
+            case EventType::ComponentsAdded: return "ComponentsAdded";
+            case EventType::ComponentsRemoved: return "ComponentsRemoved";
+            case EventType::EntitiesDestroyed: return "EntitiesDestroyed";
+            case EventType::EntityEnabledChanged: return "EntityEnabledChanged";
             default: return "Unknown";
         }
     }
 
+private:
+    template<typename T>
+    friend class EventChannel;
+
+    static constexpr size_t PRIORITY_COUNT = static_cast<size_t>(EventPriority::Low) + 1;
+
+    struct Subscription
+    {
+        SubscriptionId id;
+        EventCallbackFn callback;
+    };
+
+    struct CategorySubscription
+    {
+        SubscriptionId id;
+        int categoryFlags;
+        EventCallbackFn callback;
+    };
+
+    // Subscriptions by priority, dispatched in index order (High -> Normal -> Low)
+    template<typename SubscriptionT>
+    using PriorityLists = std::array<std::vector<SubscriptionT>, PRIORITY_COUNT>;
+
+    // Immutable once published through m_table. Lists are shared with the tables
+    // before and after it, so a change copies only the lists it touches.
+    struct SubscriberTable
+    {
+        std::array<std::shared_ptr<const PriorityLists<Subscription>>, EventTypeCount> byType;
+        std::shared_ptr<const PriorityLists<CategorySubscription>> byCategory;
+    };
+
+    // After an unsubscribe: wait out the Publish calls that may still hold the
+    // removed callback, unless this thread is inside one of them
+    void WaitForPublishers() const
+    {
+        if (!m_rcu.IsReadingOnThisThread()) {
+            m_rcu.Synchronize();
+        }
+    }
+
+    // Copy the current table, let 'mutate' edit the copy (returns false for no
+    // change) and publish it. Caller holds m_mutex.
+    template<typename Mutate>
+    void UpdateTable(Mutate&& mutate)
+    {
+        auto next = std::make_unique<SubscriberTable>(*m_table.load(std::memory_order_relaxed));
+        if (!mutate(*next)) {
+            return;
+        }
+        
+        m_rcu.Retire(m_table.exchange(next.release(), std::memory_order_seq_cst));
+    }
+
+    // Run 'dispatch(size_t* channelSubscribers)' (returns whether the event was handled)
+    // and record it if a recording is active. The subscriber count comes from the
+    // snapshots the dispatch used: 'table' and the channel list it reports through
+    // the pointer (null when not recording). Caller holds a ReadScope.
+    template<typename DispatchFn>
+    bool Dispatch(const Event& event, const SubscriberTable& table, size_t typeIndex, DispatchFn&& dispatch)
+    {
+        EventRecorder* recorder = m_recorder.load(std::memory_order_seq_cst);
+        if (!recorder) {
+            return dispatch(nullptr);
+        }
+        
+        size_t channelSubscribers = 0;
+        const EventRecorder::Clock::time_point start = EventRecorder::Clock::now();
+        const bool handled = dispatch(&channelSubscribers);
+        const EventRecorder::Clock::time_point end = EventRecorder::Clock::now();
+        const size_t subscribers = channelSubscribers + (typeIndex < EventTypeCount ? CountTypeSubscribers(table, typeIndex) : 0);
+        recorder->RecordPublished(event, start, end, subscribers, handled);
+        return handled;
+    }
+
+    // EventType subscribers of 'typeIndex' in 'table' (not category or channel ones)
+    static size_t CountTypeSubscribers(const SubscriberTable& table, size_t typeIndex)
+    {
+        size_t count = 0;
+        if (table.byType[typeIndex]) {
+            for (const auto& subscriptions : *table.byType[typeIndex]) {
+                count += subscriptions.size();
+            }
+        }
+        return count;
+    }
+
+    void RecordQueued(EventType type)
+    {
+        if (!m_recorder.load(std::memory_order_relaxed)) {
+            return;
+        }
+        RcuDomain::ReadScope scope(m_rcu);
+        if (EventRecorder* recorder = m_recorder.load(std::memory_order_seq_cst)) {
+            recorder->RecordQueued(type);
+        }
+    }
+
+    void CountPublished(const Event& event, size_t typeIndex)
+    {
+        m_totalPublished.fetch_add(1, std::memory_order_relaxed);
+        if (typeIndex < EventTypeCount) {
+            m_countByType[typeIndex].fetch_add(1, std::memory_order_relaxed);
+        }
+        
+        if (IsDebugMode()) {
+            LogDebug("Publishing: " + std::string(event.GetName()));
+        }
+    }
+
+    // EventType subscribers, then category subscribers (each High -> Normal -> Low) of
+    // 'table'; true if one handled the event. Caller holds a ReadScope.
+    bool DispatchUntyped(Event& event, size_t typeIndex, const SubscriberTable& table) const
+    {
+        if (typeIndex < EventTypeCount && table.byType[typeIndex]) {
+            for (const auto& subscriptions : *table.byType[typeIndex]) {
+                for (const auto& subscription : subscriptions) {
+                    subscription.callback(event);
+                    if (event.Handled) {
+                        if (IsDebugMode()) {
+                            LogDebug("  -> Handled by subscriber (ID: " + std::to_string(subscription.id) + ")");
+                        }
+                        return true;
+                    }
+                }
+            }
+        }
+        
+        if (table.byCategory) {
+            int categoryFlags = event.GetCategoryFlags();
+            for (const auto& subscriptions : *table.byCategory) {
+                for (const auto& subscription : subscriptions) {
+                    if (categoryFlags & subscription.categoryFlags) {
+                        subscription.callback(event);
+                        if (event.Handled) {
+                            if (IsDebugMode()) {
+                                LogDebug("  -> Handled by category subscriber (ID: " + std::to_string(subscription.id) + ")");
+                            }
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    // Channel<T>().Publish(event)
+    template<typename T>
+    void PublishTyped(const EventChannel<T>& channel, T& event)
+    {
+        RcuDomain::ReadScope scope(m_rcu);
+        
+        constexpr size_t typeIndex = static_cast<size_t>(T::GetStaticType());
+        CountPublished(event, typeIndex);
+        
+        const SubscriberTable& table = *m_table.load(std::memory_order_seq_cst);
+        bool handled = Dispatch(event, table, typeIndex, [&](size_t* channelSubscribers) {
+            return channel.Dispatch(event, channelSubscribers) || DispatchUntyped(event, typeIndex, table);
+        });
+        if (handled) {
+            m_totalHandled.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Copy-on-write removal; false if 'id' isn't in the lists
+    template<typename SubscriptionT>
+    static bool RemoveSubscription(std::shared_ptr<const PriorityLists<SubscriptionT>>& lists, SubscriptionId id)
+    {
+        auto matches = [id](const SubscriptionT& sub) { return sub.id == id; };
+        bool found = std::any_of(lists->begin(), lists->end(), [&](const std::vector<SubscriptionT>& subscriptions) {
+            return std::any_of(subscriptions.begin(), subscriptions.end(), matches);
+        });
+        if (!found) {
+            return false;
+        }
+        
+        auto copy = std::make_shared<PriorityLists<SubscriptionT>>(*lists);
+        for (auto& subscriptions : *copy) {
+            subscriptions.erase(std::remove_if(subscriptions.begin(), subscriptions.end(), matches), subscriptions.end());
+        }
+        lists = std::move(copy);
+        return true;
+    }
+
+    bool IsDebugMode() const { return m_debugMode.load(std::memory_order_relaxed); }
+
     // Helper to get priority name
     static std::string GetPriorityName(EventPriority priority)
     {
@@ -325,19 +633,34 @@ private:
         #endif
     }
 
+    // Serializes subscription changes, table reclamation, recorder replacement and
+    // the event queue; never taken by Publish
     mutable std::mutex m_mutex;
-    SubscriptionId m_nextId;
-    bool m_debugMode;
-    EventStats m_stats;
+    SubscriptionId m_nextId = 0;
+    std::atomic<bool> m_debugMode{ false };
     
-    // EventType -> Priority -> Subscriptions
-    std::unordered_map<EventType, std::unordered_map<int, std::vector<Subscription>>> m_subscribers;
+    // Current subscriber table; replaced tables (and channel lists) are freed by
+    // m_rcu once no Publish is in flight
+    std::atomic<const SubscriberTable*> m_table;
+    RcuDomain m_rcu;
     
-    // Priority -> Category Subscriptions
-    std::unordered_map<int, std::vector<CategorySubscription>> m_categorySubscribers;
+    // Typed channels by EventType (see Channel<T>)
+    std::array<std::atomic<IEventChannel*>, EventTypeCount> m_channels{};
+    std::array<std::unique_ptr<IEventChannel>, EventTypeCount> m_ownedChannels;
     
-    // Event queue for deferred processing
+    // Active recording (freed through m_rcu like the subscriber tables)
+    std::atomic<EventRecorder*> m_recorder{ nullptr };
+    
+    // Statistics (relaxed counters, see GetStats)
+    alignas(64) std::atomic<size_t> m_totalPublished{ 0 };
+    std::atomic<size_t> m_totalHandled{ 0 };
+    std::array<std::atomic<size_t>, EventTypeCount> m_countByType{};
+    
+    // Deferred events: the frame arena, and the heap queue for QueueEvent(unique_ptr)
+    // (guarded by m_mutex)
+    DeferredEventQueue m_deferredEvents;
     std::vector<std::unique_ptr<Event>> m_eventQueue;
+    std::mutex m_processMutex; // One ProcessEvents at a time
 };
 
 // SubscriptionGuard destructor implementation
@@ -347,3 +670,66 @@ inline SubscriptionGuard::~SubscriptionGuard()
         m_bus->Unsubscribe(m_type, m_id);
     }
 }
+
+// EventChannel members that need the bus
+template<typename T>
+typename EventChannel<T>::SubscriptionId EventChannel<T>::Subscribe(Callback callback, EventPriority priority)
+{
+    std::lock_guard<std::mutex> lock(m_bus.m_mutex);
+    
+    const SubscriptionId id = m_bus.m_nextId++;
+    auto next = std::make_unique<Subscribers>(*m_subscribers.load(std::memory_order_relaxed));
+    auto position = std::upper_bound(next->begin(), next->end(), priority,
+        [](EventPriority p, const Subscription& subscription) { return p < subscription.priority; });
+    next->insert(position, Subscription{ id, priority, std::move(callback) });
+    m_bus.m_rcu.Retire(m_subscribers.exchange(next.release(), std::memory_order_seq_cst));
+    
+    return id;
+}
+
+template<typename T>
+std::unique_ptr<SubscriptionGuard> EventChannel<T>::SubscribeGuarded(Callback callback, EventPriority priority)
+{
+    SubscriptionId id = Subscribe(std::move(callback), priority);
+    return std::make_unique<SubscriptionGuard>(&m_bus, T::GetStaticType(), id);
+}
+
+template<typename T>
+void EventChannel<T>::Unsubscribe(SubscriptionId id)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_bus.m_mutex);
+        RemoveSubscription(id);
+    }
+    m_bus.WaitForPublishers();
+}
+
+template<typename T>
+bool EventChannel<T>::RemoveSubscription(size_t id)
+{
+    const Subscribers& current = *m_subscribers.load(std::memory_order_relaxed);
+    auto matches = [id](const Subscription& subscription) { return subscription.id == id; };
+    if (std::none_of(current.begin(), current.end(), matches)) {
+        return false;
+    }
+    
+    auto next = std::make_unique<Subscribers>();
+    next->reserve(current.size() - 1);
+    std::copy_if(current.begin(), current.end(), std::back_inserter(*next),
+        [&](const Subscription& subscription) { return !matches(subscription); });
+    m_bus.m_rcu.Retire(m_subscribers.exchange(next.release(), std::memory_order_seq_cst));
+    return true;
+}
+
+template<typename T>
+void EventChannel<T>::Publish(T& event)
+{
+    m_bus.PublishTyped(*this, event);
+}
+
+template<typename T>
+size_t EventChannel<T>::GetSubscriberCount() const
+{
+    RcuDomain::ReadScope scope(m_bus.m_rcu);
+    return m_subscribers.load(std::memory_order_seq_cst)->size();
+}
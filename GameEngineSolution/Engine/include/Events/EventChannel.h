@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Event.h"
+#include "Delegate.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class EventBus;
+class SubscriptionGuard;
+
+// Type-erased channel interface: how EventBus reaches typed subscribers for events
+// published through the untyped EventBus::Publish(Event&)
+class IEventChannel
+{
+public:
+    virtual ~IEventChannel() = default;
+
+    // Typed subscribers for an event of this channel's type; true if one handled it.
+    // 'subscriberCount' (if set) receives the number of subscribers dispatched to.
+    virtual bool DispatchErased(Event& event, size_t* subscriberCount) const = 0;
+
+    // Remove a subscription; false if it isn't in this channel. Caller holds EventBus::m_mutex.
+    virtual bool RemoveSubscription(size_t id) = 0;
+
+    virtual size_t GetSubscriberCount() const = 0;
+};
+
+// ==================================================================================
+// EventChannel
+// ----------------------------------------------------------------------------------
+// Typed publish/subscribe for one event class, obtained from EventBus::Channel<T>().
+// The channel is found by T::GetStaticType() (a compile-time index into the bus's
+// channel array, no hashing), subscribers take T& directly (no static_cast from
+// Event&), and callbacks are Delegates (inline storage, no std::function).
+//
+// Subscribers are one flat array ordered by priority (High -> Normal -> Low, then
+// subscription order), read-copy-update like the bus's own lists: Publish is
+// lock-free and re-entrant.
+//
+// Channels and the untyped API see each other's traffic:
+// - Channel<T>().Publish(e) runs the typed subscribers, then (unless handled) the
+//   bus's EventType and category subscribers
+// - EventBus::Publish(e) runs the typed subscribers of e's channel first
+// - EventBus::Unsubscribe(type, id) and SubscriptionGuard work for channel ids
+//
+// Example Usage:
+//     auto& added = eventBus.Channel<ComponentAddedEvent>();
+//     added.Subscribe([this](ComponentAddedEvent& e) { Track(e.entity); });
+//     ComponentAddedEvent event(entity, typeid(TransformComponent));
+//     added.Publish(event);
+// ==================================================================================
+template<typename T>
+class EventChannel final : public IEventChannel
+{
+public:
+    using Callback = Delegate<void(T&)>;
+    using SubscriptionId = size_t;
+
+    explicit EventChannel(EventBus& bus)
+        : m_bus(bus)
+        , m_subscribers(new Subscribers())
+    {
+    }
+
+    ~EventChannel() override
+    {
+        delete m_subscribers.load(std::memory_order_relaxed);
+    }
+
+    EventChannel(const EventChannel&) = delete;
+    EventChannel& operator=(const EventChannel&) = delete;
+
+    // Defined in EventBus.h (they need the bus's lock, ids and reclamation)
+    SubscriptionId Subscribe(Callback callback, EventPriority priority = EventPriority::Normal);
+    std::unique_ptr<SubscriptionGuard> SubscribeGuarded(Callback callback, EventPriority priority = EventPriority::Normal);
+    void Unsubscribe(SubscriptionId id);
+    void Publish(T& event);
+    size_t GetSubscriberCount() const override;
+
+    bool DispatchErased(Event& event, size_t* subscriberCount) const override
+    {
+        return Dispatch(static_cast<T&>(event), subscriberCount);
+    }
+
+private:
+    friend class EventBus;
+
+    struct Subscription
+    {
+        SubscriptionId id;
+        EventPriority priority;
+        Callback callback;
+    };
+
+    // Sorted by priority; immutable once published through m_subscribers
+    using Subscribers = std::vector<Subscription>;
+
+    // Typed subscribers only; caller holds a ReadScope of the bus
+    bool Dispatch(T& event, size_t* subscriberCount) const
+    {
+        const Subscribers& subscribers = *m_subscribers.load(std::memory_order_seq_cst);
+        if (subscriberCount) {
+            *subscriberCount = subscribers.size();
+        }
+        for (const Subscription& subscription : subscribers) {
+            subscription.callback(event);
+            if (event.Handled) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool RemoveSubscription(size_t id) override;
+
+    EventBus& m_bus;
+    std::atomic<const Subscribers*> m_subscribers;
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Event.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ECS { struct EntityHandle; }
+
+// One traced event. Timestamps are nanoseconds since the recording started.
+struct EventTraceRecord
+{
+    static constexpr size_t MAX_PAYLOAD = 16;
+
+    enum Flags : uint8_t
+    {
+        Queued  = 1 << 0, // Recorded by QueueEvent (no dispatch; its Publish is a separate record)
+        Handled = 1 << 1  // A subscriber set Event::Handled
+    };
+
+    uint64_t timestampNs = 0;
+    uint32_t handlingNs = 0;      // Time spent in subscribers (includes nested publishes)
+    EventType type = EventType::None;
+    uint8_t flags = 0;
+    uint16_t subscriberCount = 0; // EventType + typed channel subscribers at dispatch
+    uint8_t payloadSize = 0;
+    std::array<std::byte, MAX_PAYLOAD> payload{};
+};
+
+// Event fields needed to rebuild it for replay (see DecodeTracedEvent); returns the size written
+size_t EncodeEventPayload(const Event& event, std::array<std::byte, EventTraceRecord::MAX_PAYLOAD>& payload);
+
+// Rebuild a recorded event, or nullptr for a type without a decoder. Batched ECS
+// events view 'entities', which is resized to the recorded count (only the first
+// entity is recorded, the rest are null). Component types are not recorded:
+// rebuilt events carry typeid(void).
+std::unique_ptr<Event> DecodeTracedEvent(const EventTraceRecord& record, std::vector<ECS::EntityHandle>& entities);
+
+// Binary trace file (little-endian): "EVTR", version, record count, dropped count,
+// then the records with only 'payloadSize' payload bytes each. Both throw
+// std::runtime_error on I/O or format errors.
+void SaveEventTrace(const std::string& path, const std::vector<EventTraceRecord>& records, uint64_t droppedCount);
+std::vector<EventTraceRecord> LoadEventTrace(const std::string& path, uint64_t* droppedCount = nullptr);
+
+// ==================================================================================
+// EventRecorder
+// ----------------------------------------------------------------------------------
+// In-memory ring of the last 'capacity' events an EventBus published or queued
+// (see EventBus::StartRecording). Recording is lock-free from any thread: a writer
+// claims a slot with one fetch_add and marks it with a sequence number (seqlock),
+// and GetRecords() skips slots that are being overwritten while it copies them.
+//
+// Save() writes the ring as a trace file for the EventReplay tool.
+// ==================================================================================
+class EventRecorder
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t DEFAULT_CAPACITY = 1 << 16; // Records (~3 MB)
+
+    // 'capacity' is rounded up to a power of two
+    explicit EventRecorder(size_t capacity = DEFAULT_CAPACITY);
+
+    EventRecorder(const EventRecorder&) = delete;
+    EventRecorder& operator=(const EventRecorder&) = delete;
+
+    void RecordPublished(const Event& event, Clock::time_point start, Clock::time_point end, size_t subscriberCount, bool handled);
+    void RecordQueued(EventType type);
+
+    // Records still in the ring, oldest first
+    std::vector<EventTraceRecord> GetRecords() const;
+
+    uint64_t GetRecordedCount() const { return m_next.load(std::memory_order_relaxed); }
+    uint64_t GetDroppedCount() const;
+    size_t GetCapacity() const { return m_slots.size(); }
+
+    void Save(const std::string& path) const;
+
+private:
+    struct Slot
+    {
+        std::atomic<uint64_t> sequence{ 0 }; // Record index + 1 once written (0: empty)
+        EventTraceRecord record;
+    };
+
+    uint64_t Nanoseconds(Clock::time_point time) const;
+    void Write(const EventTraceRecord& record);
+
+    std::vector<Slot> m_slots;
+    Clock::time_point m_start;
+    alignas(64) std::atomic<uint64_t> m_next{ 0 };
+};
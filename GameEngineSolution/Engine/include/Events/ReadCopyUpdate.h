@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ==================================================================================
+// RcuDomain
+// ----------------------------------------------------------------------------------
+// Deferred reclamation for read-copy-update data: readers load an immutable
+// snapshot through an atomic pointer inside a ReadScope and never lock; a writer
+// swaps in a new snapshot and Retire()s the old one, which is freed once no
+// ReadScope is active. Used by EventBus and EventChannel for their subscriber lists.
+//
+// Readers are wait-free (one atomic increment and decrement). Writers must be
+// serialized by the owner (EventBus::m_mutex) and never wait for readers, so they
+// may run inside a ReadScope (a callback that subscribes); retired snapshots then
+// wait for a later Reclaim().
+//
+// Synchronize() is the one waiting call: made after unlinking (and outside the
+// writer lock), it returns once every ReadScope that could still see the old
+// snapshot has ended. Readers count into one of two counters chosen by a phase
+// bit; Synchronize flips the phase and waits for the counter it left, twice (once
+// per counter), so a steady stream of new readers cannot hold it up.
+//
+// Correctness: Reclaim() runs after every retired snapshot was unlinked. A reader
+// that registers after Reclaim() read the counts also loads the pointer after it
+// (all seq_cst), so it sees a current snapshot; counts of zero mean no earlier
+// reader is left. A reader stays on the counter it registered with, so one that
+// spans both reads is seen by one of them. The same argument covers Synchronize():
+// a reader that registers on a counter after it was seen at zero loads the pointer
+// after the unlink; every reader registered before the second wait is waited for.
+// ==================================================================================
+class RcuDomain
+{
+public:
+    class ReadScope
+    {
+    public:
+        explicit ReadScope(const RcuDomain& domain)
+            : m_domain(domain)
+            , m_outer(t_innermost)
+        {
+            const uint32_t phase = domain.m_phase.load(std::memory_order_seq_cst);
+            m_readers = &domain.m_readers[phase].count;
+            m_readers->fetch_add(1, std::memory_order_seq_cst);
+            t_innermost = this;
+        }
+        ~ReadScope()
+        {
+            t_innermost = m_outer;
+            m_readers->fetch_sub(1, std::memory_order_seq_cst);
+        }
+
+        ReadScope(const ReadScope&) = delete;
+        ReadScope& operator=(const ReadScope&) = delete;
+
+    private:
+        friend class RcuDomain;
+
+        const RcuDomain& m_domain;
+        const ReadScope* m_outer;
+        std::atomic<uint32_t>* m_readers = nullptr;
+    };
+
+    // Hand over a snapshot that was just unlinked from its atomic pointer. Writer only.
+    template<typename T>
+    void Retire(const T* snapshot)
+    {
+        m_retired.emplace_back(snapshot, [](const void* retired) { delete static_cast<const T*>(retired); });
+        Reclaim();
+    }
+
+    // Free retired snapshots if no reader is active. Writer only.
+    void Reclaim()
+    {
+        if (!m_retired.empty() && !HasReaders()) {
+            m_retired.clear();
+        }
+    }
+
+    // Wait until every ReadScope that started before this call has ended. Call after
+    // unlinking, without holding the writer lock, and never from inside a ReadScope
+    // of this domain on the calling thread (see IsReadingOnThisThread): that scope
+    // could never end.
+    void Synchronize() const
+    {
+        std::lock_guard<std::mutex> lock(m_synchronizeMutex);
+        // Twice: a reader that read the phase before an earlier flip may have
+        // registered on the current counter and still hold the old snapshot
+        for (int flip = 0; flip < 2; ++flip) {
+            const uint32_t previous = m_phase.fetch_xor(1, std::memory_order_seq_cst);
+            while (m_readers[previous].count.load(std::memory_order_seq_cst) != 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // True if the calling thread is inside a ReadScope of this domain (a callback)
+    bool IsReadingOnThisThread() const
+    {
+        for (const ReadScope* scope = t_innermost; scope; scope = scope->m_outer) {
+            if (&scope->m_domain == this) return true;
+        }
+        return false;
+    }
+
+    size_t GetRetiredCount() const { return m_retired.size(); }
+
+private:
+    bool HasReaders() const
+    {
+        return m_readers[0].count.load(std::memory_order_seq_cst) != 0 ||
+               m_readers[1].count.load(std::memory_order_seq_cst) != 0;
+    }
+
+    struct alignas(64) ReaderCount
+    {
+        std::atomic<uint32_t> count{ 0 };
+    };
+
+    static inline thread_local const ReadScope* t_innermost = nullptr;
+
+    mutable ReaderCount m_readers[2];
+    alignas(64) mutable std::atomic<uint32_t> m_phase{ 0 };
+    mutable std::mutex m_synchronizeMutex; // One phase flip at a time
+    std::vector<std::unique_ptr<const void, void(*)(const void*)>> m_retired;
+};
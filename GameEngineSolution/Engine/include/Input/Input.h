@@ -43,6 +43,10 @@ public:
 
     int GetMouseDeltaX() const;
     int GetMouseDeltaY() const;
+
+    // Mouse movement since the previous call, summed over Update() calls: a fixed-step
+    // simulation sees every movement exactly once however many ticks a frame runs
+    void ConsumeMouseDelta(int& dx, int& dy);
     int GetMouseX() const;
     int GetMouseY() const;
 
@@ -54,6 +58,8 @@ private:
     bool m_keys[256];
     bool m_isMouseLocked = false;
     MouseState m_mouseState;
+    int m_pendingDx = 0; // Not yet consumed by the simulation
+    int m_pendingDy = 0;
     std::unordered_map<Action, int> m_actionBindings;
     std::function<void(Event&)> m_EventCallback;
 };
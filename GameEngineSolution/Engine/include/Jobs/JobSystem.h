@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Jobs {
+
+// ==================================================================================
+// JobCounter
+// ----------------------------------------------------------------------------------
+// Counts jobs that are still pending. Each Run() increments it and each finished job
+// decrements it; Wait() returns once it reaches zero.
+// The first exception thrown by one of its jobs is rethrown from Wait().
+// ==================================================================================
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+    std::atomic<uint32_t> m_pending{ 0 };
+    std::mutex m_exceptionMutex;
+    std::exception_ptr m_exception;
+};
+
+// ==================================================================================
+// JobSystem
+// ----------------------------------------------------------------------------------
+// Persistent pool of worker threads created once and reused every frame.
+//
+// Scheduling:
+// - Every worker owns a deque. Jobs spawned from a worker go to the back of its own
+//   deque and are popped LIFO (cache-warm); idle workers steal FIFO from the front
+//   of other workers' deques
+// - Jobs spawned from other threads (e.g. the main thread) go to a shared injection
+//   queue that every worker drains
+// - The thread calling Wait() participates: it runs injected and stolen jobs until
+//   its counter reaches zero. When nothing is left to run but jobs are still in
+//   flight it spins briefly, then blocks until a job finishes or is queued
+// - Workers with nothing to run sleep on a condition variable
+//
+// Example Usage:
+//     Jobs::JobCounter counter;
+//     jobSystem.Run([]{ ... }, counter);
+//     jobSystem.Run([]{ ... }, counter);
+//     jobSystem.Wait(counter);
+// ==================================================================================
+class JobSystem {
+public:
+    using Job = std::function<void()>;
+
+    // workerCount = 0 uses (hardware threads - 1), leaving a core for the main thread
+    explicit JobSystem(uint32_t workerCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Engine-wide instance
+    static JobSystem& Get();
+
+    // Queue a job; 'counter' is decremented when it finishes
+    void Run(Job job, JobCounter& counter);
+
+    // Execute queued jobs on the calling thread until 'counter' reaches zero
+    void Wait(JobCounter& counter);
+
+    uint32_t GetWorkerCount() const { return m_workerCount; }
+
+    // Per-thread slot for lock-free per-thread data: workers get 0 .. workerCount-1,
+    // every other thread shares slot workerCount (only one non-worker thread may use it)
+    uint32_t GetCurrentThreadIndex() const { return GetCurrentQueue(); }
+    uint32_t GetThreadSlotCount() const { return m_workerCount + 1; }
+
+private:
+    struct QueuedJob {
+        Job job;
+        JobCounter* counter = nullptr;
+    };
+
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<QueuedJob> jobs;
+    };
+
+    void WorkerLoop(uint32_t workerIndex);
+    bool TryRunOne(uint32_t ownQueue);
+    bool TryPopOwn(uint32_t queueIndex, QueuedJob& out);
+    bool TrySteal(uint32_t queueIndex, QueuedJob& out);
+    uint32_t GetCurrentQueue() const;
+    static void Execute(QueuedJob& queued);
+    void SignalWaiters();
+
+    // m_queues[0 .. workerCount-1] belong to the workers; m_queues[workerCount] is the
+    // injection queue for jobs spawned from non-worker threads
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;
+    std::vector<std::thread> m_workers;
+    uint32_t m_workerCount = 0;
+
+    std::atomic<uint32_t> m_queuedJobs{ 0 };
+    std::atomic<uint32_t> m_sleepingWorkers{ 0 };
+    std::atomic<uint32_t> m_stealCursor{ 0 };
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeCondition;
+    std::atomic<bool> m_shutdown{ false };
+
+    // Threads blocked in Wait() sleep on m_waitEpoch, bumped when a job is queued or finishes
+    std::atomic<uint32_t> m_blockedWaiters{ 0 };
+    std::atomic<uint32_t> m_waitEpoch{ 0 };
+};
+
+} // namespace Jobs
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "JobSystem.h"
+#include "../ECS/ComponentManager.h"
+#include "../ECS/Group.h"
+#include <algorithm>
+#include <cstddef>
+
+namespace Jobs {
+
+// ==================================================================================
+// ParallelFor
+// ----------------------------------------------------------------------------------
+// Splits [0, count) into ranges of 'grainSize' elements and runs fn(begin, end) for
+// each range on the JobSystem. The calling thread processes the first range itself
+// and then helps with the rest; the call returns once every range has finished.
+//
+// The ComponentArray overload runs fn(Entity, T&) for every enabled entity in the
+// dense array of 'componentManager' and marks each visited component as changed (see
+// ComponentArray change tracking); disabled entities (ComponentManager::SetEntityEnabled)
+// are skipped. The array must not be structurally modified (insert/remove) while it
+// runs. The Group overload does the same for fn(Entity, Owned&...) over an owning
+// group's members.
+//
+// Choosing grainSize: large enough that one range costs far more than scheduling a
+// job (see the Benchmarks project), small enough to give every worker several ranges.
+//
+// Example Usage:
+//     Jobs::ParallelFor(componentManager, *physicsArray, 256, [dt](ECS::Entity, ECS::PhysicsComponent& physics) {
+//         physics.velocity.y += physics.gravityAcceleration * dt;
+//     });
+// ==================================================================================
+template<typename Func>
+void ParallelFor(size_t count, size_t grainSize, Func&& fn, JobSystem& jobSystem = JobSystem::Get()) {
+    if (count == 0) return;
+    if (grainSize == 0) grainSize = 1;
+
+    // Single range: not worth a job
+    if (count <= grainSize) {
+        fn(size_t{ 0 }, count);
+        return;
+    }
+
+    JobCounter counter;
+    for (size_t begin = grainSize; begin < count; begin += grainSize) {
+        size_t end = (std::min)(begin + grainSize, count);
+        jobSystem.Run([&fn, begin, end]() { fn(begin, end); }, counter);
+    }
+
+    // Jobs reference 'fn', so they must finish before an exception leaves this frame
+    try {
+        fn(size_t{ 0 }, grainSize);
+    } catch (...) {
+        try { jobSystem.Wait(counter); } catch (...) {}
+        throw;
+    }
+    jobSystem.Wait(counter);
+}
+
+template<typename T, typename Func>
+void ParallelFor(const ECS::ComponentManager& componentManager, ECS::ComponentArray<T>& array, size_t grainSize, Func&& fn,
+                 JobSystem& jobSystem = JobSystem::Get()) {
+    std::vector<T>& components = array.GetComponentArray();
+    const std::vector<ECS::Entity>& entities = array.GetEntityArray();
+
+    ParallelFor(components.size(), grainSize, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (!componentManager.IsEntityEnabled(entities[i])) continue;
+            array.MarkChangedAtIndex(i);
+            fn(entities[i], components[i]);
+        }
+    }, jobSystem);
+}
+
+template<typename... Owned, typename Func>
+void ParallelFor(const ECS::Group<Owned...>& group, size_t grainSize, Func&& fn, JobSystem& jobSystem = JobSystem::Get()) {
+    ParallelFor(group.Size(), grainSize, [&](size_t begin, size_t end) {
+        group.EachInRange(begin, end, fn);
+    }, jobSystem);
+}
+
+} // namespace Jobs
@@ -15,3 +15,20 @@ inline bool AABBIntersects(const AABB& a, const AABB& b)
     if (fabsf(a.center.z - b.center.z) > (a.extents.z + b.extents.z)) return false;
     return true;
 }
+
+// World-space AABB enclosing 'local' transformed by an affine matrix (row-vector convention)
+inline AABB TransformAABB(const AABB& local, DirectX::FXMMATRIX world)
+{
+    using namespace DirectX;
+    XMVECTOR center = XMVector3TransformCoord(XMLoadFloat3(&local.center), world);
+
+    // Extents along each world axis: |M| * extents
+    XMVECTOR extents = XMVectorMultiply(XMVectorAbs(world.r[0]), XMVectorReplicate(local.extents.x));
+    extents = XMVectorMultiplyAdd(XMVectorAbs(world.r[1]), XMVectorReplicate(local.extents.y), extents);
+    extents = XMVectorMultiplyAdd(XMVectorAbs(world.r[2]), XMVectorReplicate(local.extents.z), extents);
+
+    AABB result;
+    XMStoreFloat3(&result.center, center);
+    XMStoreFloat3(&result.extents, extents);
+    return result;
+}
@@ -27,6 +27,10 @@ public:
     Mesh& operator=(const Mesh&) = delete;
 
     void Draw(ID3D11DeviceContext* context) const;
+
+    // Batched drawing: Bind() once, then DrawBound() per instance
+    void Bind(ID3D11DeviceContext* context) const;
+    void DrawBound(ID3D11DeviceContext* context) const;
     
     // Accessors for collision generation
     const std::vector<Vertex>& GetVertices() const { return m_vertices; }
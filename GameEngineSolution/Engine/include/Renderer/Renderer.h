@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <vector>
 #include <DirectXMath.h>
 #include <wrl/client.h>
@@ -37,30 +38,41 @@ class AssetManager; // Forward Declaration
 // Responsible for:
 // - Managing D3D11 resources (Shaders, Buffers, Textures)
 // - Implementing the rendering passes (Shadow Pass -> Main Pass -> Post Process)
-// - Drawing meshes with materials and lighting
+// - Drawing batches of instances that share a mesh and material (one state bind
+//   per batch, see RenderBatch)
 // - Debug rendering (Wireframe AABBs)
 // ==================================================================================
 class Renderer
 {
 public:
+    // Per-entity draw data; mesh and material come from the batch
     struct RenderInstance
     {
-        Mesh* mesh = nullptr;
-        Material* material = nullptr;
-        DirectX::XMFLOAT3 position = { 0.0f, 0.0f, 0.0f };
-        DirectX::XMFLOAT3 rotation = { 0.0f, 0.0f, 0.0f };
-        DirectX::XMFLOAT3 scale = { 1.0f, 1.0f, 1.0f };
+        DirectX::XMFLOAT4X4 world = {   // Local-to-world (from WorldMatrixComponent)
+            1.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f };
         AABB worldAABB{};
         bool hasBounds = false;
     };
 
+    // Instances drawn with the same mesh and material (callers group them up front,
+    // e.g. RenderSystem from the shared RenderComponent buckets)
+    struct RenderBatch
+    {
+        Mesh* mesh = nullptr;
+        Material* material = nullptr;
+        std::span<const RenderInstance> instances;
+    };
+
     Renderer();
     ~Renderer();
 
     void Initialize(Graphics* graphics, AssetManager* assetManager, int width, int height);
     void RenderFrame(
         const Camera& camera,
-        const std::vector<const RenderInstance*>& instances,
+        const std::vector<RenderBatch>& batches,
         const DirectionalLight& dirLight,
         const std::vector<PointLight>& pointLights
     );
@@ -74,10 +86,19 @@ public:
 
 private:
     void InitPipeline(int width, int height);
-    void RenderShadowPass(const std::vector<const RenderInstance*>& instances, DirectX::XMMATRIX& outLightView, DirectX::XMMATRIX& outLightProj);
+    // Batch after frustum culling: [begin, begin + count) of m_visibleInstances
+    struct VisibleBatch
+    {
+        Mesh* mesh = nullptr;
+        Material* material = nullptr;
+        size_t begin = 0;
+        size_t count = 0;
+    };
+
+    void CullBatches(const Camera& camera, const std::vector<RenderBatch>& batches);
+    void RenderShadowPass(DirectX::XMMATRIX& outLightView, DirectX::XMMATRIX& outLightProj);
     void RenderMainPass(
         const Camera& camera,
-        const std::vector<const RenderInstance*>& instances,
         const DirectX::XMMATRIX& lightViewProj,
         const DirectionalLight& dirLight,
         const std::vector<PointLight>& pointLights
@@ -118,4 +139,8 @@ private:
     
     // Matrices
     DirectX::XMMATRIX m_projectionMatrix;
+
+    // Culling results of the current frame (reused every frame)
+    std::vector<VisibleBatch> m_visibleBatches;
+    std::vector<const RenderInstance*> m_visibleInstances;
 };
@@ -5,7 +5,9 @@
 #include "../ECS/Components.h"
 #include <unordered_map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 #include <DirectXMath.h>
 
 // Forward declarations
@@ -13,6 +15,8 @@ class Mesh;
 class Material;
 class AssetManager;
 
+namespace ECS { class EntityBuilder; }
+
 // ==================================================================================
 // SceneLoader Class
 // ----------------------------------------------------------------------------------
@@ -34,6 +38,11 @@ class AssetManager;
 //     }
 //   ]
 // }
+//
+// Entity definitions are parsed in parallel on the JobSystem (parsing only reads the
+// JSON tree and the resource lookups); entities are then created in file order on
+// the calling thread, one component type at a time, inside a single ComponentManager
+// batch (listeners get one ComponentsAddedEvent per component type).
 // ==================================================================================
 class SceneLoader {
 public:
@@ -55,6 +64,44 @@ public:
     );
 
 private:
+    // Components parsed from one entity definition, not yet attached to an entity
+    struct ParsedEntity {
+        std::optional<ECS::TransformComponent> transform;
+        std::optional<ECS::RenderComponent> render;
+        std::optional<ECS::PhysicsComponent> physics;
+        std::optional<ECS::ColliderComponent> collider;
+        std::optional<ECS::LightComponent> light;
+        std::optional<ECS::RotateComponent> rotate;
+        std::optional<ECS::OrbitComponent> orbit;
+        std::optional<ECS::PlayerControllerComponent> playerController;
+        std::optional<ECS::CameraComponent> camera;
+        std::optional<ECS::HealthComponent> health;
+        std::optional<ECS::WeaponComponent> weapon;
+        std::optional<ECS::ProjectileComponent> projectile;
+    };
+
+    // Entity definitions per parse job
+    static constexpr size_t PARSE_GRAIN_SIZE = 32;
+
+    // Parse a "components" object (thread-safe: only reads its inputs)
+    static ParsedEntity ParseComponents(
+        const JsonValue& components,
+        const std::unordered_map<std::string, Mesh*>& meshLookup,
+        const std::unordered_map<std::string, std::shared_ptr<Material>>& materialLookup
+    );
+
+    // Attach parsed components to the entity being built
+    static void AddComponents(ECS::EntityBuilder& builder, const ParsedEntity& parsed);
+
+    // Bulk-add one component type to every entity whose definition has it
+    template<typename T>
+    static void AddComponentColumn(
+        ECS::ComponentManager& componentManager,
+        const std::vector<ECS::Entity>& entities,
+        const std::vector<std::optional<ParsedEntity>>& parsedEntities,
+        std::optional<T> ParsedEntity::* member
+    );
+
     // Parse resources section (meshes, materials)
     static void ParseResources(
         const JsonValue& resources, 
@@ -1,11 +1,13 @@
 #pragma once
 
 #include "../ECS/ComponentManager.h"
+#include "../ECS/RewindBuffer.h"
 #include "SimpleFont.h"
 
 // Forward declarations
 class UIRenderer;
 class Renderer;
+namespace ECS { class SystemManager; }
 
 // ========================================
 // DebugUIRenderer
@@ -31,7 +33,9 @@ public:
         bool bloomEnabled,
         bool debugCollisionEnabled,
         ECS::ComponentManager& componentManager,
-        ECS::Entity activeCamera = ECS::NULL_ENTITY
+        ECS::Entity activeCamera = ECS::NULL_ENTITY,
+        const ECS::RewindBuffer* rewindBuffer = nullptr,
+        const ECS::SystemManager* systemManager = nullptr
     );
 
     // Update timers
@@ -1,14 +1,33 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <fstream>
 #include <mutex>
 #include <memory>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <thread>
+#include <vector>
 
+// ==================================================================================
+// Logger
+// ----------------------------------------------------------------------------------
+// Asynchronous logger. A log call copies the message into a fixed-size record in
+// the calling thread's own ring buffer (single producer, lock-free) and returns; a
+// background thread drains all rings, orders the records by time, formats them and
+// writes the console, file and debugger output.
+//
+// - Messages longer than one record span several consecutive records
+// - A full ring drops the message; the writer reports how many were dropped
+// - Fatal() and Flush() write everything logged so far before returning; so do
+//   std::terminate and unhandled exceptions (crash handlers installed on startup)
+// ==================================================================================
 class Logger
 {
 public:
-    enum class Level
+    enum class Level : uint8_t
     {
         Debug,
         Info,
@@ -21,11 +40,14 @@ public:
     static Logger& Get();
 
     // Logging methods
-    void Debug(const std::string& message);
-    void Info(const std::string& message);
-    void Warning(const std::string& message);
-    void Error(const std::string& message, const char* file = nullptr, int line = 0);
-    void Fatal(const std::string& message, const char* file = nullptr, int line = 0);
+    void Debug(std::string_view message);
+    void Info(std::string_view message);
+    void Warning(std::string_view message);
+    void Error(std::string_view message, const char* file = nullptr, int line = 0);
+    void Fatal(std::string_view message, const char* file = nullptr, int line = 0);
+
+    // Write every message logged before the call (blocks until written)
+    void Flush();
 
     // Configuration
     void SetMinLevel(Level level);
@@ -37,21 +59,67 @@ public:
     Logger& operator=(const Logger&) = delete;
 
 private:
+    static constexpr size_t RECORD_SIZE = 128;
+    static constexpr size_t RING_CAPACITY = 1024; // Records per thread (power of two)
+
+    // One ring slot. A message longer than 'text' continues in the next slot(s).
+    struct Record
+    {
+        int64_t timestamp;        // system_clock ticks
+        const char* file;         // __FILE__ (static storage)
+        uint32_t line;
+        Level level;
+        bool continued;           // The message continues in the next record
+        uint16_t length;          // Bytes used in 'text'
+        char text[RECORD_SIZE - 24];
+    };
+    static_assert(sizeof(Record) == RECORD_SIZE, "Logger::Record: unexpected padding");
+
+    // Ring of one producer thread; drained by the writer thread (under m_drainMutex)
+    struct ThreadBuffer
+    {
+        alignas(64) std::atomic<uint64_t> head{ 0 }; // Next record to write (producer)
+        alignas(64) std::atomic<uint64_t> tail{ 0 }; // Next record to read (consumer)
+        std::atomic<bool> released{ false };         // Owning thread exited; reusable once empty
+        std::atomic<uint64_t> dropped{ 0 };          // Messages lost to a full ring
+        Record records[RING_CAPACITY];
+    };
+
     Logger();
     ~Logger();
 
-    void Log(Level level, const std::string& message, const char* file = nullptr, int line = 0);
-    std::string GetTimestamp() const;
+    void Log(Level level, std::string_view message, const char* file = nullptr, int line = 0);
+    ThreadBuffer& GetThreadBuffer();
+
+    // Writer side
+    void WriterLoop();
+    void Drain();
+    void FlushForCrash();
+    void Write(const Record& first, const std::string& message);
+    std::string FormatTimestamp(int64_t timestamp) const;
     std::string LevelToString(Level level) const;
     void SetConsoleColor(Level level);
     void ResetConsoleColor();
+    static void InstallCrashHandlers();
 
-    Level m_minLevel;
-    bool m_fileLoggingEnabled;
-    bool m_consoleEnabled;
+    std::atomic<Level> m_minLevel;
+    std::atomic<bool> m_fileLoggingEnabled;
+    std::atomic<bool> m_consoleEnabled;
     std::ofstream m_logFile;
-    std::mutex m_mutex;
     void* m_consoleHandle; // HANDLE type (void* to avoid including windows.h in header)
+
+    // Per-thread rings (owned here so records outlive their thread until written)
+    std::mutex m_buffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+
+    // Held while draining (writer thread or Flush) and writing output
+    std::timed_mutex m_drainMutex;
+    uint64_t m_reportedDropped = 0;
+
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    bool m_stopping = false;
+    std::thread m_writer;
 };
 
 // Convenience macros for easy logging
@@ -0,0 +1,204 @@
+#include "../../include/ECS/ArchetypeStorage.h"
+
+namespace ECS {
+
+namespace {
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+// ==================================================================================
+// Archetype
+// ==================================================================================
+
+Archetype::Archetype(const Signature& signature, const std::vector<ComponentTypeInfo>& typeInfos)
+    : m_signature(signature)
+{
+    m_columnOffsets.fill(INVALID_OFFSET);
+
+    size_t bytesPerEntity = sizeof(Entity);
+    for (uint32_t typeID = 0; typeID < MAX_COMPONENTS; ++typeID) {
+        if (!signature.test(typeID)) continue;
+
+        if (typeID >= typeInfos.size() || !typeInfos[typeID].IsValid()) {
+            throw std::runtime_error("Archetype created with unregistered component type.");
+        }
+
+        const ComponentTypeInfo& info = typeInfos[typeID];
+        m_typeIDs.push_back(typeID);
+        m_typeSizes[typeID] = static_cast<uint32_t>(info.size);
+        m_moveFns.push_back(info.moveConstruct);
+        m_destroyFns.push_back(info.destroy);
+        bytesPerEntity += info.size;
+    }
+
+    // Compute column layout for a given capacity, returns total bytes used
+    auto computeLayout = [&](size_t capacity) {
+        size_t offset = sizeof(Entity) * capacity;
+        for (uint32_t typeID : m_typeIDs) {
+            offset = AlignUp(offset, typeInfos[typeID].alignment);
+            m_columnOffsets[typeID] = static_cast<uint32_t>(offset);
+            offset += typeInfos[typeID].size * capacity;
+        }
+        return offset;
+    };
+
+    // Start from the ideal capacity and shrink until alignment padding fits
+    size_t capacity = CHUNK_SIZE / bytesPerEntity;
+    while (capacity > 0 && computeLayout(capacity) > CHUNK_SIZE) {
+        --capacity;
+    }
+
+    if (capacity == 0) {
+        throw std::runtime_error("Archetype components exceed chunk size.");
+    }
+
+    m_capacity = static_cast<uint32_t>(capacity);
+}
+
+// Chunks are raw bytes: destroy the components of every live row before they are freed
+Archetype::~Archetype() {
+    for (size_t index = 0; index < m_count; ++index) {
+        DestroyRow(static_cast<uint32_t>(index));
+    }
+}
+
+uint32_t Archetype::Allocate(Entity entity) {
+    size_t index = m_count;
+    size_t chunkIndex = index / m_capacity;
+
+    if (chunkIndex >= m_chunks.size()) {
+        m_chunks.push_back(std::make_unique<ChunkData>());
+    }
+
+    GetEntities(chunkIndex)[index % m_capacity] = entity;
+    m_count++;
+    return static_cast<uint32_t>(index);
+}
+
+Entity Archetype::RemoveRow(uint32_t index) {
+    uint32_t lastIndex = static_cast<uint32_t>(m_count - 1);
+    Entity movedEntity = NULL_ENTITY;
+
+    if (index != lastIndex) {
+        size_t dstChunk = index / m_capacity;
+        size_t srcChunk = lastIndex / m_capacity;
+        size_t dstRow = index % m_capacity;
+        size_t srcRow = lastIndex % m_capacity;
+
+        for (size_t i = 0; i < m_typeIDs.size(); ++i) {
+            uint32_t typeID = m_typeIDs[i];
+            size_t size = m_typeSizes[typeID];
+            m_moveFns[i](GetColumn(dstChunk, typeID) + dstRow * size,
+                         GetColumn(srcChunk, typeID) + srcRow * size);
+        }
+
+        movedEntity = GetEntities(srcChunk)[srcRow];
+        GetEntities(dstChunk)[dstRow] = movedEntity;
+    }
+
+    m_count--;
+    return movedEntity;
+}
+
+void Archetype::DestroyRow(uint32_t index) {
+    for (size_t i = 0; i < m_typeIDs.size(); ++i) {
+        m_destroyFns[i](GetComponent(index, m_typeIDs[i]));
+    }
+}
+
+// ==================================================================================
+// ArchetypeStorage
+// ==================================================================================
+
+void ArchetypeStorage::RegisterType(uint32_t typeID, const ComponentTypeInfo& info) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+    if (typeID >= m_typeInfos.size()) {
+        m_typeInfos.resize(static_cast<size_t>(typeID) + 1);
+    }
+    m_typeInfos[typeID] = info;
+}
+
+void ArchetypeStorage::Remove(Entity entity, uint32_t typeID) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+    if (entity.id >= m_locations.size()) return;
+    EntityLocation& location = m_locations[entity.id];
+    if (!location.archetype || !location.archetype->HasComponent(typeID)) {
+        return; // Entity doesn't have this component
+    }
+
+    Signature signature = location.archetype->GetSignature();
+    signature.reset(typeID);
+
+    if (signature.none()) {
+        // Last component removed, entity no longer lives in any archetype
+        location.archetype->DestroyRow(location.index);
+        RemoveRow(location);
+        location = EntityLocation{};
+        return;
+    }
+
+    MoveEntity(entity, GetOrCreateArchetype(signature));
+}
+
+void ArchetypeStorage::DestroyEntity(Entity entity) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+    if (entity.id >= m_locations.size()) return;
+    EntityLocation& location = m_locations[entity.id];
+    if (!location.archetype) return;
+
+    location.archetype->DestroyRow(location.index);
+    RemoveRow(location);
+    location = EntityLocation{};
+}
+
+Archetype& ArchetypeStorage::GetOrCreateArchetype(const Signature& signature) {
+    auto it = m_archetypes.find(signature);
+    if (it != m_archetypes.end()) {
+        return *it->second;
+    }
+
+    auto archetype = std::make_unique<Archetype>(signature, m_typeInfos);
+    Archetype* archetypePtr = archetype.get();
+    m_archetypeList.push_back(std::move(archetype));
+    m_archetypes[signature] = archetypePtr;
+    return *archetypePtr;
+}
+
+void ArchetypeStorage::MoveEntity(Entity entity, Archetype& target) {
+    EntityLocation& location = m_locations[entity.id];
+    uint32_t newIndex = target.Allocate(entity);
+
+    if (location.archetype) {
+        Archetype& source = *location.archetype;
+
+        for (uint32_t typeID : source.GetTypeIDs()) {
+            void* src = source.GetComponent(location.index, typeID);
+            if (target.HasComponent(typeID)) {
+                m_typeInfos[typeID].moveConstruct(target.GetComponent(newIndex, typeID), src);
+            } else {
+                m_typeInfos[typeID].destroy(src);
+            }
+        }
+
+        RemoveRow(location);
+    }
+
+    location.archetype = &target;
+    location.index = newIndex;
+}
+
+void ArchetypeStorage::RemoveRow(const EntityLocation& location) {
+    Entity movedEntity = location.archetype->RemoveRow(location.index);
+    if (movedEntity.IsValid()) {
+        m_locations[movedEntity.id].index = location.index;
+    }
+}
+
+} // namespace ECS
@@ -6,29 +6,471 @@
 
 namespace ECS {
 
+namespace {
+    // Append 'entity' to the pending list of 'componentType'
+    template<typename Pending>
+    void AddPending(std::vector<Pending>& pending, Entity entity, std::type_index componentType) {
+        auto it = std::find_if(pending.begin(), pending.end(),
+            [&](const Pending& entry) { return entry.componentType == componentType; });
+        if (it == pending.end()) {
+            pending.push_back({ componentType, {} });
+            it = pending.end() - 1;
+        }
+        it->entities.push_back(entity);
+    }
+}
+
+void ComponentManager::EndBatch() {
+    if (m_batchDepth == 0 || --m_batchDepth > 0) {
+        return;
+    }
+
+    // Take the lists first: subscribers may start new batches while we publish
+    std::vector<PendingNotification> added = std::move(m_pendingAdded);
+    std::vector<PendingNotification> removed = std::move(m_pendingRemoved);
+    m_pendingAdded.clear();
+    m_pendingRemoved.clear();
+
+    if (!m_eventBus) return;
+
+    for (const auto& entry : added) {
+        ComponentsAddedEvent event(entry.componentType, entry.entities);
+        m_eventBus->Channel<ComponentsAddedEvent>().Publish(event);
+    }
+    for (const auto& entry : removed) {
+        ComponentsRemovedEvent event(entry.componentType, entry.entities);
+        m_eventBus->Channel<ComponentsRemovedEvent>().Publish(event);
+    }
+}
+
+// ==================================================================================
+// Snapshots
+// ==================================================================================
+
+void ComponentManager::Snapshot(WorldSnapshot& snapshot) const {
+    if (m_archetypeStorage) {
+        throw std::runtime_error("Snapshots are not available in Archetype storage mode");
+    }
+
+    // Size the buffer once: trivially copyable data dominates and its size is known
+    size_t estimate = 64 + (m_idGenerator.GetIDCapacity() + 1) * sizeof(uint32_t) + m_signatures.size() * sizeof(Signature) + m_disabled.size();
+    for (const auto& array : m_componentArrays) {
+        if (array) {
+            estimate += 32 + array->GetSize() * (sizeof(Entity) + array->GetComponentSize());
+        }
+    }
+
+    SnapshotWriter writer(snapshot);
+    writer.Reserve(estimate);
+    writer.Write(SNAPSHOT_MAGIC);
+    writer.Write(SNAPSHOT_VERSION);
+
+    m_idGenerator.Serialize(writer);
+    writer.WriteArray(std::span<const Signature>(m_signatures));
+    writer.WriteArray(std::span<const uint8_t>(m_disabled));
+
+    uint32_t arrayCount = 0;
+    for (const auto& array : m_componentArrays) {
+        arrayCount += (array && array->GetSize() > 0) ? 1 : 0;
+    }
+    writer.Write(arrayCount);
+
+    for (uint32_t typeID = 0; typeID < MAX_COMPONENTS; ++typeID) {
+        const auto& array = m_componentArrays[typeID];
+        if (!array || array->GetSize() == 0) continue;
+
+        writer.Write(typeID);
+        writer.Write(static_cast<uint64_t>(array->GetComponentType().hash_code()));
+        writer.Write(static_cast<uint32_t>(array->GetComponentSize()));
+        array->Serialize(writer, m_serializers[typeID].get());
+    }
+}
+
+void ComponentManager::Restore(const WorldSnapshot& snapshot) {
+    if (m_archetypeStorage) {
+        throw std::runtime_error("Snapshots are not available in Archetype storage mode");
+    }
+    if (IsBatching()) {
+        throw std::runtime_error("Restore cannot run inside a ComponentManager batch");
+    }
+
+    SnapshotReader reader(snapshot);
+    if (reader.Read<uint32_t>() != SNAPSHOT_MAGIC || reader.Read<uint32_t>() != SNAPSHOT_VERSION) {
+        throw std::runtime_error("Snapshot: unrecognized format");
+    }
+
+    // 1. Tear down the current world; listeners drop everything they cached
+    BeginBatch();
+    for (uint32_t typeID = 0; typeID < MAX_COMPONENTS; ++typeID) {
+        const auto& array = m_componentArrays[typeID];
+        if (!array || array->GetSize() == 0) continue;
+        QueueComponentChanges(ReactiveChange::Kind::ComponentRemoved, array->GetEntities(), typeID, array->GetComponentType());
+        if (m_eventBus) {
+            std::span<const Entity> entities = array->GetEntities();
+            m_pendingRemoved.push_back({ array->GetComponentType(), std::vector<Entity>(entities.begin(), entities.end()) });
+        }
+        array->Clear();
+    }
+    m_signatures.clear();
+    m_disabled.clear();
+    m_disabledCount = 0;
+    m_idGenerator = EntityIDGenerator();
+    for (const auto& group : m_groups) {
+        group->size = 0;
+    }
+    EndBatch();
+
+    // 2. Load the snapshot
+    try {
+        m_idGenerator.Deserialize(reader);
+        reader.ReadArray(m_signatures);
+        m_signatures.resize(m_idGenerator.GetIDCapacity());
+        reader.ReadArray(m_disabled);
+        m_disabledCount = static_cast<size_t>(std::count_if(m_disabled.begin(), m_disabled.end(), [](uint8_t flag) { return flag != 0; }));
+
+        uint32_t arrayCount = reader.Read<uint32_t>();
+        for (uint32_t i = 0; i < arrayCount; ++i) {
+            uint32_t typeID = reader.Read<uint32_t>();
+            uint64_t typeHash = reader.Read<uint64_t>();
+            uint32_t componentSize = reader.Read<uint32_t>();
+            if (typeID >= MAX_COMPONENTS) {
+                throw std::runtime_error("Snapshot: invalid component type ID");
+            }
+
+            IComponentArray* array = GetOrCreateComponentArray(typeID);
+            if (static_cast<uint64_t>(array->GetComponentType().hash_code()) != typeHash ||
+                array->GetComponentSize() != componentSize) {
+                throw std::runtime_error("Snapshot: component type mismatch (snapshot from another process?)");
+            }
+            array->Deserialize(reader, m_serializers[typeID].get());
+        }
+
+        if (!reader.IsAtEnd()) {
+            throw std::runtime_error("Snapshot: trailing data");
+        }
+
+        // Dense order was captured sorted; re-deriving the group sizes swaps nothing
+        for (const auto& group : m_groups) {
+            RebuildGroup(*group);
+        }
+    } catch (...) {
+        ClearAllComponentArrays();
+        m_signatures.clear();
+        m_disabled.clear();
+        m_disabledCount = 0;
+        m_idGenerator = EntityIDGenerator();
+        for (const auto& group : m_groups) {
+            group->size = 0;
+        }
+        throw;
+    }
+
+    // 3. Announce the restored world
+    BeginBatch();
+    for (uint32_t typeID = 0; typeID < MAX_COMPONENTS; ++typeID) {
+        const auto& array = m_componentArrays[typeID];
+        if (!array || array->GetSize() == 0) continue;
+        std::span<const Entity> entities = array->GetEntities();
+        QueueComponentChanges(ReactiveChange::Kind::ComponentAdded, entities, typeID, array->GetComponentType());
+        if (m_eventBus) {
+            m_pendingAdded.push_back({ array->GetComponentType(), std::vector<Entity>(entities.begin(), entities.end()) });
+        }
+    }
+    EndBatch();
+}
+
+IComponentArray* ComponentManager::GetOrCreateComponentArray(uint32_t typeID) {
+    if (IComponentArray* array = m_arrayLookup[typeID].load(std::memory_order_acquire)) {
+        return array;
+    }
+
+    ComponentArrayFactory factory = GetArrayFactories()[typeID].load(std::memory_order_acquire);
+    if (!factory) {
+        throw std::runtime_error("Snapshot: component type was never used in this process");
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_registryMutex);
+    if (!m_componentArrays[typeID]) {
+        m_componentArrays[typeID] = factory(&m_changeTick);
+        m_arrayLookup[typeID].store(m_componentArrays[typeID].get(), std::memory_order_release);
+    }
+    return m_componentArrays[typeID].get();
+}
+
+void ComponentManager::ClearAllComponentArrays() {
+    for (const auto& array : m_componentArrays) {
+        if (array) {
+            array->Clear();
+        }
+    }
+}
+
+// ==================================================================================
+// Owning Groups
+// ==================================================================================
+
+uint32_t ComponentManager::DeclareOwningGroupByIDs(std::initializer_list<uint32_t> typeIDs) {
+    Signature signature;
+    for (uint32_t typeID : typeIDs) {
+        signature.set(typeID);
+    }
+    if (signature.count() != typeIDs.size()) {
+        throw std::runtime_error("Owning group lists a component type twice");
+    }
+
+    // Already declared with the same types, or a conflicting owner
+    for (uint32_t typeID : typeIDs) {
+        uint8_t owner = m_groupOfType[typeID];
+        if (owner == NO_GROUP) continue;
+        if (m_groups[owner]->signature == signature) {
+            return owner;
+        }
+        throw std::runtime_error("Component type is already owned by another group");
+    }
+    if (m_groups.size() >= NO_GROUP) {
+        throw std::runtime_error("Too many owning groups");
+    }
+
+    auto group = std::make_unique<OwningGroup>();
+    group->signature = signature;
+    for (uint32_t typeID : typeIDs) {
+        group->arrays.push_back(m_arrayLookup[typeID].load(std::memory_order_acquire));
+    }
+    RebuildGroup(*group);
+
+    uint32_t groupIndex = static_cast<uint32_t>(m_groups.size());
+    for (uint32_t typeID : typeIDs) {
+        m_groupOfType[typeID] = static_cast<uint8_t>(groupIndex);
+    }
+    m_groups.push_back(std::move(group));
+    return groupIndex;
+}
+
+void ComponentManager::DestroyEntities(std::span<const Entity> entities) {
+    // Live entities only, each once (ids are unique among live entities)
+    std::vector<Entity> doomed;
+    doomed.reserve(entities.size());
+    for (Entity entity : entities) {
+        if (m_idGenerator.IsValid(entity)) {
+            doomed.push_back(entity);
+        }
+    }
+    std::sort(doomed.begin(), doomed.end(), [](Entity a, Entity b) { return a.id < b.id; });
+    doomed.erase(std::unique(doomed.begin(), doomed.end()), doomed.end());
+    if (doomed.empty()) return;
+
+    // Clear the signatures, keeping them until the arrays have been visited
+    std::vector<Signature> signatures;
+    signatures.reserve(doomed.size());
+    Signature touched;
+    for (Entity entity : doomed) {
+        signatures.push_back(m_signatures[entity.id]);
+        touched |= signatures.back();
+        m_signatures[entity.id].reset();
+        ClearDisabled(entity);
+    }
+
+    if (m_archetypeStorage) {
+        for (Entity entity : doomed) {
+            m_archetypeStorage->DestroyEntity(entity);
+        }
+    } else {
+        // Leaving the group prefixes first lets the arrays compact freely below
+        for (const auto& group : m_groups) {
+            for (Entity entity : doomed) {
+                RemoveFromGroup(*group, entity);
+            }
+        }
+    }
+
+    // Per-type arrays (see DestroyEntity): each one only sees the entities that had it
+    std::vector<Entity> owners;
+    owners.reserve(doomed.size());
+    for (uint32_t typeID = 0; typeID < MAX_COMPONENTS; ++typeID) {
+        if (!touched.test(typeID)) continue;
+
+        IComponentArray* componentArray = m_arrayLookup[typeID].load(std::memory_order_acquire);
+        if (!componentArray) continue;
+
+        owners.clear();
+        for (size_t i = 0; i < doomed.size(); ++i) {
+            if (signatures[i].test(typeID)) {
+                owners.push_back(doomed[i]);
+            }
+        }
+        componentArray->EntitiesDestroyed(owners);
+    }
+
+    if (!m_reactiveQueues.empty()) {
+        for (size_t i = 0; i < doomed.size(); ++i) {
+            QueueEntityChange(ReactiveChange::Kind::EntityDestroyed, doomed[i], signatures[i]);
+        }
+    }
+
+    if (m_eventBus) {
+        EntitiesDestroyedEvent event(doomed);
+        m_eventBus->Channel<EntitiesDestroyedEvent>().Publish(event);
+    }
+
+    for (Entity entity : doomed) {
+        m_idGenerator.Destroy(entity);
+    }
+}
+
+void ComponentManager::SetEntityEnabled(Entity entity, bool enabled) {
+    if (!m_idGenerator.IsValid(entity) || IsEntityEnabled(entity) == enabled) {
+        return;
+    }
+
+    if (entity.id >= m_disabled.size()) {
+        m_disabled.resize(m_idGenerator.GetIDCapacity(), 0);
+    }
+    m_disabled[entity.id] = enabled ? 0 : 1;
+    m_disabledCount = enabled ? m_disabledCount - 1 : m_disabledCount + 1;
+
+    // Re-enabled components count as changed: readers may have skipped writes made while disabled
+    if (enabled) {
+        const Signature& signature = m_signatures[entity.id];
+        for (uint32_t typeID = 0; typeID < MAX_COMPONENTS; ++typeID) {
+            if (!signature.test(typeID)) continue;
+            if (IComponentArray* componentArray = m_arrayLookup[typeID].load(std::memory_order_acquire)) {
+                componentArray->MarkChanged(entity);
+            }
+        }
+    }
+
+    QueueEntityChange(enabled ? ReactiveChange::Kind::EntityEnabled : ReactiveChange::Kind::EntityDisabled,
+                      entity, m_signatures[entity.id]);
+
+    if (m_eventBus) {
+        EntityEnabledChangedEvent event(entity, enabled);
+        m_eventBus->Channel<EntityEnabledChangedEvent>().Publish(event);
+    }
+}
+
+void ComponentManager::AddToGroup(OwningGroup& group, Entity entity) {
+    // Already a member (e.g. an owned component was overwritten) or still incomplete
+    if (group.arrays[0]->FindIndex(entity) < group.size || !EntityMatchesSignature(entity, group.signature)) {
+        return;
+    }
+
+    for (IComponentArray* array : group.arrays) {
+        array->SwapEntries(array->FindIndex(entity), group.size);
+    }
+    ++group.size;
+}
+
+void ComponentManager::RemoveFromGroup(OwningGroup& group, Entity entity) {
+    // INVALID_INDEX (no component) is never below size
+    if (group.arrays[0]->FindIndex(entity) >= group.size) {
+        return;
+    }
+
+    --group.size;
+    for (IComponentArray* array : group.arrays) {
+        array->SwapEntries(array->FindIndex(entity), group.size);
+    }
+}
+
+void ComponentManager::RebuildGroup(OwningGroup& group) {
+    // Walk the first array: every member found is swapped to the end of the sorted
+    // prefix, and whatever it displaces was already visited (it is not a member)
+    group.size = 0;
+    IComponentArray* lead = group.arrays[0];
+    for (size_t i = 0; i < lead->GetSize(); ++i) {
+        Entity entity = lead->GetEntities()[i];
+        if (!EntityMatchesSignature(entity, group.signature)) continue;
+
+        for (IComponentArray* array : group.arrays) {
+            array->SwapEntries(array->FindIndex(entity), group.size);
+        }
+        ++group.size;
+    }
+}
+
+void ComponentManager::RegisterBuiltInSerializers() {
+    // Meshes are owned by the AssetManager (non-owning reference); materials are
+    // shared and kept alive by the snapshot
+    RegisterSerializer<RenderComponent>(
+        [](const RenderComponent& render, SnapshotWriter& writer) {
+            writer.WriteReference(render.mesh);
+            writer.WriteReference(render.material);
+        },
+        [](SnapshotReader& reader, RenderComponent& render) {
+            render.mesh = reader.ReadReference<Mesh>().get();
+            render.material = reader.ReadReference<Material>();
+        });
+}
+
 void ComponentManager::FireComponentAddedEvent(Entity entity, std::type_index componentType) {
     if (!m_eventBus) {
         LOG_WARNING("ComponentManager: EventBus is null!");
         return;
     }
     
-    LOG_INFO("ComponentManager: Firing ComponentAdded for Entity " + std::to_string(entity.id));
+    if (m_batchDepth > 0) {
+        AddPending(m_pendingAdded, entity, componentType);
+        return;
+    }
+    
     ComponentAddedEvent event(entity, componentType);
-    m_eventBus->Publish(event);
+    m_eventBus->Channel<ComponentAddedEvent>().Publish(event);
 }
 
 void ComponentManager::FireComponentRemovedEvent(Entity entity, std::type_index componentType) {
     if (!m_eventBus) return;
     
+    if (m_batchDepth > 0) {
+        AddPending(m_pendingRemoved, entity, componentType);
+        return;
+    }
+    
     ComponentRemovedEvent event(entity, componentType);
-    m_eventBus->Publish(event);
+    m_eventBus->Channel<ComponentRemovedEvent>().Publish(event);
 }
 
 void ComponentManager::FireEntityDestroyedEvent(Entity entity) {
     if (!m_eventBus) return;
     
     EntityDestroyedEvent event(entity);
-    m_eventBus->Publish(event);
+    m_eventBus->Channel<EntityDestroyedEvent>().Publish(event);
+}
+
+// ==================================================================================
+// Dense Order
+// ==================================================================================
+
+size_t ComponentManager::GetOwnedPrefixSize(uint32_t typeID) const {
+    uint8_t owner = m_groupOfType[typeID];
+    return owner != NO_GROUP ? m_groups[owner]->size : 0;
+}
+
+bool ComponentManager::SwapDenseSlots(uint32_t typeID, size_t first, size_t second) {
+    IComponentArray* componentArray = m_arrayLookup[typeID].load(std::memory_order_acquire);
+    if (!componentArray || first >= componentArray->GetSize() || second >= componentArray->GetSize()) {
+        return false;
+    }
+
+    uint8_t owner = m_groupOfType[typeID];
+    if (owner == NO_GROUP) {
+        componentArray->SwapEntries(first, second);
+        return true;
+    }
+
+    // Members stay in the prefix, in the same order in every owned array
+    const OwningGroup& group = *m_groups[owner];
+    bool firstOwned = first < group.size;
+    if (firstOwned != (second < group.size)) {
+        return false;
+    }
+    if (!firstOwned) {
+        componentArray->SwapEntries(first, second);
+        return true;
+    }
+    for (IComponentArray* owned : group.arrays) {
+        owned->SwapEntries(first, second);
+    }
+    return true;
 }
 
 } // namespace ECS
@@ -0,0 +1,146 @@
+#include "../../include/ECS/EntityPool.h"
+#include <utility>
+
+namespace ECS {
+
+EntityPool::EntityPool(ComponentManager& componentManager, size_t capacity, Prefab prefab)
+    : m_componentManager(componentManager)
+    , m_prefab(std::move(prefab))
+{
+    Grow(capacity);
+}
+
+void EntityPool::Grow(size_t count) {
+    // Listeners get one ComponentsAdded event per prefab type; parked entities are
+    // disabled before it is published, so caches skip them
+    ComponentManager::BatchScope batch(m_componentManager);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_slots.reserve(m_slots.size() + count);
+    for (size_t i = 0; i < count; ++i) {
+        Entity entity = m_componentManager.CreateEntity();
+        if (m_prefab) {
+            m_prefab(m_componentManager, entity);
+        }
+        m_componentManager.SetEntityEnabled(entity, false);
+
+        uint32_t slot = static_cast<uint32_t>(m_slots.size());
+        m_slots.push_back({ entity, SlotState::Free });
+        m_freeSlots.push_back(slot);
+        m_slotOfEntity[entity] = slot;
+    }
+}
+
+Entity EntityPool::Acquire(CommandBuffer& commands) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (int pass = 0; pass < 2; ++pass) {
+        while (!m_freeSlots.empty()) {
+            uint32_t slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+
+            // Skip entries a Restore made stale
+            Slot& entry = m_slots[slot];
+            if (entry.state != SlotState::Free) continue;
+            if (!m_componentManager.IsEntityValid(entry.entity)) {
+                entry.state = SlotState::Lost;
+                continue;
+            }
+            if (m_componentManager.IsEntityEnabled(entry.entity)) {
+                entry.state = SlotState::Active;
+                continue;
+            }
+
+            entry.state = SlotState::Acquiring;
+            commands.Call([this, slot](ComponentManager& componentManager) {
+                Entity entity;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    Slot& entry = m_slots[slot];
+                    if (entry.state != SlotState::Acquiring) return; // Released before it was enabled
+                    entry.state = SlotState::Active;
+                    entity = entry.entity;
+                }
+                componentManager.SetEntityEnabled(entity, true);
+            });
+            return entry.entity;
+        }
+
+        // Out of entries: entities parked by a Restore may not be listed yet
+        if (pass == 0) {
+            RefreshFreeList();
+        }
+    }
+    return NULL_ENTITY;
+}
+
+bool EntityPool::Release(Entity entity, CommandBuffer& commands) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_slotOfEntity.find(entity);
+    if (it == m_slotOfEntity.end()) {
+        return false;
+    }
+
+    uint32_t slot = it->second;
+    Slot& entry = m_slots[slot];
+    if (entry.state != SlotState::Active && entry.state != SlotState::Acquiring) {
+        return true; // Already parked or being parked
+    }
+
+    entry.state = SlotState::Releasing;
+    commands.Call([this, slot](ComponentManager& componentManager) {
+        Entity entity;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            entity = m_slots[slot].entity;
+        }
+        componentManager.SetEntityEnabled(entity, false);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Slot& entry = m_slots[slot];
+        if (entry.state == SlotState::Releasing) {
+            entry.state = SlotState::Free;
+            m_freeSlots.push_back(slot);
+        }
+    });
+    return true;
+}
+
+bool EntityPool::Owns(Entity entity) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_slotOfEntity.contains(entity);
+}
+
+size_t EntityPool::GetCapacity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_slots.size();
+}
+
+size_t EntityPool::GetFreeCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_freeSlots.size();
+}
+
+void EntityPool::RefreshFreeList() {
+    m_freeSlots.clear();
+    for (uint32_t slot = 0; slot < m_slots.size(); ++slot) {
+        Slot& entry = m_slots[slot];
+        if (entry.state == SlotState::Lost ||
+            entry.state == SlotState::Acquiring ||
+            entry.state == SlotState::Releasing) {
+            continue; // Pending changes are applied by their commands
+        }
+
+        if (!m_componentManager.IsEntityValid(entry.entity)) {
+            entry.state = SlotState::Lost;
+        } else if (m_componentManager.IsEntityEnabled(entry.entity)) {
+            entry.state = SlotState::Active;
+        } else {
+            entry.state = SlotState::Free;
+            m_freeSlots.push_back(slot);
+        }
+    }
+}
+
+} // namespace ECS
@@ -0,0 +1,260 @@
+#include "../../include/ECS/RewindBuffer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace ECS {
+
+namespace {
+    // Zero runs shorter than this stay inside the literal (a token costs at least 2 bytes)
+    constexpr size_t MIN_ZERO_RUN = 4;
+
+    // Delta slots that grew past this while holding a keyframe give the memory back
+    constexpr size_t SHRINK_THRESHOLD = 64 * 1024;
+
+    size_t RoundUp(size_t value, size_t multiple) {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+
+    void WriteVarint(std::vector<uint8_t>& out, size_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    size_t ReadVarint(const uint8_t*& cursor, const uint8_t* end) {
+        size_t value = 0;
+        for (unsigned shift = 0; cursor < end && shift < 64; shift += 7) {
+            uint8_t byte = *cursor++;
+            value |= static_cast<size_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return value;
+        }
+        throw std::runtime_error("RewindBuffer: corrupt delta");
+    }
+}
+
+RewindBuffer::RewindBuffer(ComponentManager& componentManager, size_t capacity, size_t keyframeInterval)
+    : m_componentManager(componentManager),
+      m_keyframeInterval((std::max)(keyframeInterval, size_t{ 1 })),
+      m_frames(RoundUp((std::max)(capacity, size_t{ 1 }), m_keyframeInterval))
+{
+}
+
+void RewindBuffer::Capture(uint64_t tick) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    if (m_count > 0 && tick != GetNewestTick() + 1) {
+        Clear();
+    }
+
+    m_componentManager.Snapshot(m_capture);
+
+    if (m_count == m_frames.size()) {
+        EvictOldest();
+    }
+
+    const bool keyframe = m_count == 0 || tick % m_keyframeInterval == 0;
+    const std::vector<std::byte>& current = m_capture.m_data;
+
+    Frame& frame = m_frames[SlotAt(m_count)];
+    frame.tick = tick;
+    frame.keyframe = keyframe;
+    frame.size = current.size();
+    if (keyframe) {
+        EncodeDelta(current, {}, frame.encoded);
+    } else {
+        AlignBase(m_latest, m_latestSections, m_capture.m_sections, current.size(), m_aligned);
+        EncodeDelta(current, m_aligned, frame.encoded);
+    }
+    frame.sections = m_capture.m_sections;
+    if (!keyframe && frame.encoded.capacity() > SHRINK_THRESHOLD && frame.encoded.capacity() > 4 * frame.encoded.size()) {
+        frame.encoded.shrink_to_fit(); // Slot held a keyframe of an earlier history
+    }
+
+    // Share the reference table with the previous tick when the assets did not change
+    const Frame* previous = m_count > 0 ? &m_frames[SlotAt(m_count - 1)] : nullptr;
+    if (previous && previous->references && *previous->references == m_capture.m_references) {
+        frame.references = previous->references;
+    } else {
+        frame.references = std::make_shared<const ReferenceTable>(m_capture.m_references);
+    }
+
+    ++m_count;
+    m_latest.swap(m_capture.m_data); // The old base becomes the next capture buffer
+    m_latestSections.swap(m_capture.m_sections);
+
+    m_lastRawSize = frame.size;
+    m_lastEncodedSize = frame.encoded.size();
+    m_lastCaptureTimeMs = std::chrono::duration<double, std::milli>(
+        std::chrono::high_resolution_clock::now() - start).count();
+}
+
+void RewindBuffer::Rewind(uint64_t tick) {
+    if (!Contains(tick)) {
+        throw std::runtime_error("RewindBuffer: tick " + std::to_string(tick) + " is not stored");
+    }
+
+    size_t offset = static_cast<size_t>(tick - GetOldestTick());
+    WorldSnapshot snapshot;
+    DecodeInto(offset, snapshot);
+    m_componentManager.Restore(snapshot);
+
+    // Newer ticks belong to the abandoned timeline
+    for (size_t i = offset + 1; i < m_count; ++i) {
+        m_frames[SlotAt(i)].references.reset();
+    }
+    m_count = offset + 1;
+    m_latest.swap(snapshot.m_data);
+    m_latestSections.swap(snapshot.m_sections);
+}
+
+bool RewindBuffer::GetSnapshot(uint64_t tick, WorldSnapshot& snapshot) const {
+    if (!Contains(tick)) return false;
+
+    DecodeInto(static_cast<size_t>(tick - GetOldestTick()), snapshot);
+    return true;
+}
+
+void RewindBuffer::Clear() {
+    for (Frame& frame : m_frames) {
+        frame.references.reset();
+    }
+    m_head = 0;
+    m_count = 0;
+    m_latest.clear();
+    m_latestSections.clear();
+}
+
+size_t RewindBuffer::GetMemoryUsage() const {
+    size_t bytes = m_latest.capacity() + m_capture.m_data.capacity() + m_aligned.capacity();
+    for (const Frame& frame : m_frames) {
+        bytes += sizeof(Frame) + frame.encoded.capacity() + frame.sections.capacity() * sizeof(size_t);
+    }
+    return bytes;
+}
+
+void RewindBuffer::EvictOldest() {
+    // The oldest frame is a keyframe; deltas up to the next keyframe cannot be decoded without it
+    do {
+        m_frames[m_head].references.reset();
+        m_head = (m_head + 1) % m_frames.size();
+        --m_count;
+    } while (m_count > 0 && !m_frames[m_head].keyframe);
+}
+
+void RewindBuffer::DecodeInto(size_t offset, WorldSnapshot& snapshot) const {
+    size_t keyframe = offset;
+    while (!m_frames[SlotAt(keyframe)].keyframe) {
+        --keyframe;
+    }
+
+    std::vector<std::byte> aligned;
+    snapshot.m_data.clear();
+    snapshot.m_sections.clear();
+    for (size_t i = keyframe; i <= offset; ++i) {
+        const Frame& frame = m_frames[SlotAt(i)];
+        AlignBase(snapshot.m_data, snapshot.m_sections, frame.sections, frame.size, aligned);
+        ApplyDelta(frame.encoded, aligned);
+        snapshot.m_data.swap(aligned);
+        snapshot.m_sections = frame.sections;
+    }
+    snapshot.m_references = *m_frames[SlotAt(offset)].references;
+}
+
+void RewindBuffer::AlignBase(std::span<const std::byte> base, const std::vector<size_t>& baseSections,
+                             const std::vector<size_t>& sections, size_t size, std::vector<std::byte>& aligned) {
+    aligned.resize(size);
+
+    for (size_t k = 0; k <= sections.size(); ++k) {
+        size_t begin = k > 0 ? sections[k - 1] : 0;
+        size_t end = k < sections.size() ? sections[k] : size;
+
+        size_t copied = 0;
+        if (k <= baseSections.size()) {
+            size_t baseBegin = k > 0 ? baseSections[k - 1] : 0;
+            size_t baseEnd = k < baseSections.size() ? baseSections[k] : base.size();
+            copied = (std::min)(end - begin, baseEnd - baseBegin);
+            if (copied > 0) {
+                std::memcpy(aligned.data() + begin, base.data() + baseBegin, copied);
+            }
+        }
+        std::memset(aligned.data() + begin + copied, 0, end - begin - copied);
+    }
+}
+
+// ==================================================================================
+// XOR + RLE
+// ----------------------------------------------------------------------------------
+// Stream of tokens: varint zero-run length, varint literal length, literal bytes
+// (current XOR base). The trailing zero run is implicit.
+// ==================================================================================
+
+void RewindBuffer::EncodeDelta(std::span<const std::byte> current, std::span<const std::byte> base,
+                               std::vector<uint8_t>& encoded) {
+    encoded.clear();
+
+    const size_t size = current.size();
+    const size_t overlap = (std::min)(size, base.size());
+    auto xorAt = [&](size_t i) {
+        return static_cast<uint8_t>(i < overlap ? current[i] ^ base[i] : current[i]);
+    };
+
+    size_t i = 0;
+    while (i < size) {
+        // Zero run: unchanged bytes, compared a word at a time
+        size_t runStart = i;
+        while (i + sizeof(uint64_t) <= overlap &&
+               std::memcmp(current.data() + i, base.data() + i, sizeof(uint64_t)) == 0) {
+            i += sizeof(uint64_t);
+        }
+        while (i < size && xorAt(i) == 0) {
+            ++i;
+        }
+        if (i == size) break;
+
+        // Literal: up to the next zero run of at least MIN_ZERO_RUN bytes
+        size_t literalStart = i;
+        size_t literalEnd = i;
+        while (i < size) {
+            if (xorAt(i) != 0) {
+                literalEnd = ++i;
+            } else if (++i - literalEnd >= MIN_ZERO_RUN) {
+                break;
+            }
+        }
+        i = literalEnd;
+
+        WriteVarint(encoded, literalStart - runStart);
+        WriteVarint(encoded, literalEnd - literalStart);
+        size_t out = encoded.size();
+        encoded.resize(out + (literalEnd - literalStart));
+        for (size_t j = literalStart; j < literalEnd; ++j) {
+            encoded[out++] = xorAt(j);
+        }
+    }
+}
+
+void RewindBuffer::ApplyDelta(const std::vector<uint8_t>& encoded, std::vector<std::byte>& data) {
+    const size_t size = data.size();
+    const uint8_t* cursor = encoded.data();
+    const uint8_t* end = cursor + encoded.size();
+    size_t position = 0;
+    while (cursor < end) {
+        position += ReadVarint(cursor, end);
+        size_t length = ReadVarint(cursor, end);
+        if (position + length > size || length > static_cast<size_t>(end - cursor)) {
+            throw std::runtime_error("RewindBuffer: corrupt delta");
+        }
+        for (size_t j = 0; j < length; ++j) {
+            data[position + j] ^= static_cast<std::byte>(cursor[j]);
+        }
+        position += length;
+        cursor += length;
+    }
+}
+
+} // namespace ECS
@@ -0,0 +1,187 @@
+#include "../../include/ECS/SpatialOrder.h"
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace ECS {
+
+SpatialOrder::SpatialOrder(ComponentManager& componentManager, size_t entriesPerStep)
+    : m_componentManager(componentManager)
+    , m_transforms(componentManager.GetComponentArray<TransformComponent>())
+    , m_entriesPerStep(entriesPerStep > 0 ? entriesPerStep : 1)
+{
+}
+
+void SpatialOrder::Step() {
+    if (m_tracks.empty()) return;
+
+    const TrackedArray& track = m_tracks[m_trackIndex % m_tracks.size()];
+    size_t budget = m_entriesPerStep;
+
+    // Stages hand over within a step while budget is left
+    while (budget > 0) {
+        size_t done = 0;
+        switch (m_stage) {
+            case Stage::Gather:  done = Gather(track, budget); break;
+            case Stage::Key:     done = Key(budget); break;
+            case Stage::Scatter: done = Scatter(budget); break;
+            case Stage::Apply:   done = Apply(track, budget); break;
+        }
+
+        if (m_stage == Stage::Gather && m_cursor == 0 && m_items.empty()) {
+            break; // Pass finished (or nothing to sort): the next track starts next step
+        }
+        budget -= (std::min)(budget, (std::max)(done, size_t{ 1 }));
+    }
+}
+
+void SpatialOrder::SortAll() {
+    const size_t passes = m_completedPasses + m_tracks.size();
+    while (m_completedPasses < passes) {
+        Step();
+    }
+}
+
+// ==================================================================================
+// Stages
+// ==================================================================================
+
+size_t SpatialOrder::Gather(const TrackedArray& track, size_t budget) {
+    if (m_cursor == 0) {
+        m_items.clear();
+        m_passSwaps = 0;
+        m_minX = m_minZ = (std::numeric_limits<float>::max)();
+        m_maxX = m_maxZ = std::numeric_limits<float>::lowest();
+    }
+
+    const ComponentArray<TransformComponent>& transforms = *m_transforms;
+    const size_t size = track.array->GetSize();
+    const size_t owned = m_componentManager.GetOwnedPrefixSize(track.typeID);
+    const size_t end = (std::min)(size, m_cursor + budget);
+    const size_t begin = m_cursor;
+
+    for (size_t i = begin; i < end; ++i) {
+        Item item;
+        item.entity = track.array->GetEntityAtIndex(i);
+        item.bucket = i < owned ? 0 : 1;
+        if (const TransformComponent* transform = transforms.TryGetData(item.entity)) {
+            item.x = transform->position.x;
+            item.z = transform->position.z;
+            item.hasPosition = true;
+            m_minX = (std::min)(m_minX, item.x);
+            m_maxX = (std::max)(m_maxX, item.x);
+            m_minZ = (std::min)(m_minZ, item.z);
+            m_maxZ = (std::max)(m_maxZ, item.z);
+        }
+        m_items.push_back(item);
+    }
+    m_cursor = end;
+
+    if (m_cursor >= size) {
+        m_cursor = 0;
+        if (m_items.size() < 2) {
+            FinishPass(); // Nothing to order
+        } else {
+            m_bucketOffsets.assign(BUCKET_COUNT, 0);
+            m_stage = Stage::Key;
+        }
+    }
+    return end - begin;
+}
+
+size_t SpatialOrder::Key(size_t budget) {
+    const float gridSize = static_cast<float>(1u << GRID_BITS);
+    const float scaleX = m_maxX > m_minX ? gridSize / (m_maxX - m_minX) : 0.0f;
+    const float scaleZ = m_maxZ > m_minZ ? gridSize / (m_maxZ - m_minZ) : 0.0f;
+    const uint32_t maxCoordinate = (1u << GRID_BITS) - 1;
+
+    const size_t begin = m_cursor;
+    const size_t end = (std::min)(m_items.size(), m_cursor + budget);
+    for (size_t i = begin; i < end; ++i) {
+        Item& item = m_items[i];
+        uint32_t cell = CELL_COUNT - 1; // No transform: after everything positioned
+        if (item.hasPosition) {
+            // Positions seen here may have moved since Gather: clamp to the grid
+            uint32_t x = static_cast<uint32_t>((std::max)((item.x - m_minX) * scaleX, 0.0f));
+            uint32_t z = static_cast<uint32_t>((std::max)((item.z - m_minZ) * scaleZ, 0.0f));
+            cell = MortonCode((std::min)(x, maxCoordinate), (std::min)(z, maxCoordinate));
+        }
+        item.bucket = item.bucket * CELL_COUNT + cell;
+        ++m_bucketOffsets[item.bucket];
+    }
+    m_cursor = end;
+
+    if (m_cursor >= m_items.size()) {
+        // Counts -> first target slot of each bucket
+        uint32_t offset = 0;
+        for (uint32_t& bucket : m_bucketOffsets) {
+            offset += std::exchange(bucket, offset);
+        }
+        m_order.resize(m_items.size());
+        m_cursor = 0;
+        m_stage = Stage::Scatter;
+    }
+    return end - begin;
+}
+
+size_t SpatialOrder::Scatter(size_t budget) {
+    const size_t begin = m_cursor;
+    const size_t end = (std::min)(m_items.size(), m_cursor + budget);
+    for (size_t i = begin; i < end; ++i) {
+        m_order[m_bucketOffsets[m_items[i].bucket]++] = m_items[i].entity;
+    }
+    m_cursor = end;
+
+    if (m_cursor >= m_items.size()) {
+        m_cursor = 0;
+        m_stage = Stage::Apply;
+    }
+    return end - begin;
+}
+
+size_t SpatialOrder::Apply(const TrackedArray& track, size_t budget) {
+    // Slot p receives the p-th entity of the target order; the entity it displaces
+    // is found again through the sparse set when its own turn comes
+    const size_t begin = m_cursor;
+    const size_t end = (std::min)(m_order.size(), m_cursor + budget);
+    for (size_t slot = begin; slot < end; ++slot) {
+        uint32_t index = track.array->FindIndex(m_order[slot]);
+        if (index == ComponentArray<TransformComponent>::INVALID_INDEX || index == slot) continue;
+
+        // Refused across a group boundary that moved since Gather
+        if (m_componentManager.SwapDenseSlots(track.typeID, slot, index)) {
+            ++m_passSwaps;
+        }
+    }
+    m_cursor = end;
+
+    if (m_cursor >= m_order.size()) {
+        m_cursor = 0;
+        FinishPass();
+    }
+    return end - begin;
+}
+
+void SpatialOrder::FinishPass() {
+    m_lastPassSwaps = m_passSwaps;
+    ++m_completedPasses;
+    ++m_trackIndex;
+
+    m_stage = Stage::Gather;
+    m_cursor = 0;
+    m_items.clear(); // Capacity is kept for the next pass
+}
+
+uint32_t SpatialOrder::MortonCode(uint32_t x, uint32_t z) {
+    // Spread 8 bits to the even bit positions, then interleave x (even) and z (odd)
+    auto spread = [](uint32_t v) {
+        v &= 0xFF;
+        v = (v | (v << 4)) & 0x0F0F;
+        v = (v | (v << 2)) & 0x3333;
+        v = (v | (v << 1)) & 0x5555;
+        return v;
+    };
+    return spread(x) | (spread(z) << 1);
+}
+
+} // namespace ECS
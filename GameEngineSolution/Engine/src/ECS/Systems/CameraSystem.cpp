@@ -32,8 +32,13 @@ void CameraSystem::Update(float deltaTime) {
                                                    camera.nearPlane, camera.farPlane);
         XMStoreFloat4x4(&camera.projectionMatrix, proj);
         
-        // Update view matrix from transform
+        // Update view matrix from transform, at the frame's point between the last two ticks
         XMVECTOR pos = XMLoadFloat3(&transform.position);
+        if (const WorldMatrixComponent* matrices = m_componentManager.GetComponentPtr<WorldMatrixComponent>(entity)) {
+            XMVECTOR previous = XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(&matrices->previous.m[3][0]));
+            XMVECTOR current = XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(&matrices->world.m[3][0]));
+            pos = XMVectorLerp(previous, current, m_interpolationAlpha);
+        }
         float pitch = controller ? controller->viewPitch : transform.rotation.x;
         float yaw = transform.rotation.y;
         float roll = transform.rotation.z;
@@ -42,6 +47,7 @@ void CameraSystem::Update(float deltaTime) {
         // Apply camera offset
         XMVECTOR offset = XMLoadFloat3(&camera.positionOffset);
         pos = XMVectorAdd(pos, offset);
+        XMStoreFloat3(&camera.eyePosition, pos);
         
         // Calculate forward, right, up vectors from rotation
         XMMATRIX rotMatrix = XMMatrixRotationRollPitchYaw(rot.m128_f32[0], rot.m128_f32[1], rot.m128_f32[2]);
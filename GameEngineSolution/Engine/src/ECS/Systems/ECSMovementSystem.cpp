@@ -1,29 +1,24 @@
 #include "../../../include/ECS/Systems/ECSMovementSystem.h"
+#include "../../../include/ECS/View.h"
 #include <cmath>
 
 namespace ECS {
 
 void MovementSystem::Update(float deltaTime) {
     // --- Handle Rotation ---
-    auto rotateEntities = m_componentManager.QueryEntities<RotateComponent, TransformComponent>();
+    View<const RotateComponent, TransformComponent> rotateView(m_componentManager);
     
-    for (Entity entity : rotateEntities) {
-        auto& rotate = m_componentManager.GetComponent<RotateComponent>(entity);
-        auto& transform = m_componentManager.GetComponent<TransformComponent>(entity);
-        
+    rotateView.Each([deltaTime](Entity, const RotateComponent& rotate, TransformComponent& transform) {
         // Simple Euler integration for rotation
         transform.rotation.x += rotate.axis.x * rotate.speed * deltaTime;
         transform.rotation.y += rotate.axis.y * rotate.speed * deltaTime;
         transform.rotation.z += rotate.axis.z * rotate.speed * deltaTime;
-    }
+    });
 
     // --- Handle Orbiting ---
-    auto orbitEntities = m_componentManager.QueryEntities<OrbitComponent, TransformComponent>();
+    View<OrbitComponent, TransformComponent> orbitView(m_componentManager);
     
-    for (Entity entity : orbitEntities) {
-        auto& orbit = m_componentManager.GetComponent<OrbitComponent>(entity);
-        auto& transform = m_componentManager.GetComponent<TransformComponent>(entity);
-        
+    orbitView.Each([deltaTime](Entity, OrbitComponent& orbit, TransformComponent& transform) {
         // Update angle
         orbit.angle += orbit.speed * deltaTime;
         
@@ -36,7 +31,7 @@ void MovementSystem::Update(float deltaTime) {
         float y = orbit.center.y + sinf(orbit.angle * 2.0f) * 0.3f; // Slight bobbing
         
         transform.position = { x, y, z };
-    }
+    });
 }
 
 } // namespace ECS
@@ -1,5 +1,8 @@
 #include "../../../include/ECS/Systems/ECSPhysicsSystem.h"
 #include "../../../include/Physics/PhysicsConstants.h"
+#include "../../../include/ECS/View.h"
+#include "../../../include/ECS/Group.h"
+#include "../../../include/Jobs/ParallelFor.h"
 #include <algorithm>
 
 using namespace PhysicsConstants;
@@ -11,6 +14,39 @@ void PhysicsSystem::Init() {
     m_physicsArray = m_componentManager.GetComponentArray<PhysicsComponent>();
     m_transformArray = m_componentManager.GetComponentArray<TransformComponent>();
     m_colliderArray = m_componentManager.GetComponentArray<ColliderComponent>();
+    
+    // Keep bodies sorted from the start (declaring later would sort during an update)
+    m_componentManager.DeclareOwningGroup<PhysicsComponent, TransformComponent>();
+    
+    // Colliders that disappear never show up as changed: the reactive queue drops
+    // them from the grid before the next update. Added ones are picked up as changed.
+    WatchComponents<ColliderComponent, TransformComponent>();
+}
+
+void PhysicsSystem::OnComponentRemoved(Entity entity, std::type_index componentType) {
+    m_spatialGrid.Remove(entity);
+}
+
+void PhysicsSystem::OnEntityDestroyed(Entity entity) {
+    m_spatialGrid.Remove(entity);
+}
+
+// Disabled colliders leave the grid; re-enabled ones come back as changed
+void PhysicsSystem::OnEntityEnabledChanged(Entity entity, bool enabled) {
+    if (!enabled) {
+        m_spatialGrid.Remove(entity);
+    }
+}
+
+// Removals were lost with the queue: refill the grid from the current colliders
+void PhysicsSystem::OnReactiveQueueOverflow() {
+    m_spatialGrid.Clear();
+    View<const ColliderComponent, const TransformComponent> colliders(m_componentManager);
+    colliders.Each([&](Entity entity, const ColliderComponent& collider, const TransformComponent& transform) {
+        if (collider.enabled) {
+            InsertIntoSpatialGrid(entity, collider, transform);
+        }
+    });
 }
 
 void PhysicsSystem::Update(float deltaTime) {
@@ -18,16 +54,14 @@ void PhysicsSystem::Update(float deltaTime) {
     if (deltaTime < MIN_DELTA_TIME) deltaTime = MIN_DELTA_TIME;
     if (deltaTime > MAX_DELTA_TIME) deltaTime = MAX_DELTA_TIME;
     
-    // Rebuild spatial grid for this frame
-    RebuildSpatialGrid();
+    // Bring the spatial grid up to date with colliders moved since the last frame
+    UpdateSpatialGrid();
     
-    // Use Query API to get entities with both Physics and Transform
-    auto entities = m_componentManager.QueryEntities<PhysicsComponent, TransformComponent>();
+    // Physics and transform arrays are kept in matching order for bodies (owning group)
+    Group<PhysicsComponent, TransformComponent> bodies(m_componentManager);
     
-    for (Entity entity : entities) {
-        auto& physics = m_componentManager.GetComponent<PhysicsComponent>(entity);
-        auto& transform = m_componentManager.GetComponent<TransformComponent>(entity);
-        
+    // Integrate forces and velocity in parallel: each entity only touches its own components
+    Jobs::ParallelFor(bodies, INTEGRATION_GRAIN_SIZE, [&](Entity, PhysicsComponent& physics, TransformComponent& transform) {
         // Apply physics forces
         if (physics.useGravity) {
             ApplyGravity(physics, deltaTime);
@@ -38,46 +72,54 @@ void PhysicsSystem::Update(float deltaTime) {
         
         // Integrate velocity into position
         IntegrateVelocity(transform, physics, deltaTime);
-        
+    });
+    
+    // Collision resolution reads other entities' transforms, so it stays sequential
+    bodies.Each([&](Entity entity, PhysicsComponent& physics, TransformComponent& transform) {
         // Simple ground collision
         if (physics.checkCollisions) {
             CheckGroundCollision(entity, transform, physics);
         }
-    }
+    });
 }
 
-void PhysicsSystem::RebuildSpatialGrid() {
-    // Clear previous frame's data
-    m_spatialGrid.Clear();
+void PhysicsSystem::UpdateSpatialGrid() {
+    const uint32_t since = GetLastRunTick();
     
-    // Insert all colliders into the grid
-    auto entities = m_componentManager.QueryEntities<ColliderComponent, TransformComponent>();
+    auto refresh = [&](Entity entity, const ColliderComponent& collider, const TransformComponent& transform) {
+        if (collider.enabled) {
+            InsertIntoSpatialGrid(entity, collider, transform);
+        } else {
+            m_spatialGrid.Remove(entity);
+        }
+    };
     
-    for (Entity entity : entities) {
-        const auto& collider = m_componentManager.GetComponent<ColliderComponent>(entity);
-        
-        if (!collider.enabled) continue;
-        
-        const auto& transform = m_componentManager.GetComponent<TransformComponent>(entity);
-        
-        // Calculate world-space AABB
-        AABB worldAABB;
-        worldAABB.extents = {
-            collider.localAABB.extents.x * transform.scale.x,
-            collider.localAABB.extents.y * transform.scale.y,
-            collider.localAABB.extents.z * transform.scale.z
-        };
-        
-        float centerOffsetY = collider.localAABB.center.y * transform.scale.y;
-        worldAABB.center = {
-            transform.position.x,
-            transform.position.y + centerOffsetY,
-            transform.position.z
-        };
-        
-        // Insert into spatial grid
-        m_spatialGrid.Insert(entity, worldAABB);
-    }
+    // Re-insert colliders whose transform or collider was written since the last run
+    // (Insert replaces the previous cells; an entity matching both views is just re-inserted)
+    View<const ColliderComponent, const TransformComponent, Changed<TransformComponent>> moved(m_componentManager, since);
+    moved.Each(refresh);
+    
+    View<const ColliderComponent, const TransformComponent, Changed<ColliderComponent>> resized(m_componentManager, since);
+    resized.Each(refresh);
+}
+
+void PhysicsSystem::InsertIntoSpatialGrid(Entity entity, const ColliderComponent& collider, const TransformComponent& transform) {
+    // Calculate world-space AABB
+    AABB worldAABB;
+    worldAABB.extents = {
+        collider.localAABB.extents.x * transform.scale.x,
+        collider.localAABB.extents.y * transform.scale.y,
+        collider.localAABB.extents.z * transform.scale.z
+    };
+    
+    float centerOffsetY = collider.localAABB.center.y * transform.scale.y;
+    worldAABB.center = {
+        transform.position.x,
+        transform.position.y + centerOffsetY,
+        transform.position.z
+    };
+    
+    m_spatialGrid.Insert(entity, worldAABB);
 }
 
 void PhysicsSystem::ApplyGravity(PhysicsComponent& physics, float dt) {
@@ -106,9 +148,11 @@ void PhysicsSystem::IntegrateVelocity(TransformComponent& transform, PhysicsComp
 
 void PhysicsSystem::CheckGroundCollision(Entity entity, TransformComponent& transform, PhysicsComponent& physics) {
     // Full collision detection using spatial grid
-    if (!m_componentManager.HasComponent<ColliderComponent>(entity)) return;
+    // Other entities are only read: const access keeps them out of the change ticks
+    const ComponentManager& components = m_componentManager;
+    if (!components.HasComponent<ColliderComponent>(entity)) return;
     
-    ColliderComponent& myCollider = m_componentManager.GetComponent<ColliderComponent>(entity);
+    const ColliderComponent& myCollider = components.GetComponent<ColliderComponent>(entity);
     if (!myCollider.enabled) return;
     
     // Reset grounded state
@@ -143,13 +187,13 @@ void PhysicsSystem::CheckGroundCollision(Entity entity, TransformComponent& tran
     for (Entity other : nearbyEntities) {
         if (other == entity) continue; // Skip self
         
-        if (!m_componentManager.HasComponent<ColliderComponent>(other)) continue;
-        const ColliderComponent& otherCollider = m_componentManager.GetComponent<ColliderComponent>(other);
+        if (!components.HasComponent<ColliderComponent>(other)) continue;
+        const ColliderComponent& otherCollider = components.GetComponent<ColliderComponent>(other);
         
         if (!otherCollider.enabled) continue;
-        if (!m_componentManager.HasComponent<TransformComponent>(other)) continue;
+        if (!components.HasComponent<TransformComponent>(other)) continue;
         
-        const TransformComponent& otherTransform = m_componentManager.GetComponent<TransformComponent>(other);
+        const TransformComponent& otherTransform = components.GetComponent<TransformComponent>(other);
         
         // Calculate other's world-space AABB
         DirectX::XMFLOAT3 otherExtents = {
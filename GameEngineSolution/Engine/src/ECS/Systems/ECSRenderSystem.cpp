@@ -1,58 +1,55 @@
 #include "../../../include/ECS/Systems/ECSRenderSystem.h"
+#include "../../../include/ECS/Systems/TransformSystem.h"
 #include "../../../include/Renderer/Mesh.h"
 #include "../../../include/Renderer/Material.h"
 #include "../../../include/Renderer/Graphics.h"
-#include "../../../include/Events/ECSEvents.h"
-#include "../../../include/Events/EventBus.h"
 #include "../../../include/ECS/Components.h"
+#include "../../../include/ECS/View.h"
+#include "../../../include/Jobs/ParallelFor.h"
 #include "../../../include/Utils/Logger.h"
 #include <DirectXMath.h>
 #include <algorithm>
-#include <cmath>
 
 using namespace DirectX;
 
 namespace ECS {
 
 void RenderSystem::Init() {
-    if (!m_eventBus) {
-        LOG_ERROR("RenderSystem: EventBus is null in Init!");
-        return;
+    // A world matrix arriving (from TransformSystem) or going away refreshes the entry:
+    // the entity falls back to its local transform
+    WatchComponents<RenderComponent, TransformComponent, WorldMatrixComponent>();
+    LOG_INFO("RenderSystem: Initialized and watching render components.");
+}
+
+void RenderSystem::OnComponentAdded(Entity entity, std::type_index componentType) {
+    UpdateCacheEntry(entity);
+}
+
+void RenderSystem::OnComponentRemoved(Entity entity, std::type_index componentType) {
+    if (componentType == typeid(WorldMatrixComponent)) {
+        UpdateCacheEntry(entity);
+    } else {
+        RemoveCacheEntry(entity);
     }
-    LOG_INFO("RenderSystem: Initialized and subscribing to events.");
-
-    // Subscribe to ComponentAdded events
-    m_eventSubscriptions.push_back(
-        m_eventBus->Subscribe(EventType::ComponentAdded, [this](Event& e) {
-            auto& event = static_cast<ComponentAddedEvent&>(e);
-            // Check if relevant component
-            if (event.componentType == typeid(RenderComponent) || 
-                event.componentType == typeid(TransformComponent)) {
-                OnComponentAdded(event.entity);
-            }
-        })
-    );
-
-    // Subscribe to ComponentRemoved events
-    m_eventSubscriptions.push_back(
-        m_eventBus->Subscribe(EventType::ComponentRemoved, [this](Event& e) {
-            auto& event = static_cast<ComponentRemovedEvent&>(e);
-            if (event.componentType == typeid(RenderComponent) ||
-                event.componentType == typeid(TransformComponent)) {
-                OnComponentRemoved(event.entity);
-            }
-        })
-    );
 }
 
-void RenderSystem::Shutdown() {
-    if (!m_eventBus) return;
-    
-    for (auto id : m_eventSubscriptions) {
-        m_eventBus->Unsubscribe(EventType::ComponentAdded, id);
-        m_eventBus->Unsubscribe(EventType::ComponentRemoved, id);
+// Destroyed entities leave their batch (their shared value may have been released)
+void RenderSystem::OnEntityDestroyed(Entity entity) {
+    RemoveCacheEntry(entity);
+}
+
+// Disabled entities leave their batch, enabled ones come back
+void RenderSystem::OnEntityEnabledChanged(Entity entity, bool enabled) {
+    if (enabled) {
+        UpdateCacheEntry(entity);
+    } else {
+        RemoveCacheEntry(entity);
     }
-    m_eventSubscriptions.clear();
+}
+
+// Changes were lost: rebuild the batches from the current world
+void RenderSystem::OnReactiveQueueOverflow() {
+    RebuildRenderCache();
 }
 
 void RenderSystem::Update(float deltaTime) {
@@ -64,32 +61,30 @@ void RenderSystem::Render(Renderer* renderer, Camera& camera, const DirectionalL
     
     // Gather lights
     std::vector<PointLight> lights;
-    auto lightEntities = m_componentManager.QueryEntities<LightComponent, TransformComponent>();
+    View<const LightComponent, const TransformComponent> lightView(m_componentManager);
     
-    for (Entity entity : lightEntities) {
-        auto& light = m_componentManager.GetComponent<LightComponent>(entity);
-        auto& transform = m_componentManager.GetComponent<TransformComponent>(entity);
-        
-        if (!light.enabled) continue;
+    lightView.Each([&](Entity, const LightComponent& light, const TransformComponent& transform) {
+        if (!light.enabled) return;
         
         PointLight pl;
         pl.position = DirectX::XMFLOAT4(transform.position.x, transform.position.y, transform.position.z, light.range);
         pl.color = light.color;
         pl.attenuation = DirectX::XMFLOAT4(1.0f, 0.09f, 0.032f, 0.0f); 
         lights.push_back(pl);
-    }
+    });
 
-    // Build instances from cache
-    // Build instances from cache
-    std::vector<const Renderer::RenderInstance*> instances;
-    instances.reserve(m_renderCache.size());
-    
-    for (const auto& entry : m_renderCache) {
-        instances.push_back(&entry.instance);
+    // One batch per mesh/material value; every entity in a batch shares the value
+    m_frameBatches.clear();
+    for (uint32_t batch = 0; batch < m_batches.size(); ++batch) {
+        const auto& instances = m_batches[batch].instances;
+        if (instances.empty()) continue;
+        
+        const RenderComponent& render = m_renderValues->GetValue(batch);
+        m_frameBatches.push_back({ render.mesh, render.material.get(), instances });
     }
 
     // Render scene
-    renderer->RenderFrame(camera, instances, dirLight, lights);
+    renderer->RenderFrame(camera, m_frameBatches, dirLight, lights);
 }
 
 void RenderSystem::RenderDebug(Renderer* renderer, Camera& camera) {
@@ -98,27 +93,14 @@ void RenderSystem::RenderDebug(Renderer* renderer, Camera& camera) {
     // Get all entities with Collider and Transform
     std::vector<AABB> aabbs;
     
-    auto entities = m_componentManager.QueryEntities<ColliderComponent, TransformComponent>();
+    View<const ColliderComponent, const TransformComponent> view(m_componentManager);
     
-    for (Entity entity : entities) {
-        auto& collider = m_componentManager.GetComponent<ColliderComponent>(entity);
+    view.Each([&](Entity entity, const ColliderComponent& collider, const TransformComponent& transform) {
+        if (!collider.enabled) return;
         
-        if (!collider.enabled) continue;
-        
-        auto& transform = m_componentManager.GetComponent<TransformComponent>(entity);
-        
-        // Calculate world-space AABB
-        AABB worldAABB;
-        worldAABB.extents.x = transform.scale.x * collider.localAABB.extents.x;
-        worldAABB.extents.y = transform.scale.y * collider.localAABB.extents.y;
-        worldAABB.extents.z = transform.scale.z * collider.localAABB.extents.z;
-        
-        worldAABB.center.x = transform.position.x + (transform.scale.x * collider.localAABB.center.x);
-        worldAABB.center.y = transform.position.y + (transform.scale.y * collider.localAABB.center.y);
-        worldAABB.center.z = transform.position.z + (transform.scale.z * collider.localAABB.center.z);
-        
-        aabbs.push_back(worldAABB);
-    }
+        // World-space AABB (parents and rotation included, as the weapon hit tests see it)
+        aabbs.push_back(TransformSystem::GetWorldBounds(m_componentManager, entity, transform, collider.localAABB));
+    });
     
     renderer->RenderDebugAABBs(camera, aabbs);
 }
@@ -129,167 +111,212 @@ void RenderSystem::RenderDebug(Renderer* renderer, Camera& camera) {
 
 void RenderSystem::RebuildRenderCache()
 {
-    m_renderCache.clear();
-    m_entityToRenderCacheIndex.clear();
-
-    auto renderArray = m_componentManager.GetComponentArray<RenderComponent>();
-    auto& renderVec = renderArray->GetComponentArray();
-    
-    m_renderCache.reserve(renderVec.size());
-
-    for (size_t i = 0; i < renderVec.size(); ++i) {
-        Entity entity = renderArray->GetEntityAtIndex(i);
-        RenderComponent& render = renderVec[i];
-        
-        if (!render.mesh || !render.material) continue;
-        
-        if (!m_componentManager.HasComponent<TransformComponent>(entity)) continue;
-        TransformComponent& transform = m_componentManager.GetComponent<TransformComponent>(entity);
-        
-        CreateRenderCacheEntry(entity, &transform, &render);
-    }
+    m_batches.clear();
+    m_entityToCacheLocation.clear();
+    m_interpolating.clear();
+    ClearReactiveQueue(); // Everything queued so far is part of the current world
+
+    const ComponentManager& components = m_componentManager;
+    m_renderValues->ForEachValue([&](uint32_t valueIndex, const RenderComponent& render, std::span<const Entity> entities) {
+        if (!render.mesh || !render.material) return;
+        for (Entity entity : entities) {
+            if (!components.IsEntityEnabled(entity)) continue;
+            if (const auto* transform = components.GetComponentPtr<TransformComponent>(entity)) {
+                CreateRenderCacheEntry(entity, valueIndex, *transform, render);
+            }
+        }
+    });
 }
 
 void RenderSystem::UpdateRenderCache()
 {
-    for (size_t i = 0; i < m_renderCache.size();)
-    {
-        Entity entity = m_renderCache[i].entity;
-        
-        // Check if components still exist
-        if (!m_componentManager.HasComponent<TransformComponent>(entity) ||
-            !m_componentManager.HasComponent<RenderComponent>(entity))
-        {
-            RemoveRenderCacheEntry(i);
-            continue;
+    // Only components written since this system's previous run are looked at;
+    // static props cost a single tick compare per frame.
+    const uint32_t since = GetLastRunTick();
+    const ComponentManager& components = m_componentManager;
+
+    // Pass 1 (sequential): entities that got a RenderComponent or moved to another
+    // mesh/material value change batch
+    const std::vector<Entity>& renderEntities = m_renderValues->GetEntityArray();
+    for (size_t i = 0; i < renderEntities.size(); ++i) {
+        if (m_renderValues->GetChangedTick(i) > since) {
+            UpdateCacheEntry(renderEntities[i]);
         }
-        
-        auto& transform = m_componentManager.GetComponent<TransformComponent>(entity);
-        auto& render = m_componentManager.GetComponent<RenderComponent>(entity);
+    }
 
-        if (!render.mesh || !render.material)
-        {
-            RemoveRenderCacheEntry(i);
-            continue;
+    // Pass 2 (sequential): collect entries whose world matrix, transform or collider changed
+    m_dirtyEntries.clear();
+    auto markDirty = [&](Entity entity) {
+        auto it = m_entityToCacheLocation.find(entity);
+        if (it == m_entityToCacheLocation.end()) return;
+        uint8_t& dirty = m_batches[it->second.batch].dirty[it->second.index];
+        if (!dirty) {
+            dirty = 1;
+            m_dirtyEntries.push_back(it->second);
         }
+    };
 
-        bool transformChanged =
-            transform.position.x != m_renderCache[i].lastPosition.x ||
-            transform.position.y != m_renderCache[i].lastPosition.y ||
-            transform.position.z != m_renderCache[i].lastPosition.z ||
-            transform.rotation.x != m_renderCache[i].lastRotation.x ||
-            transform.rotation.y != m_renderCache[i].lastRotation.y ||
-            transform.rotation.z != m_renderCache[i].lastRotation.z ||
-            transform.scale.x != m_renderCache[i].lastScale.x ||
-            transform.scale.y != m_renderCache[i].lastScale.y ||
-            transform.scale.z != m_renderCache[i].lastScale.z;
-
-        bool renderChanged =
-            render.mesh != m_renderCache[i].instance.mesh ||
-            render.material.get() != m_renderCache[i].instance.material;
-
-        if (transformChanged || renderChanged)
-        {
-            RefreshRenderCacheEntry(i, &transform, &render);
+    // Moving entities are re-blended every frame with the new alpha, not only on the
+    // frames a tick wrote their matrices; they stop once TransformSystem settles them
+    m_nextInterpolating.clear();
+    auto trackMotion = [&](Entity entity, const WorldMatrixComponent& matrices) {
+        if (matrices.IsMoving() && m_entityToCacheLocation.contains(entity)) {
+            m_nextInterpolating.push_back(entity);
         }
+    };
+
+    View<const WorldMatrixComponent, Changed<WorldMatrixComponent>> moved(m_componentManager, since);
+    moved.Each([&](Entity entity, const WorldMatrixComponent& matrices) {
+        markDirty(entity);
+        trackMotion(entity, matrices);
+    });
 
-        ++i;
+    for (Entity entity : m_interpolating) {
+        auto it = m_entityToCacheLocation.find(entity);
+        if (it == m_entityToCacheLocation.end() || m_batches[it->second.batch].dirty[it->second.index]) {
+            continue; // Gone, or already handled by 'moved'
+        }
+        if (const auto* matrices = components.GetComponentPtr<WorldMatrixComponent>(entity)) {
+            markDirty(entity);
+            trackMotion(entity, *matrices);
+        }
     }
+    m_interpolating.swap(m_nextInterpolating);
+
+    // Entities TransformSystem hasn't reached yet render from their local transform
+    View<const TransformComponent, Changed<TransformComponent>> unresolved(m_componentManager, since);
+    unresolved.Each([&](Entity entity, const TransformComponent&) {
+        if (!components.HasComponent<WorldMatrixComponent>(entity)) markDirty(entity);
+    });
+
+    View<const ColliderComponent, Changed<ColliderComponent>> resized(m_componentManager, since);
+    resized.Each([&](Entity entity, const ColliderComponent&) { markDirty(entity); });
+
+    // Pass 3 (parallel): refresh dirty entries; each job only writes its own entries
+    Jobs::ParallelFor(m_dirtyEntries.size(), CACHE_UPDATE_GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            CacheLocation location = m_dirtyEntries[i];
+            RenderBatchCache& batch = m_batches[location.batch];
+            RefreshRenderCacheEntry(location,
+                components.GetComponent<TransformComponent>(batch.entities[location.index]),
+                m_renderValues->GetValue(location.batch));
+            batch.dirty[location.index] = 0;
+        }
+    });
 }
 
-void RenderSystem::RemoveRenderCacheEntry(size_t index)
+void RenderSystem::RemoveRenderCacheEntry(CacheLocation location)
 {
-    if (index >= m_renderCache.size()) return;
-
-    Entity entity = m_renderCache[index].entity;
-    m_entityToRenderCacheIndex.erase(entity);
+    RenderBatchCache& batch = m_batches[location.batch];
+    m_entityToCacheLocation.erase(batch.entities[location.index]);
 
-    size_t lastIndex = m_renderCache.size() - 1;
-    if (index != lastIndex)
+    size_t lastIndex = batch.entities.size() - 1;
+    if (location.index != lastIndex)
     {
-        std::swap(m_renderCache[index], m_renderCache[lastIndex]);
-        m_entityToRenderCacheIndex[m_renderCache[index].entity] = index;
+        batch.entities[location.index] = batch.entities[lastIndex];
+        batch.instances[location.index] = batch.instances[lastIndex];
+        batch.dirty[location.index] = batch.dirty[lastIndex];
+        m_entityToCacheLocation[batch.entities[location.index]] = location;
     }
 
-    m_renderCache.pop_back();
+    batch.entities.pop_back();
+    batch.instances.pop_back();
+    batch.dirty.pop_back();
 }
 
-void RenderSystem::RefreshRenderCacheEntry(size_t index, const TransformComponent* transform, const RenderComponent* render)
+void RenderSystem::RefreshRenderCacheEntry(CacheLocation location, const TransformComponent& transform, const RenderComponent& render)
 {
-    auto& entry = m_renderCache[index];
-    entry.instance.mesh = render->mesh;
-    entry.instance.material = render->material.get();
-    entry.instance.position = transform->position;
-    entry.instance.rotation = transform->rotation;
-    entry.instance.scale = transform->scale;
-    entry.instance.hasBounds = TryComputeWorldBounds(entry.entity, transform, entry.instance);
-
-    entry.lastPosition = transform->position;
-    entry.lastRotation = transform->rotation;
-    entry.lastScale = transform->scale;
+    RenderBatchCache& batch = m_batches[location.batch];
+    Entity entity = batch.entities[location.index];
+    auto& instance = batch.instances[location.index];
+    const ComponentManager& components = m_componentManager;
+    const WorldMatrixComponent* matrices = components.GetComponentPtr<WorldMatrixComponent>(entity);
+    XMStoreFloat4x4(&instance.world, matrices
+        ? TransformSystem::InterpolateWorldMatrix(*matrices, m_interpolationAlpha)
+        : TransformSystem::ComposeLocalMatrix(transform));
+    instance.hasBounds = TryComputeWorldBounds(entity, render, instance);
 }
 
-void RenderSystem::CreateRenderCacheEntry(Entity entity, const TransformComponent* transform, const RenderComponent* render)
+void RenderSystem::CreateRenderCacheEntry(Entity entity, uint32_t batch, const TransformComponent& transform, const RenderComponent& render)
 {
-    RenderCacheEntry entry;
-    entry.entity = entity;
-    entry.instance.mesh = render->mesh;
-    entry.instance.material = render->material.get();
-    entry.instance.position = transform->position;
-    entry.instance.rotation = transform->rotation;
-    entry.instance.scale = transform->scale;
-    entry.instance.hasBounds = TryComputeWorldBounds(entity, transform, entry.instance);
-    entry.lastPosition = transform->position;
-    entry.lastRotation = transform->rotation;
-    entry.lastScale = transform->scale;
-
-    m_entityToRenderCacheIndex[entity] = m_renderCache.size();
-    m_renderCache.push_back(entry);
+    if (batch >= m_batches.size()) {
+        m_batches.resize(static_cast<size_t>(batch) + 1);
+    }
+
+    RenderBatchCache& cache = m_batches[batch];
+    CacheLocation location{ batch, static_cast<uint32_t>(cache.entities.size()) };
+    cache.entities.push_back(entity);
+    cache.instances.emplace_back();
+    cache.dirty.push_back(0);
+    m_entityToCacheLocation[entity] = location;
+
+    RefreshRenderCacheEntry(location, transform, render);
 }
 
-bool RenderSystem::TryComputeWorldBounds(Entity entity, const TransformComponent* transform, Renderer::RenderInstance& instance)
+bool RenderSystem::TryComputeWorldBounds(Entity entity, const RenderComponent& render, Renderer::RenderInstance& instance)
 {
-    if (!transform) return false;
-
+    // Bounds follow the full world matrix (parents and rotation included)
+    const XMMATRIX world = XMLoadFloat4x4(&instance.world);
     auto computeFromLocal = [&](const AABB& localBounds)
     {
-        instance.worldAABB.extents.x = std::abs(transform->scale.x) * localBounds.extents.x;
-        instance.worldAABB.extents.y = std::abs(transform->scale.y) * localBounds.extents.y;
-        instance.worldAABB.extents.z = std::abs(transform->scale.z) * localBounds.extents.z;
-
-        instance.worldAABB.center.x = transform->position.x + transform->scale.x * localBounds.center.x;
-        instance.worldAABB.center.y = transform->position.y + transform->scale.y * localBounds.center.y;
-        instance.worldAABB.center.z = transform->position.z + transform->scale.z * localBounds.center.z;
+        instance.worldAABB = TransformAABB(localBounds, world);
     };
 
-    if (m_componentManager.HasComponent<ColliderComponent>(entity))
+    const ComponentManager& components = m_componentManager;
+
+    if (components.HasComponent<ColliderComponent>(entity))
     {
-        auto& collider = m_componentManager.GetComponent<ColliderComponent>(entity);
+        const auto& collider = components.GetComponent<ColliderComponent>(entity);
         if (collider.enabled) {
             computeFromLocal(collider.localAABB);
             return true;
         }
     }
 
-    if (m_componentManager.HasComponent<RenderComponent>(entity))
+    if (render.mesh)
     {
-        auto& render = m_componentManager.GetComponent<RenderComponent>(entity);
-        if (render.mesh) {
-            computeFromLocal(render.mesh->GetLocalBounds());
-            return true;
-        }
+        computeFromLocal(render.mesh->GetLocalBounds());
+        return true;
     }
 
     return false;
 }
 
-void RenderSystem::OnComponentAdded(Entity entity) {
-    LOG_INFO("RenderSystem: Component Added to Entity " + std::to_string(entity.id) + ". Rebuilding Cache...");
-    RebuildRenderCache();
+void RenderSystem::UpdateCacheEntry(Entity entity) {
+    // Entities become renderable once they are enabled and have both a transform and a
+    // complete render component
+    const ComponentManager& components = m_componentManager;
+    if (!components.IsEntityEnabled(entity) ||
+        !components.HasComponent<TransformComponent>(entity) ||
+        !components.HasComponent<RenderComponent>(entity)) {
+        return;
+    }
+    
+    const auto& transform = components.GetComponent<TransformComponent>(entity);
+    const auto& render = components.GetComponent<RenderComponent>(entity);
+    const uint32_t batch = m_renderValues->GetValueIndex(entity);
+    
+    auto it = m_entityToCacheLocation.find(entity);
+    if (it != m_entityToCacheLocation.end()) {
+        if (it->second.batch == batch && render.mesh && render.material) {
+            RefreshRenderCacheEntry(it->second, transform, render);
+            return;
+        }
+        // New mesh/material value: the entity moves to that value's batch
+        RemoveRenderCacheEntry(it->second);
+    }
+    
+    if (render.mesh && render.material) {
+        CreateRenderCacheEntry(entity, batch, transform, render);
+    }
 }
 
-void RenderSystem::OnComponentRemoved(Entity entity) {
-    RebuildRenderCache();
+void RenderSystem::RemoveCacheEntry(Entity entity) {
+    auto it = m_entityToCacheLocation.find(entity);
+    if (it != m_entityToCacheLocation.end()) {
+        RemoveRenderCacheEntry(it->second);
+    }
 }
 
 } // namespace ECS
@@ -8,16 +8,14 @@ namespace ECS {
 void InputSystem::Init() {
     if (m_eventBus) {
         // Subscribe to Mouse Button Pressed
-        m_eventBus->Subscribe(EventType::MouseButtonPressed, [this](Event& e) {
-            MouseButtonPressedEvent& event = static_cast<MouseButtonPressedEvent&>(e);
+        m_eventBus->Channel<MouseButtonPressedEvent>().Subscribe([this](MouseButtonPressedEvent& event) {
             if (event.GetMouseButton() == VK_RBUTTON) {
                 m_input.SetMouseLock(true);
             }
         });
 
         // Subscribe to Mouse Button Released
-        m_eventBus->Subscribe(EventType::MouseButtonReleased, [this](Event& e) {
-            MouseButtonReleasedEvent& event = static_cast<MouseButtonReleasedEvent&>(e);
+        m_eventBus->Channel<MouseButtonReleasedEvent>().Subscribe([this](MouseButtonReleasedEvent& event) {
             if (event.GetMouseButton() == VK_RBUTTON) {
                 m_input.SetMouseLock(false);
             }
@@ -30,6 +28,11 @@ void InputSystem::Update(float deltaTime) {
     // (Assuming only players are controlled by hardware input)
     auto entities = m_componentManager.QueryEntities<InputComponent, PlayerControllerComponent>();
 
+    // Runs once per simulation tick: take the mouse movement since the previous tick
+    int mouseDx = 0;
+    int mouseDy = 0;
+    m_input.ConsumeMouseDelta(mouseDx, mouseDy);
+
     for (Entity entity : entities) {
         auto& inputComp = m_componentManager.GetComponent<InputComponent>(entity);
         
@@ -46,8 +49,8 @@ void InputSystem::Update(float deltaTime) {
         if (m_input.IsActionDown(Action::MoveLeft)) inputComp.moveX -= 1.0f;
 
         // Map Look Axes
-        inputComp.lookX = static_cast<float>(m_input.GetMouseDeltaX());
-        inputComp.lookY = static_cast<float>(m_input.GetMouseDeltaY());
+        inputComp.lookX = static_cast<float>(mouseDx);
+        inputComp.lookY = static_cast<float>(mouseDy);
 
         // Map Actions
         inputComp.jump = m_input.IsActionDown(Action::Jump);
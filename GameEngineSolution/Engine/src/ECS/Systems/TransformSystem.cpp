@@ -0,0 +1,348 @@
+#include "../../../include/ECS/Systems/TransformSystem.h"
+#include "../../../include/ECS/View.h"
+#include "../../../include/Jobs/ParallelFor.h"
+#include "../../../include/Utils/Logger.h"
+#include <algorithm>
+
+using namespace DirectX;
+
+namespace ECS {
+
+void TransformSystem::Init() {
+    m_transformArray = m_componentManager.GetComponentArray<TransformComponent>();
+    m_worldArray = m_componentManager.GetComponentArray<WorldMatrixComponent>();
+    m_hierarchyDirty = true;
+
+    // Added and removed transforms/parents change the depth order; re-parenting
+    // is picked up through Changed<ParentComponent> in Update()
+    WatchComponents<TransformComponent, ParentComponent>();
+}
+
+void TransformSystem::OnComponentAdded(Entity entity, std::type_index componentType) {
+    if (componentType == std::type_index(typeid(TransformComponent))) {
+        AddNode(entity);
+    } else {
+        m_hierarchyDirty = true;
+    }
+}
+
+void TransformSystem::OnComponentRemoved(Entity entity, std::type_index componentType) {
+    m_hierarchyDirty = true;
+}
+
+void TransformSystem::OnEntityDestroyed(Entity entity) {
+    if (m_nodeIndex.contains(entity)) {
+        m_hierarchyDirty = true;
+    }
+}
+
+// Re-enabled entities were usually moved while parked: no blend from the old spot
+void TransformSystem::OnEntityEnabledChanged(Entity entity, bool enabled) {
+    if (!enabled) return;
+    if (m_nodeIndex.contains(entity)) {
+        Teleport(entity);
+    } else if (m_componentManager.HasComponent<TransformComponent>(entity)) {
+        AddNode(entity);
+    }
+}
+
+void TransformSystem::OnReactiveQueueOverflow() {
+    m_hierarchyDirty = true;
+}
+
+void TransformSystem::Teleport(Entity entity) {
+    std::lock_guard<std::mutex> lock(m_snapMutex);
+    m_snapRequests.push_back(entity);
+}
+
+// A new transform without a parent link (and that no existing node waits on as its
+// parent) is appended to the last level as a root; roots read no other node, so any
+// level can hold them. Everything else re-sorts the hierarchy.
+void TransformSystem::AddNode(Entity entity) {
+    if (m_hierarchyDirty || m_nodeIndex.contains(entity)) {
+        return;
+    }
+    if (m_componentManager.HasComponent<ParentComponent>(entity) || m_danglingParents.contains(entity)) {
+        m_hierarchyDirty = true;
+        return;
+    }
+
+    m_nodeIndex[entity] = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.push_back({ entity, NO_PARENT });
+    m_worldMatrices.emplace_back();
+    m_dirty.push_back(1);
+    m_moved.push_back(0);
+    m_snap.push_back(1);
+    if (m_levelOffsets.size() < 2) {
+        m_levelOffsets.assign({ 0, m_nodes.size() });
+    } else {
+        m_levelOffsets.back() = m_nodes.size();
+    }
+}
+
+void TransformSystem::Update(float deltaTime) {
+    const uint32_t since = GetLastRunTick();
+
+    // Re-parented entities change the depth order
+    if (!m_hierarchyDirty) {
+        View<const ParentComponent, Changed<ParentComponent>> reparented(m_componentManager, since);
+        reparented.Each([&](Entity, const ParentComponent&) { m_hierarchyDirty = true; });
+    }
+
+    if (m_hierarchyDirty) {
+        RebuildHierarchy(); // Marks every node dirty
+        m_hierarchyDirty = false;
+    } else {
+        MarkChangedTransforms();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_snapMutex);
+        for (Entity entity : m_snapRequests) {
+            auto it = m_nodeIndex.find(entity);
+            if (it != m_nodeIndex.end()) {
+                m_snap[it->second] = 1;
+                m_dirty[it->second] = 1;
+            }
+        }
+        m_snapRequests.clear();
+    }
+
+    PropagateDirtyFlags();
+
+    // Levels are processed in order; nodes inside a level only read their parent's
+    // (already final) matrix, so each level is split across the JobSystem.
+    for (size_t level = 0; level + 1 < m_levelOffsets.size(); ++level) {
+        size_t levelBegin = m_levelOffsets[level];
+        size_t levelSize = m_levelOffsets[level + 1] - levelBegin;
+        Jobs::ParallelFor(levelSize, COMPOSE_GRAIN_SIZE, [&](size_t begin, size_t end) {
+            ComposeLevel(levelBegin + begin, levelBegin + end);
+        });
+    }
+
+    SettleStoppedNodes();
+
+    m_lastUpdatedCount = static_cast<size_t>(std::count(m_dirty.begin(), m_dirty.end(), uint8_t{ 1 }));
+    m_moved.swap(m_dirty);
+    std::fill(m_dirty.begin(), m_dirty.end(), uint8_t{ 0 });
+    std::fill(m_snap.begin(), m_snap.end(), uint8_t{ 0 });
+}
+
+XMMATRIX TransformSystem::ComposeLocalMatrix(const TransformComponent& transform) {
+    return XMMatrixScaling(transform.scale.x, transform.scale.y, transform.scale.z) *
+           XMMatrixRotationRollPitchYaw(transform.rotation.x, transform.rotation.y, transform.rotation.z) *
+           XMMatrixTranslation(transform.position.x, transform.position.y, transform.position.z);
+}
+
+XMMATRIX TransformSystem::GetWorldMatrix(const ComponentManager& componentManager, Entity entity,
+                                         const TransformComponent& transform) {
+    if (componentManager.HasComponent<WorldMatrixComponent>(entity)) {
+        return XMLoadFloat4x4(&componentManager.GetComponent<WorldMatrixComponent>(entity).world);
+    }
+    return ComposeLocalMatrix(transform);
+}
+
+AABB TransformSystem::GetWorldBounds(const ComponentManager& componentManager, Entity entity,
+                                     const TransformComponent& transform, const AABB& localBounds) {
+    return TransformAABB(localBounds, GetWorldMatrix(componentManager, entity, transform));
+}
+
+XMMATRIX TransformSystem::InterpolateWorldMatrix(const WorldMatrixComponent& matrices, float alpha) {
+    const XMMATRIX world = XMLoadFloat4x4(&matrices.world);
+    if (alpha >= 1.0f || !matrices.IsMoving()) {
+        return world;
+    }
+
+    XMVECTOR fromScale, fromRotation, fromTranslation;
+    XMVECTOR toScale, toRotation, toTranslation;
+    if (!XMMatrixDecompose(&fromScale, &fromRotation, &fromTranslation, XMLoadFloat4x4(&matrices.previous)) ||
+        !XMMatrixDecompose(&toScale, &toRotation, &toTranslation, world)) {
+        return world; // Degenerate (zero scale) or sheared: no blend
+    }
+
+    const float t = (std::max)(alpha, 0.0f);
+    return XMMatrixAffineTransformation(
+        XMVectorLerp(fromScale, toScale, t),
+        XMVectorZero(),
+        XMQuaternionSlerp(fromRotation, toRotation, t),
+        XMVectorLerp(fromTranslation, toTranslation, t));
+}
+
+// ==================================================================================
+// Hierarchy Maintenance
+// ==================================================================================
+
+void TransformSystem::RebuildHierarchy() {
+    const ComponentManager& components = m_componentManager;
+    const std::vector<Entity>& entities = m_transformArray->GetEntityArray();
+    const size_t count = entities.size();
+
+    // Parent of an entity if it is a valid entity with a transform, NULL_ENTITY otherwise.
+    // Valid parents without a transform are remembered: giving them one links the child.
+    m_danglingParents.clear();
+    auto parentOf = [&](Entity entity) -> Entity {
+        const ParentComponent* parent = components.HasComponent<ParentComponent>(entity)
+            ? &components.GetComponent<ParentComponent>(entity) : nullptr;
+        if (!parent || !components.IsEntityValid(parent->parent)) {
+            return NULL_ENTITY;
+        }
+        if (m_transformArray->GetIndex(parent->parent) == ComponentArray<TransformComponent>::INVALID_INDEX) {
+            m_danglingParents.insert(parent->parent);
+            return NULL_ENTITY;
+        }
+        return parent->parent;
+    };
+
+    // Pass 1: break parent cycles; the entity that closes a cycle is treated as a root
+    enum class VisitState : uint8_t { InProgress, Done };
+    std::unordered_map<Entity, VisitState> visited;
+    std::unordered_map<Entity, Entity> parents;
+    visited.reserve(count);
+    parents.reserve(count);
+    std::vector<Entity> chain;
+
+    for (Entity entity : entities) {
+        chain.clear();
+        Entity current = entity;
+        while (current != NULL_ENTITY && !visited.contains(current)) {
+            visited[current] = VisitState::InProgress;
+            chain.push_back(current);
+            Entity parent = parentOf(current);
+            parents[current] = parent;
+            current = parent;
+        }
+        if (current != NULL_ENTITY && visited[current] == VisitState::InProgress) {
+            LOG_WARNING("TransformSystem: parent cycle detected, treating entity as a root");
+            parents[current] = NULL_ENTITY;
+        }
+        for (Entity member : chain) {
+            visited[member] = VisitState::Done;
+        }
+    }
+
+    // Pass 2: depth per entity; chains are walked once and memoized
+    std::unordered_map<Entity, uint32_t> depths;
+    depths.reserve(count);
+    uint32_t maxDepth = 0;
+
+    for (Entity entity : entities) {
+        chain.clear();
+        Entity current = entity;
+        uint32_t baseDepth = 0;
+        while (current != NULL_ENTITY) {
+            auto known = depths.find(current);
+            if (known != depths.end()) {
+                baseDepth = known->second + 1;
+                break;
+            }
+            chain.push_back(current);
+            current = parents[current];
+        }
+
+        // chain.back() is the topmost unresolved ancestor
+        for (size_t i = chain.size(); i-- > 0;) {
+            uint32_t depth = baseDepth + static_cast<uint32_t>(chain.size() - 1 - i);
+            depths.emplace(chain[i], depth);
+            maxDepth = (std::max)(maxDepth, depth);
+        }
+    }
+
+    // Counting sort by depth (stable: dense array order is kept within a level)
+    m_levelOffsets.assign(count > 0 ? maxDepth + 2 : 1, 0);
+    for (Entity entity : entities) {
+        ++m_levelOffsets[depths[entity] + 1];
+    }
+    for (size_t level = 1; level < m_levelOffsets.size(); ++level) {
+        m_levelOffsets[level] += m_levelOffsets[level - 1];
+    }
+
+    // Entities that were not nodes before start without a blend
+    std::unordered_map<Entity, uint32_t> previousIndex;
+    previousIndex.swap(m_nodeIndex);
+    m_snap.assign(count, uint8_t{ 0 });
+
+    std::vector<size_t> cursor(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+    m_nodes.resize(count);
+    m_nodeIndex.reserve(count);
+    for (Entity entity : entities) {
+        size_t index = cursor[depths[entity]]++;
+        m_nodes[index].entity = entity;
+        m_nodeIndex[entity] = static_cast<uint32_t>(index);
+        m_snap[index] = previousIndex.contains(entity) ? 0 : 1;
+    }
+
+    for (auto& node : m_nodes) {
+        Entity parent = parents[node.entity];
+        node.parent = parent != NULL_ENTITY ? m_nodeIndex[parent] : NO_PARENT;
+    }
+
+    m_worldMatrices.resize(count);
+    m_dirty.assign(count, uint8_t{ 1 });
+    m_moved.assign(count, uint8_t{ 1 }); // Node order changed: check every node next run
+}
+
+void TransformSystem::MarkChangedTransforms() {
+    View<const TransformComponent, Changed<TransformComponent>> moved(m_componentManager, GetLastRunTick());
+    moved.Each([&](Entity entity, const TransformComponent&) {
+        auto it = m_nodeIndex.find(entity);
+        if (it != m_nodeIndex.end()) {
+            m_dirty[it->second] = 1;
+        }
+    });
+}
+
+void TransformSystem::PropagateDirtyFlags() {
+    // Parents precede their children, so one forward pass reaches whole subtrees
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+        uint32_t parent = m_nodes[i].parent;
+        if (parent != NO_PARENT && m_dirty[parent]) {
+            m_dirty[i] = 1;
+        }
+    }
+}
+
+void TransformSystem::ComposeLevel(size_t begin, size_t end) {
+    const ComponentArray<TransformComponent>& transforms = *m_transformArray;
+    std::vector<WorldMatrixComponent>& worlds = m_worldArray->GetComponentArray();
+
+    for (size_t i = begin; i < end; ++i) {
+        if (!m_dirty[i]) continue;
+
+        const HierarchyNode& node = m_nodes[i];
+        const TransformComponent* transform = transforms.TryGetData(node.entity);
+        if (!transform) continue;
+
+        XMMATRIX world = ComposeLocalMatrix(*transform);
+        if (node.parent != NO_PARENT) {
+            world = XMMatrixMultiply(world, XMLoadFloat4x4(&m_worldMatrices[node.parent]));
+        }
+        XMStoreFloat4x4(&m_worldMatrices[i], world);
+
+        uint32_t slot = m_worldArray->GetIndex(node.entity);
+        if (slot == ComponentArray<WorldMatrixComponent>::INVALID_INDEX) {
+            Commands().AddComponent(node.entity, WorldMatrixComponent{ m_worldMatrices[i] });
+        } else {
+            worlds[slot].previous = m_snap[i] ? m_worldMatrices[i] : worlds[slot].world;
+            worlds[slot].world = m_worldMatrices[i];
+            m_worldArray->MarkChangedAtIndex(slot);
+        }
+    }
+}
+
+void TransformSystem::SettleStoppedNodes() {
+    // Nodes that moved on the previous run but not on this one have been at rest for a
+    // whole tick: their previous matrix catches up so renderers stop blending them
+    std::vector<WorldMatrixComponent>& worlds = m_worldArray->GetComponentArray();
+
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+        if (!m_moved[i] || m_dirty[i]) continue;
+
+        uint32_t slot = m_worldArray->GetIndex(m_nodes[i].entity);
+        if (slot == ComponentArray<WorldMatrixComponent>::INVALID_INDEX || !worlds[slot].IsMoving()) continue;
+
+        worlds[slot].previous = worlds[slot].world;
+        m_worldArray->MarkChangedAtIndex(slot);
+    }
+}
+
+} // namespace ECS
@@ -0,0 +1,369 @@
+#include "../../include/Events/EventTrace.h"
+#include "../../include/Events/ApplicationEvents.h"
+#include "../../include/Events/ECSEvents.h"
+#include "../../include/Events/InputEvents.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+
+namespace {
+    constexpr char TRACE_MAGIC[4] = { 'E', 'V', 'T', 'R' };
+    constexpr uint32_t TRACE_VERSION = 1;
+
+    // EventRecorder slot sequence while a writer fills it
+    constexpr uint64_t WRITING = UINT64_MAX;
+
+    // Appends values to a record's payload
+    class PayloadWriter {
+    public:
+        explicit PayloadWriter(std::array<std::byte, EventTraceRecord::MAX_PAYLOAD>& payload) : m_payload(payload) {}
+
+        template<typename T>
+        void Write(const T& value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            std::memcpy(m_payload.data() + m_size, &value, sizeof(T));
+            m_size += sizeof(T);
+        }
+
+        void Write(const ECS::Entity& entity) {
+            Write(entity.id);
+            Write(entity.version);
+        }
+
+        size_t GetSize() const { return m_size; }
+
+    private:
+        std::array<std::byte, EventTraceRecord::MAX_PAYLOAD>& m_payload;
+        size_t m_size = 0;
+    };
+
+    // Reads a payload written by PayloadWriter; missing bytes read as zero
+    class PayloadReader {
+    public:
+        explicit PayloadReader(const EventTraceRecord& record) : m_record(record) {}
+
+        template<typename T>
+        T Read() {
+            T value{};
+            if (m_offset + sizeof(T) <= m_record.payloadSize) {
+                std::memcpy(&value, m_record.payload.data() + m_offset, sizeof(T));
+            }
+            m_offset += sizeof(T);
+            return value;
+        }
+
+        ECS::Entity ReadEntity() {
+            ECS::Entity entity;
+            entity.id = Read<uint32_t>();
+            entity.version = Read<uint32_t>();
+            return entity;
+        }
+
+    private:
+        const EventTraceRecord& m_record;
+        size_t m_offset = 0;
+    };
+
+    void WriteEntities(PayloadWriter& writer, std::span<const ECS::Entity> entities) {
+        writer.Write(static_cast<uint32_t>(entities.size()));
+        writer.Write(entities.empty() ? ECS::NULL_ENTITY : entities.front());
+    }
+
+    std::span<const ECS::Entity> ReadEntities(PayloadReader& reader, std::vector<ECS::Entity>& entities) {
+        const uint32_t count = reader.Read<uint32_t>();
+        const ECS::Entity first = reader.ReadEntity();
+        entities.assign(count, ECS::NULL_ENTITY);
+        if (count > 0) {
+            entities.front() = first;
+        }
+        return entities;
+    }
+}
+
+// ==================================================================================
+// Payload encoding
+// ==================================================================================
+
+size_t EncodeEventPayload(const Event& event, std::array<std::byte, EventTraceRecord::MAX_PAYLOAD>& payload) {
+    PayloadWriter writer(payload);
+
+    switch (event.GetEventType()) {
+        case EventType::WindowResize: {
+            const auto& e = static_cast<const WindowResizeEvent&>(event);
+            writer.Write(static_cast<uint32_t>(e.GetWidth()));
+            writer.Write(static_cast<uint32_t>(e.GetHeight()));
+            break;
+        }
+        case EventType::KeyPressed: {
+            const auto& e = static_cast<const KeyPressedEvent&>(event);
+            writer.Write(static_cast<int32_t>(e.GetKeyCode()));
+            writer.Write(static_cast<int32_t>(e.GetRepeatCount()));
+            break;
+        }
+        case EventType::KeyReleased:
+            writer.Write(static_cast<int32_t>(static_cast<const KeyReleasedEvent&>(event).GetKeyCode()));
+            break;
+        case EventType::MouseButtonPressed:
+        case EventType::MouseButtonReleased:
+            writer.Write(static_cast<int32_t>(static_cast<const MouseButtonEvent&>(event).GetMouseButton()));
+            break;
+        case EventType::MouseMoved: {
+            const auto& e = static_cast<const MouseMovedEvent&>(event);
+            writer.Write(e.GetX());
+            writer.Write(e.GetY());
+            break;
+        }
+        case EventType::ComponentAdded:
+            writer.Write(static_cast<const ComponentAddedEvent&>(event).entity);
+            break;
+        case EventType::ComponentRemoved:
+            writer.Write(static_cast<const ComponentRemovedEvent&>(event).entity);
+            break;
+        case EventType::EntityDestroyed:
+            writer.Write(static_cast<const EntityDestroyedEvent&>(event).entity);
+            break;
+        case EventType::EntityEnabledChanged: {
+            const auto& e = static_cast<const EntityEnabledChangedEvent&>(event);
+            writer.Write(e.entity);
+            writer.Write(static_cast<uint8_t>(e.enabled));
+            break;
+        }
+        case EventType::ComponentsAdded:
+            WriteEntities(writer, static_cast<const ComponentsAddedEvent&>(event).entities);
+            break;
+        case EventType::ComponentsRemoved:
+            WriteEntities(writer, static_cast<const ComponentsRemovedEvent&>(event).entities);
+            break;
+        case EventType::EntitiesDestroyed:
+            WriteEntities(writer, static_cast<const EntitiesDestroyedEvent&>(event).entities);
+            break;
+        default:
+            break;
+    }
+
+    return writer.GetSize();
+}
+
+std::unique_ptr<Event> DecodeTracedEvent(const EventTraceRecord& record, std::vector<ECS::Entity>& entities) {
+    PayloadReader reader(record);
+
+    switch (record.type) {
+        case EventType::WindowClose:
+            return std::make_unique<WindowCloseEvent>();
+        case EventType::WindowResize: {
+            const uint32_t width = reader.Read<uint32_t>();
+            return std::make_unique<WindowResizeEvent>(width, reader.Read<uint32_t>());
+        }
+        case EventType::KeyPressed: {
+            const int32_t keyCode = reader.Read<int32_t>();
+            return std::make_unique<KeyPressedEvent>(keyCode, reader.Read<int32_t>());
+        }
+        case EventType::KeyReleased:
+            return std::make_unique<KeyReleasedEvent>(reader.Read<int32_t>());
+        case EventType::MouseButtonPressed:
+            return std::make_unique<MouseButtonPressedEvent>(reader.Read<int32_t>());
+        case EventType::MouseButtonReleased:
+            return std::make_unique<MouseButtonReleasedEvent>(reader.Read<int32_t>());
+        case EventType::MouseMoved: {
+            const float x = reader.Read<float>();
+            return std::make_unique<MouseMovedEvent>(x, reader.Read<float>());
+        }
+        case EventType::ComponentAdded:
+            return std::make_unique<ComponentAddedEvent>(reader.ReadEntity(), typeid(void));
+        case EventType::ComponentRemoved:
+            return std::make_unique<ComponentRemovedEvent>(reader.ReadEntity(), typeid(void));
+        case EventType::EntityDestroyed:
+            return std::make_unique<EntityDestroyedEvent>(reader.ReadEntity());
+        case EventType::EntityEnabledChanged: {
+            const ECS::Entity entity = reader.ReadEntity();
+            return std::make_unique<EntityEnabledChangedEvent>(entity, reader.Read<uint8_t>() != 0);
+        }
+        case EventType::ComponentsAdded:
+            return std::make_unique<ComponentsAddedEvent>(typeid(void), ReadEntities(reader, entities));
+        case EventType::ComponentsRemoved:
+            return std::make_unique<ComponentsRemovedEvent>(typeid(void), ReadEntities(reader, entities));
+        case EventType::EntitiesDestroyed:
+            return std::make_unique<EntitiesDestroyedEvent>(ReadEntities(reader, entities));
+        default:
+            return nullptr;
+    }
+}
+
+// ==================================================================================
+// Trace files
+// ==================================================================================
+
+void SaveEventTrace(const std::string& path, const std::vector<EventTraceRecord>& records, uint64_t droppedCount) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Failed to open event trace for writing: " + path);
+    }
+
+    auto write = [&file](const auto& value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    file.write(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    write(TRACE_VERSION);
+    write(static_cast<uint64_t>(records.size()));
+    write(droppedCount);
+
+    for (const EventTraceRecord& record : records) {
+        write(record.timestampNs);
+        write(record.handlingNs);
+        write(static_cast<uint8_t>(record.type));
+        write(record.flags);
+        write(record.subscriberCount);
+        write(record.payloadSize);
+        file.write(reinterpret_cast<const char*>(record.payload.data()), record.payloadSize);
+    }
+
+    if (!file) {
+        throw std::runtime_error("Failed to write event trace: " + path);
+    }
+}
+
+std::vector<EventTraceRecord> LoadEventTrace(const std::string& path, uint64_t* droppedCount) {
+    static_assert(std::endian::native == std::endian::little, "Event traces are little-endian");
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Failed to open event trace: " + path);
+    }
+
+    auto read = [&file](auto& value) {
+        file.read(reinterpret_cast<char*>(&value), sizeof(value));
+    };
+
+    char magic[sizeof(TRACE_MAGIC)] = {};
+    uint32_t version = 0;
+    uint64_t count = 0;
+    uint64_t dropped = 0;
+    file.read(magic, sizeof(magic));
+    read(version);
+    read(count);
+    read(dropped);
+    if (!file || std::memcmp(magic, TRACE_MAGIC, sizeof(magic)) != 0) {
+        throw std::runtime_error("Not an event trace: " + path);
+    }
+    if (version != TRACE_VERSION) {
+        throw std::runtime_error("Unsupported event trace version " + std::to_string(version) + ": " + path);
+    }
+
+    std::vector<EventTraceRecord> records;
+    records.reserve(static_cast<size_t>(std::min<uint64_t>(count, 1u << 24)));
+    for (uint64_t i = 0; i < count; ++i) {
+        EventTraceRecord record;
+        uint8_t type = 0;
+        read(record.timestampNs);
+        read(record.handlingNs);
+        read(type);
+        read(record.flags);
+        read(record.subscriberCount);
+        read(record.payloadSize);
+        if (!file || type >= EventTypeCount || record.payloadSize > EventTraceRecord::MAX_PAYLOAD) {
+            throw std::runtime_error("Corrupt event trace (record " + std::to_string(i) + "): " + path);
+        }
+        record.type = static_cast<EventType>(type);
+        file.read(reinterpret_cast<char*>(record.payload.data()), record.payloadSize);
+        records.push_back(record);
+    }
+
+    if (!file) {
+        throw std::runtime_error("Truncated event trace: " + path);
+    }
+    if (droppedCount) {
+        *droppedCount = dropped;
+    }
+    return records;
+}
+
+// ==================================================================================
+// EventRecorder
+// ==================================================================================
+
+EventRecorder::EventRecorder(size_t capacity)
+    : m_slots(std::bit_ceil(std::max<size_t>(capacity, 1)))
+    , m_start(Clock::now()) {
+}
+
+void EventRecorder::RecordPublished(const Event& event, Clock::time_point start, Clock::time_point end,
+                                    size_t subscriberCount, bool handled) {
+    EventTraceRecord record;
+    record.timestampNs = Nanoseconds(start);
+    record.handlingNs = static_cast<uint32_t>(std::min<int64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), UINT32_MAX));
+    record.type = event.GetEventType();
+    record.flags = handled ? EventTraceRecord::Handled : 0;
+    record.subscriberCount = static_cast<uint16_t>(std::min<size_t>(subscriberCount, UINT16_MAX));
+    record.payloadSize = static_cast<uint8_t>(EncodeEventPayload(event, record.payload));
+    Write(record);
+}
+
+void EventRecorder::RecordQueued(EventType type) {
+    EventTraceRecord record;
+    record.timestampNs = Nanoseconds(Clock::now());
+    record.type = type;
+    record.flags = EventTraceRecord::Queued;
+    Write(record);
+}
+
+std::vector<EventTraceRecord> EventRecorder::GetRecords() const {
+    const uint64_t next = m_next.load(std::memory_order_acquire);
+    const uint64_t first = next > m_slots.size() ? next - m_slots.size() : 0;
+
+    std::vector<EventTraceRecord> records;
+    records.reserve(static_cast<size_t>(next - first));
+    for (uint64_t index = first; index < next; ++index) {
+        const Slot& slot = m_slots[index & (m_slots.size() - 1)];
+        // Seqlock read: keep the copy only if the slot held this record before and after it
+        if (slot.sequence.load(std::memory_order_acquire) != index + 1) {
+            continue;
+        }
+        EventTraceRecord record = slot.record;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == index + 1) {
+            records.push_back(record);
+        }
+    }
+    return records;
+}
+
+uint64_t EventRecorder::GetDroppedCount() const {
+    const uint64_t recorded = GetRecordedCount();
+    return recorded > m_slots.size() ? recorded - m_slots.size() : 0;
+}
+
+void EventRecorder::Save(const std::string& path) const {
+    std::vector<EventTraceRecord> records = GetRecords();
+    // Slots overwritten during GetRecords count as dropped too
+    SaveEventTrace(path, records, GetRecordedCount() - records.size());
+}
+
+uint64_t EventRecorder::Nanoseconds(Clock::time_point time) const {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time - m_start).count());
+}
+
+void EventRecorder::Write(const EventTraceRecord& record) {
+    const uint64_t index = m_next.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = m_slots[index & (m_slots.size() - 1)];
+
+    // Claim the slot: a writer that wrapped around the ring may still be filling it
+    uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    for (;;) {
+        if (sequence == WRITING) {
+            std::this_thread::yield();
+            sequence = slot.sequence.load(std::memory_order_relaxed);
+        } else if (slot.sequence.compare_exchange_weak(sequence, WRITING, std::memory_order_acquire, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.record = record;
+    slot.sequence.store(index + 1, std::memory_order_release);
+}
@@ -49,6 +49,8 @@ void Input::Update()
     {
         m_mouseState.dx = currentPos.x - center.x;
         m_mouseState.dy = currentPos.y - center.y;
+        m_pendingDx += m_mouseState.dx;
+        m_pendingDy += m_mouseState.dy;
 
         // Reset cursor to the center of the window
         SetCursorPos(center.x, center.y);
@@ -112,6 +114,14 @@ int Input::GetMouseDeltaY() const
     return m_mouseState.dy;
 }
 
+void Input::ConsumeMouseDelta(int& dx, int& dy)
+{
+    dx = m_pendingDx;
+    dy = m_pendingDy;
+    m_pendingDx = 0;
+    m_pendingDy = 0;
+}
+
 int Input::GetMouseX() const
 {
     return m_mouseState.x;
@@ -0,0 +1,209 @@
+#include "../../include/Jobs/JobSystem.h"
+#include <utility>
+
+namespace Jobs {
+
+namespace {
+    // Empty polls in Wait() before the thread blocks (covers short jobs without a syscall)
+    constexpr uint32_t WAIT_SPIN_COUNT = 64;
+
+    // Identifies the worker queue owned by the current thread (if it is a worker)
+    thread_local const JobSystem* t_owner = nullptr;
+    thread_local uint32_t t_queueIndex = 0;
+}
+
+JobSystem::JobSystem(uint32_t workerCount) {
+    if (workerCount == 0) {
+        uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    }
+    m_workerCount = workerCount;
+
+    // One deque per worker plus the injection queue
+    m_queues.reserve(workerCount + 1);
+    for (uint32_t i = 0; i <= workerCount; ++i) {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    m_workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_shutdown.store(true);
+    }
+    m_wakeCondition.notify_all();
+
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+JobSystem& JobSystem::Get() {
+    static JobSystem instance;
+    return instance;
+}
+
+void JobSystem::Run(Job job, JobCounter& counter) {
+    counter.m_pending.fetch_add(1, std::memory_order_relaxed);
+
+    // Counted before the push so a thief can never observe the job without the count
+    m_queuedJobs.fetch_add(1);
+
+    WorkQueue& queue = *m_queues[GetCurrentQueue()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back({ std::move(job), &counter });
+    }
+
+    // Only touch the sleep mutex when somebody is actually asleep
+    if (m_sleepingWorkers.load() > 0) {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_wakeCondition.notify_one();
+    }
+
+    // A blocked waiter may be able to help with the new job
+    SignalWaiters();
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    uint32_t ownQueue = GetCurrentQueue();
+    uint32_t idlePolls = 0;
+    while (!counter.IsDone()) {
+        if (TryRunOne(ownQueue)) {
+            idlePolls = 0;
+            continue;
+        }
+
+        if (++idlePolls < WAIT_SPIN_COUNT) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Only long jobs are left in flight: sleep until one finishes or a new job is
+        // queued. Registering before re-checking pairs with SignalWaiters(): either the
+        // re-check sees the change or the signaller sees the registration and bumps
+        // the epoch after it was read.
+        m_blockedWaiters.fetch_add(1);
+        uint32_t epoch = m_waitEpoch.load();
+        if (!counter.IsDone() && m_queuedJobs.load() == 0) {
+            m_waitEpoch.wait(epoch);
+        }
+        m_blockedWaiters.fetch_sub(1);
+        idlePolls = 0;
+    }
+
+    std::exception_ptr exception;
+    {
+        std::lock_guard<std::mutex> lock(counter.m_exceptionMutex);
+        exception = std::exchange(counter.m_exception, nullptr);
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void JobSystem::WorkerLoop(uint32_t workerIndex) {
+    t_owner = this;
+    t_queueIndex = workerIndex;
+
+    while (true) {
+        if (TryRunOne(workerIndex)) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        if (m_shutdown.load() && m_queuedJobs.load() == 0) {
+            return;
+        }
+
+        m_sleepingWorkers.fetch_add(1);
+        m_wakeCondition.wait(lock, [this]() { return m_shutdown.load() || m_queuedJobs.load() > 0; });
+        m_sleepingWorkers.fetch_sub(1);
+    }
+}
+
+bool JobSystem::TryRunOne(uint32_t ownQueue) {
+    QueuedJob queued;
+    if (TryPopOwn(ownQueue, queued) || TrySteal(ownQueue, queued)) {
+        m_queuedJobs.fetch_sub(1);
+        Execute(queued);
+        SignalWaiters();
+        return true;
+    }
+    return false;
+}
+
+bool JobSystem::TryPopOwn(uint32_t queueIndex, QueuedJob& out) {
+    WorkQueue& queue = *m_queues[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty()) {
+        return false;
+    }
+
+    // Workers pop their newest job (LIFO); the injection queue is drained in order
+    if (queueIndex < m_workerCount) {
+        out = std::move(queue.jobs.back());
+        queue.jobs.pop_back();
+    } else {
+        out = std::move(queue.jobs.front());
+        queue.jobs.pop_front();
+    }
+    return true;
+}
+
+bool JobSystem::TrySteal(uint32_t queueIndex, QueuedJob& out) {
+    // Start at a rotating victim so thieves don't all hammer the same queue
+    uint32_t queueCount = static_cast<uint32_t>(m_queues.size());
+    uint32_t start = m_stealCursor.fetch_add(1, std::memory_order_relaxed);
+
+    for (uint32_t i = 0; i < queueCount; ++i) {
+        uint32_t victim = (start + i) % queueCount;
+        if (victim == queueIndex) continue;
+
+        WorkQueue& queue = *m_queues[victim];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            out = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::SignalWaiters() {
+    // Orders the caller's counter/queue update before the registration check
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_blockedWaiters.load() > 0) {
+        m_waitEpoch.fetch_add(1);
+        m_waitEpoch.notify_all();
+    }
+}
+
+uint32_t JobSystem::GetCurrentQueue() const {
+    return t_owner == this ? t_queueIndex : m_workerCount;
+}
+
+void JobSystem::Execute(QueuedJob& queued) {
+    try {
+        queued.job();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(queued.counter->m_exceptionMutex);
+        if (!queued.counter->m_exception) {
+            queued.counter->m_exception = std::current_exception();
+        }
+    }
+
+    // Release captures before signalling: the waiter may destroy them once the counter hits zero
+    queued.job = nullptr;
+    queued.counter->m_pending.fetch_sub(1, std::memory_order_release);
+}
+
+} // namespace Jobs
@@ -50,10 +50,20 @@ Mesh::Mesh(ID3D11Device* device, const std::vector<Vertex>& vertices, const std:
 }
 
 void Mesh::Draw(ID3D11DeviceContext* context) const
+{
+    Bind(context);
+    DrawBound(context);
+}
+
+void Mesh::Bind(ID3D11DeviceContext* context) const
 {
     UINT stride = sizeof(Vertex);
     UINT offset = 0;
     context->IASetVertexBuffers(0, 1, m_vertexBuffer.GetAddressOf(), &stride, &offset);
     context->IASetIndexBuffer(m_indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
+}
+
+void Mesh::DrawBound(ID3D11DeviceContext* context) const
+{
     context->DrawIndexed(m_indexCount, 0, 0);
 }
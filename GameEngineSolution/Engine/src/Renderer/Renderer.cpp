@@ -11,7 +11,6 @@
 #include "../../include/Physics/Collision.h"
 #include "../../include/Renderer/RenderingConstants.h"
 #include <DirectXCollision.h>
-#include <algorithm>
 
 #pragma comment(lib, "d3d11.lib")
 #pragma comment(lib, "dxgi.lib")
@@ -33,36 +32,16 @@ namespace
 {
     DirectX::XMMATRIX BuildWorldMatrix(const Renderer::RenderInstance& instance)
     {
-        using namespace DirectX;
-        XMMATRIX scaleMatrix = XMMatrixScaling(instance.scale.x, instance.scale.y, instance.scale.z);
-        XMMATRIX rotationMatrix = XMMatrixRotationRollPitchYaw(instance.rotation.x, instance.rotation.y, instance.rotation.z);
-        XMMATRIX translationMatrix = XMMatrixTranslation(instance.position.x, instance.position.y, instance.position.z);
-        return scaleMatrix * rotationMatrix * translationMatrix;
-    }
-
-    void DrawInstance(ID3D11DeviceContext* context, const Renderer::RenderInstance& instance, ID3D11Buffer* psMaterialConstantBuffer)
-    {
-        if (instance.material)
-        {
-            instance.material->Bind(context, psMaterialConstantBuffer);
-        }
-
-        if (instance.mesh)
-        {
-            instance.mesh->Draw(context);
-        }
+        // Composed once per change by TransformSystem, not per draw
+        return DirectX::XMLoadFloat4x4(&instance.world);
     }
 }
 
-void Renderer::RenderFrame(
-    const Camera& camera,
-    const std::vector<const RenderInstance*>& instances,
-    const DirectionalLight& dirLight,
-    const std::vector<PointLight>& pointLights)
+void Renderer::CullBatches(const Camera& camera, const std::vector<RenderBatch>& batches)
 {
     using namespace DirectX;
-    std::vector<const RenderInstance*> visibleInstances;
-    visibleInstances.reserve(instances.size());
+    m_visibleBatches.clear();
+    m_visibleInstances.clear();
 
     BoundingFrustum frustum;
     BoundingFrustum::CreateFromMatrix(frustum, m_projectionMatrix);
@@ -71,38 +50,47 @@ void Renderer::RenderFrame(
     XMMATRIX invView = XMMatrixInverse(nullptr, viewMatrix);
     frustumWorld.Transform(frustumWorld, invView);
 
-    for (const auto* instance : instances)
+    // Batches arrive grouped by mesh and material, so no sorting is needed;
+    // batches with nothing visible are dropped
+    for (const auto& batch : batches)
     {
-        if (!instance)
+        if (!batch.mesh)
         {
             continue;
         }
 
-        if (!instance->hasBounds)
+        VisibleBatch visible{ batch.mesh, batch.material, m_visibleInstances.size(), 0 };
+        for (const auto& instance : batch.instances)
         {
-            visibleInstances.push_back(instance);
-            continue;
+            if (instance.hasBounds)
+            {
+                BoundingBox box;
+                box.Center = instance.worldAABB.center;
+                box.Extents = instance.worldAABB.extents;
+                if (!frustumWorld.Intersects(box))
+                {
+                    continue;
+                }
+            }
+            m_visibleInstances.push_back(&instance);
         }
 
-        BoundingBox box;
-        box.Center = instance->worldAABB.center;
-        box.Extents = instance->worldAABB.extents;
-
-        if (frustumWorld.Intersects(box))
+        visible.count = m_visibleInstances.size() - visible.begin;
+        if (visible.count > 0)
         {
-            visibleInstances.push_back(instance);
+            m_visibleBatches.push_back(visible);
         }
     }
+}
+
+void Renderer::RenderFrame(
+    const Camera& camera,
+    const std::vector<RenderBatch>& batches,
+    const DirectionalLight& dirLight,
+    const std::vector<PointLight>& pointLights)
+{
+    CullBatches(camera, batches);
 
-    std::sort(visibleInstances.begin(), visibleInstances.end(),
-        [](const RenderInstance* lhs, const RenderInstance* rhs)
-        {
-            if (lhs->material != rhs->material)
-            {
-                return lhs->material < rhs->material;
-            }
-            return lhs->mesh < rhs->mesh;
-        });
     ID3D11DeviceContext* context = m_graphics->GetContext().Get();
     ID3D11DepthStencilView* dsv = m_graphics->GetDepthStencilView().Get();
     ID3D11RenderTargetView* rtv = m_graphics->GetRenderTargetView().Get();
@@ -115,7 +103,7 @@ void Renderer::RenderFrame(
     // 1. Render shadows first, as it uses its own render targets
     DirectX::XMMATRIX lightView = DirectX::XMMatrixIdentity();
     DirectX::XMMATRIX lightProj = DirectX::XMMatrixIdentity();
-    RenderShadowPass(visibleInstances, lightView, lightProj);
+    RenderShadowPass(lightView, lightProj);
 
     // 2. Unbind shader resources again before setting main render targets
     context->PSSetShaderResources(0, 3, nullSRVs);
@@ -124,7 +112,7 @@ void Renderer::RenderFrame(
     m_postProcess->Bind(context, dsv);  // This sets the post-process offscreen texture as render target
     
     // 4. Render scene to offscreen texture
-    RenderMainPass(camera, visibleInstances, lightView * lightProj, dirLight, pointLights);
+    RenderMainPass(camera, lightView * lightProj, dirLight, pointLights);
 
     // 5. Unbind shader resources before post-processing
     context->PSSetShaderResources(0, 3, nullSRVs);
@@ -280,7 +268,7 @@ void Renderer::InitPipeline(int width, int height)
     ThrowIfFailed(device->CreateDepthStencilState(&dssDesc, &m_depthDisabledDSS));
 }
 
-void Renderer::RenderShadowPass(const std::vector<const RenderInstance*>& instances, DirectX::XMMATRIX& outLightView, DirectX::XMMATRIX& outLightProj)
+void Renderer::RenderShadowPass(DirectX::XMMATRIX& outLightView, DirectX::XMMATRIX& outLightProj)
 {
     ID3D11DeviceContext* context = m_graphics->GetContext().Get();
 
@@ -305,23 +293,26 @@ void Renderer::RenderShadowPass(const std::vector<const RenderInstance*>& instan
     context->PSSetShader(nullptr, nullptr, 0);
     context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-    for (const auto* instance : instances)
-    {
-        if (!instance || !instance->mesh) continue;
-        DirectX::XMMATRIX worldMatrix = BuildWorldMatrix(*instance);
-        DirectX::XMMATRIX wvp = worldMatrix * outLightView * outLightProj;
+    context->VSSetConstantBuffers(0, 1, m_cbShadowMatrix.GetAddressOf());
 
-        DirectX::XMMATRIX wvpT = DirectX::XMMatrixTranspose(wvp);
-        context->UpdateSubresource(m_cbShadowMatrix.Get(), 0, nullptr, &wvpT, 0, 0);
-        context->VSSetConstantBuffers(0, 1, m_cbShadowMatrix.GetAddressOf());
+    // Depth only: the material is not needed, the mesh is bound once per batch
+    for (const auto& batch : m_visibleBatches)
+    {
+        batch.mesh->Bind(context);
+        for (size_t i = batch.begin; i < batch.begin + batch.count; ++i)
+        {
+            DirectX::XMMATRIX worldMatrix = BuildWorldMatrix(*m_visibleInstances[i]);
+            DirectX::XMMATRIX wvp = worldMatrix * outLightView * outLightProj;
 
-        DrawInstance(context, *instance, m_psMaterialConstantBuffer.Get());
+            DirectX::XMMATRIX wvpT = DirectX::XMMatrixTranspose(wvp);
+            context->UpdateSubresource(m_cbShadowMatrix.Get(), 0, nullptr, &wvpT, 0, 0);
+            batch.mesh->DrawBound(context);
+        }
     }
 }
 
 void Renderer::RenderMainPass(
     const Camera& camera,
-    const std::vector<const RenderInstance*>& instances,
     const DirectX::XMMATRIX& lightViewProj,
     const DirectionalLight& dirLight,
     const std::vector<PointLight>& pointLights
@@ -369,21 +360,30 @@ void Renderer::RenderMainPass(
     m_mainPS->Bind(context);
     context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-    for (const auto* instance : instances)
-    {
-        if (!instance || !instance->mesh) continue;
-        DirectX::XMMATRIX worldMatrix = BuildWorldMatrix(*instance);
+    context->VSSetConstantBuffers(0, 1, m_vsConstantBuffer.GetAddressOf());
 
-        CB_VS_vertexshader vs_cb;
-        DirectX::XMStoreFloat4x4(&vs_cb.worldMatrix, DirectX::XMMatrixTranspose(worldMatrix));
-        DirectX::XMStoreFloat4x4(&vs_cb.viewMatrix, DirectX::XMMatrixTranspose(viewMatrix));
-        DirectX::XMStoreFloat4x4(&vs_cb.projectionMatrix, DirectX::XMMatrixTranspose(m_projectionMatrix));
-        DirectX::XMStoreFloat4x4(&vs_cb.lightViewProjMatrix, DirectX::XMMatrixTranspose(lightViewProj));
-        context->UpdateSubresource(m_vsConstantBuffer.Get(), 0, nullptr, &vs_cb, 0, 0);
+    // View, projection and light matrices are the same for every instance
+    CB_VS_vertexshader vs_cb;
+    DirectX::XMStoreFloat4x4(&vs_cb.viewMatrix, DirectX::XMMatrixTranspose(viewMatrix));
+    DirectX::XMStoreFloat4x4(&vs_cb.projectionMatrix, DirectX::XMMatrixTranspose(m_projectionMatrix));
+    DirectX::XMStoreFloat4x4(&vs_cb.lightViewProjMatrix, DirectX::XMMatrixTranspose(lightViewProj));
 
-        context->VSSetConstantBuffers(0, 1, m_vsConstantBuffer.GetAddressOf());
+    // Material and mesh state is bound once per batch; instances only update the world matrix
+    for (const auto& batch : m_visibleBatches)
+    {
+        if (batch.material)
+        {
+            batch.material->Bind(context, m_psMaterialConstantBuffer.Get());
+        }
+        batch.mesh->Bind(context);
 
-        DrawInstance(context, *instance, m_psMaterialConstantBuffer.Get());
+        for (size_t i = batch.begin; i < batch.begin + batch.count; ++i)
+        {
+            DirectX::XMMATRIX worldMatrix = BuildWorldMatrix(*m_visibleInstances[i]);
+            DirectX::XMStoreFloat4x4(&vs_cb.worldMatrix, DirectX::XMMatrixTranspose(worldMatrix));
+            context->UpdateSubresource(m_vsConstantBuffer.Get(), 0, nullptr, &vs_cb, 0, 0);
+            batch.mesh->DrawBound(context);
+        }
     }
 
     if (m_skybox)
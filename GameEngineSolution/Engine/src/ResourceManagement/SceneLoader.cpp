@@ -8,6 +8,7 @@
 
 #include "../../include/Renderer/MeshUtils.h"
 #include "../../include/ECS/EntityBuilder.h"
+#include "../../include/Jobs/ParallelFor.h"
 
 // Helper to calculate AABB from mesh (same as in Scene.cpp)
 static ECS::ColliderComponent CalculateCollider(const Mesh* mesh) {
@@ -53,97 +54,80 @@ void SceneLoader::LoadScene(
         throw std::runtime_error("'entities' must be an array");
     }
     
-    // Create each entity
-    for (size_t i = 0; i < entitiesArray.ArraySize(); ++i) {
-        const JsonValue& entityDef = entitiesArray[i];
-        
-        if (!entityDef.IsObject()) {
-            throw std::runtime_error(std::format("Entity {} must be an object", i));
-        }
-        
-        // Create entity builder
-        ECS::EntityBuilder builder(componentManager);
-        
-        // Check for components object
-        if (!entityDef.HasField("components")) {
-            builder.Build(); // Just create empty entity
-            continue; 
-        }
-        
-        const JsonValue& components = entityDef.GetField("components");
-        if (!components.IsObject()) {
-            throw std::runtime_error("'components' must be an object");
-        }
-        
-        // Track mesh for collider auto-generation
-        Mesh* entityMesh = nullptr;
-        
-        // Parse Transform
-        if (components.HasField("transform")) {
-            builder.With(ParseTransform(components.GetField("transform")));
-        }
-        
-        // Parse Render (must come before collider for auto-generation)
-        if (components.HasField("render")) {
-            ECS::RenderComponent render = ParseRender(components.GetField("render"), meshLookup, materialLookup);
-            builder.With(render);
-            entityMesh = render.mesh;
-        }
-        
-        // Parse Physics
-        if (components.HasField("physics")) {
-            builder.With(ParsePhysics(components.GetField("physics")));
-        }
-        
-        // Parse Collider
-        if (components.HasField("collider")) {
-            builder.With(ParseCollider(components.GetField("collider"), entityMesh));
-        }
-        
-        // Parse Light
-        if (components.HasField("light")) {
-            builder.With(ParseLight(components.GetField("light")));
-        }
-        
-        // Parse Rotate
-        if (components.HasField("rotate")) {
-            builder.With(ParseRotate(components.GetField("rotate")));
-        }
-        
-        // Parse Orbit
-        if (components.HasField("orbit")) {
-            builder.With(ParseOrbit(components.GetField("orbit")));
-        }
-        
-        // Parse PlayerController
-        if (components.HasField("playerController")) {
-            builder.With(ParsePlayerController(components.GetField("playerController")));
-            // Auto-add InputComponent for player
-            builder.With(ECS::InputComponent{});
-        }
-
-        // Parse Camera
-        if (components.HasField("camera")) {
-            builder.With(ParseCamera(components.GetField("camera")));
-        }
-
-        // Parse Health
-        if (components.HasField("health")) {
-            builder.With(ParseHealth(components.GetField("health")));
+    // Parse entity definitions in parallel (JSON tree and lookups are read-only here)
+    std::vector<std::optional<ParsedEntity>> parsedEntities(entitiesArray.ArraySize());
+    
+    Jobs::ParallelFor(parsedEntities.size(), PARSE_GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const JsonValue& entityDef = entitiesArray[i];
+            
+            if (!entityDef.IsObject()) {
+                throw std::runtime_error(std::format("Entity {} must be an object", i));
+            }
+            
+            // Entities without components stay empty
+            if (!entityDef.HasField("components")) {
+                continue;
+            }
+            
+            const JsonValue& components = entityDef.GetField("components");
+            if (!components.IsObject()) {
+                throw std::runtime_error("'components' must be an object");
+            }
+            
+            parsedEntities[i] = ParseComponents(components, meshLookup, materialLookup);
         }
-
-        // Parse Weapon
-        if (components.HasField("weapon")) {
-            builder.With(ParseWeapon(components.GetField("weapon")));
+    });
+    
+    // Create entities in file order on this thread, then add each component type in bulk.
+    // Add/remove notifications are coalesced until the batch closes.
+    ECS::ComponentManager::BatchScope batch(componentManager);
+    std::vector<ECS::Entity> entities = componentManager.CreateEntities(parsedEntities.size());
+    
+    AddComponentColumn(componentManager, entities, parsedEntities, &ParsedEntity::transform);
+    AddComponentColumn(componentManager, entities, parsedEntities, &ParsedEntity::render);
+    AddComponentColumn(componentManager, entities, parsedEntities, &ParsedEntity::physics);
+    AddComponentColumn(componentManager, entities, parsedEntities, &ParsedEntity::collider);
+    AddComponentColumn(componentManager, entities, parsedEntities, &ParsedEntity::light);
+    AddComponentColumn(componentManager, entities, parsedEntities, &ParsedEntity::rotate);
+    AddComponentColumn(componentManager, entities, parsedEntities, &ParsedEntity::orbit);
+    AddComponentColumn(componentManager, entities, parsedEntities, &ParsedEntity::playerController);
+    AddComponentColumn(componentManager, entities, parsedEntities, &ParsedEntity::camera);
+    AddComponentColumn(componentManager, entities, parsedEntities, &ParsedEntity::health);
+    AddComponentColumn(componentManager, entities, parsedEntities, &ParsedEntity::weapon);
+    AddComponentColumn(componentManager, entities, parsedEntities, &ParsedEntity::projectile);
+    
+    // Auto-add InputComponent for players
+    std::vector<ECS::Entity> players;
+    for (size_t i = 0; i < parsedEntities.size(); ++i) {
+        if (parsedEntities[i] && parsedEntities[i]->playerController) {
+            players.push_back(entities[i]);
         }
+    }
+    std::vector<ECS::InputComponent> inputs(players.size());
+    componentManager.AddComponents<ECS::InputComponent>(players, inputs);
+}
 
-        // Parse Projectile
-        if (components.HasField("projectile")) {
-            builder.With(ParseProjectile(components.GetField("projectile")));
+template<typename T>
+void SceneLoader::AddComponentColumn(
+    ECS::ComponentManager& componentManager,
+    const std::vector<ECS::Entity>& entities,
+    const std::vector<std::optional<ParsedEntity>>& parsedEntities,
+    std::optional<T> ParsedEntity::* member
+) {
+    std::vector<ECS::Entity> targets;
+    std::vector<T> components;
+    
+    for (size_t i = 0; i < parsedEntities.size(); ++i) {
+        const auto& parsed = parsedEntities[i];
+        if (parsed && (*parsed).*member) {
+            targets.push_back(entities[i]);
+            components.push_back(*((*parsed).*member));
         }
-        
-        // Finalize entity
-        builder.Build();
+    }
+    
+    if (!targets.empty()) {
+        componentManager.AddComponents<T>(targets, components);
     }
 }
 
@@ -174,76 +158,111 @@ ECS::Entity SceneLoader::LoadPrefab(
     }
     const JsonValue& components = *componentsPtr;
 
-    ECS::EntityBuilder builder(componentManager);
-    Mesh* entityMesh = nullptr;
+    ParsedEntity parsed = ParseComponents(components, meshLookup, materialLookup);
 
     // Always use the passed transform arguments
     ECS::TransformComponent transform;
     transform.position = position;
     transform.rotation = rotation;
     transform.scale = scale;
-    builder.With(transform);
+    parsed.transform = transform;
+
+    ECS::EntityBuilder builder(componentManager);
+    AddComponents(builder, parsed);
+    return builder.Build();
+}
 
+SceneLoader::ParsedEntity SceneLoader::ParseComponents(
+    const JsonValue& components,
+    const std::unordered_map<std::string, Mesh*>& meshLookup,
+    const std::unordered_map<std::string, std::shared_ptr<Material>>& materialLookup
+) {
+    ParsedEntity parsed;
+    
+    // Track mesh for collider auto-generation
+    Mesh* entityMesh = nullptr;
+    
+    // Parse Transform
+    if (components.HasField("transform")) {
+        parsed.transform = ParseTransform(components.GetField("transform"));
+    }
+    
     // Parse Render (must come before collider for auto-generation)
     if (components.HasField("render")) {
-        ECS::RenderComponent render = ParseRender(components.GetField("render"), meshLookup, materialLookup);
-        builder.With(render);
-        entityMesh = render.mesh;
+        parsed.render = ParseRender(components.GetField("render"), meshLookup, materialLookup);
+        entityMesh = parsed.render->mesh;
     }
     
     // Parse Physics
     if (components.HasField("physics")) {
-        builder.With(ParsePhysics(components.GetField("physics")));
+        parsed.physics = ParsePhysics(components.GetField("physics"));
     }
     
     // Parse Collider
     if (components.HasField("collider")) {
-        builder.With(ParseCollider(components.GetField("collider"), entityMesh));
+        parsed.collider = ParseCollider(components.GetField("collider"), entityMesh);
     }
     
     // Parse Light
     if (components.HasField("light")) {
-        builder.With(ParseLight(components.GetField("light")));
+        parsed.light = ParseLight(components.GetField("light"));
     }
     
     // Parse Rotate
     if (components.HasField("rotate")) {
-        builder.With(ParseRotate(components.GetField("rotate")));
+        parsed.rotate = ParseRotate(components.GetField("rotate"));
     }
     
     // Parse Orbit
     if (components.HasField("orbit")) {
-        builder.With(ParseOrbit(components.GetField("orbit")));
+        parsed.orbit = ParseOrbit(components.GetField("orbit"));
     }
     
     // Parse PlayerController
     if (components.HasField("playerController")) {
-        builder.With(ParsePlayerController(components.GetField("playerController")));
-        // Auto-add InputComponent for player
-        builder.With(ECS::InputComponent{});
+        parsed.playerController = ParsePlayerController(components.GetField("playerController"));
     }
 
     // Parse Camera
     if (components.HasField("camera")) {
-        builder.With(ParseCamera(components.GetField("camera")));
+        parsed.camera = ParseCamera(components.GetField("camera"));
     }
 
     // Parse Health
     if (components.HasField("health")) {
-        builder.With(ParseHealth(components.GetField("health")));
+        parsed.health = ParseHealth(components.GetField("health"));
     }
 
     // Parse Weapon
     if (components.HasField("weapon")) {
-        builder.With(ParseWeapon(components.GetField("weapon")));
+        parsed.weapon = ParseWeapon(components.GetField("weapon"));
     }
 
     // Parse Projectile
     if (components.HasField("projectile")) {
-        builder.With(ParseProjectile(components.GetField("projectile")));
+        parsed.projectile = ParseProjectile(components.GetField("projectile"));
     }
     
-    return builder.Build();
+    return parsed;
+}
+
+void SceneLoader::AddComponents(ECS::EntityBuilder& builder, const ParsedEntity& parsed) {
+    if (parsed.transform) builder.With(*parsed.transform);
+    if (parsed.render) builder.With(*parsed.render);
+    if (parsed.physics) builder.With(*parsed.physics);
+    if (parsed.collider) builder.With(*parsed.collider);
+    if (parsed.light) builder.With(*parsed.light);
+    if (parsed.rotate) builder.With(*parsed.rotate);
+    if (parsed.orbit) builder.With(*parsed.orbit);
+    if (parsed.playerController) {
+        builder.With(*parsed.playerController);
+        // Auto-add InputComponent for player
+        builder.With(ECS::InputComponent{});
+    }
+    if (parsed.camera) builder.With(*parsed.camera);
+    if (parsed.health) builder.With(*parsed.health);
+    if (parsed.weapon) builder.With(*parsed.weapon);
+    if (parsed.projectile) builder.With(*parsed.projectile);
 }
 
 void SceneLoader::ParseResources(
@@ -1,5 +1,6 @@
 #include "../../include/UI/DebugUIRenderer.h"
 #include "../../include/UI/UIRenderer.h"
+#include "../../include/ECS/SystemManager.h"
 #include <cmath>
 #include <string>
 
@@ -16,7 +17,9 @@ void DebugUIRenderer::Render(
     bool bloomEnabled,
     bool debugCollisionEnabled,
     ECS::ComponentManager& componentManager,
-    ECS::Entity activeCamera
+    ECS::Entity activeCamera,
+    const ECS::RewindBuffer* rewindBuffer,
+    const ECS::SystemManager* systemManager
 )
 {
     if (!m_enabled || !uiRenderer) return;
@@ -57,6 +60,42 @@ void DebugUIRenderer::Render(
     uiRenderer->DrawString(font, entityInfo, 10.0f, yPos, 20.0f, white);
     yPos += lineHeight;
 
+    // Rewind history: stored ticks, memory and the cost of the last capture
+    if (rewindBuffer) {
+        char historyBuffer[128];
+        snprintf(historyBuffer, sizeof(historyBuffer), "[Backspace] Rewind: %zu / %zu ticks, %zu KB",
+            rewindBuffer->GetStoredTickCount(), rewindBuffer->GetCapacity(), rewindBuffer->GetMemoryUsage() / 1024);
+        uiRenderer->DrawString(font, historyBuffer, 10.0f, yPos, 20.0f, white);
+        yPos += lineHeight;
+
+        char captureBuffer[128];
+        snprintf(captureBuffer, sizeof(captureBuffer), "Capture: %.3f ms, %zu B (raw %zu KB)",
+            rewindBuffer->GetLastCaptureTimeMs(), rewindBuffer->GetLastEncodedSize(), rewindBuffer->GetLastRawSize() / 1024);
+        uiRenderer->DrawString(font, captureBuffer, 10.0f, yPos, 20.0f, white);
+        yPos += lineHeight;
+    }
+
+    // Time-sliced systems: share of their entities processed per update (one fixed
+    // simulation tick), how many ticks a full pass takes and how stale the processed
+    // entities were
+    if (systemManager) {
+        systemManager->ForEachTimeSlicedSystem([&](const ECS::System& system) {
+            const ECS::TimeSliceStats& stats = system.GetTimeSliceStats();
+
+            char sliceBuffer[160];
+            snprintf(sliceBuffer, sizeof(sliceBuffer), "%s: %zu / %zu per tick (%.0f%%), sweep %u ticks",
+                system.GetName(), stats.processedCount, stats.entityCount, stats.GetCoverage() * 100.0f, stats.sweepFrames);
+            uiRenderer->DrawString(font, sliceBuffer, 10.0f, yPos, 20.0f, white);
+            yPos += lineHeight;
+
+            char latencyBuffer[128];
+            snprintf(latencyBuffer, sizeof(latencyBuffer), "  Latency: avg %.0f ms, max %.0f ms",
+                stats.averageLatency * 1000.0f, stats.maxLatency * 1000.0f);
+            uiRenderer->DrawString(font, latencyBuffer, 10.0f, yPos, 20.0f, white);
+            yPos += lineHeight;
+        });
+    }
+
     // Show player information if exists
     auto playerArray = componentManager.GetComponentArray<ECS::PlayerControllerComponent>();
     if (playerArray && playerArray->GetSize() > 0) {
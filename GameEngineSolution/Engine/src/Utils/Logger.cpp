@@ -1,5 +1,8 @@
 #include <iostream>
+#include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <exception>
 #include <iomanip>
 #include <sstream>
 #include <filesystem>
@@ -8,6 +11,33 @@
 #include "../../include/Utils/EnginePCH.h"
 #include "../../include/Utils/Logger.h"
 
+namespace
+{
+    // Idle period of the writer thread between drains
+    constexpr auto WRITER_INTERVAL = std::chrono::milliseconds(5);
+
+    // How long a crash handler waits for a drain in progress to finish
+    constexpr auto CRASH_FLUSH_TIMEOUT = std::chrono::milliseconds(200);
+
+    std::terminate_handler g_previousTerminate = nullptr;
+    LPTOP_LEVEL_EXCEPTION_FILTER g_previousExceptionFilter = nullptr;
+
+    // Clears the thread's ring for reuse when the thread exits
+    struct ThreadBufferHandle
+    {
+        std::atomic<bool>* released = nullptr;
+        void* buffer = nullptr;
+
+        ~ThreadBufferHandle()
+        {
+            if (released)
+                released->store(true, std::memory_order_release);
+        }
+    };
+
+    thread_local ThreadBufferHandle t_buffer;
+}
+
 Logger& Logger::Get()
 {
     static Logger instance;
@@ -29,27 +59,41 @@ Logger::Logger()
     // Create log file with timestamp
     auto now = std::chrono::system_clock::now();
     auto time_t_now = std::chrono::system_clock::to_time_t(now);
-    
+
     std::tm tm_now;
     localtime_s(&tm_now, &time_t_now);
-    
+
     std::ostringstream filename;
     filename << "logs/engine_"
              << std::put_time(&tm_now, "%Y%m%d_%H%M%S")
              << ".log";
 
     m_logFile.open(filename.str(), std::ios::out);
-    
+
     if (m_logFile.is_open())
     {
         m_logFile << "=== Graphics Engine Log ===" << std::endl;
         m_logFile << "Session started: " << std::put_time(&tm_now, "%Y-%m-%d %H:%M:%S") << std::endl;
         m_logFile << "============================" << std::endl << std::endl;
     }
+
+    m_writer = std::thread(&Logger::WriterLoop, this);
+    InstallCrashHandlers();
 }
 
 Logger::~Logger()
 {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stopping = true;
+    }
+    m_wake.notify_one();
+    if (m_writer.joinable())
+        m_writer.join();
+
+    // Messages logged after the writer's last drain
+    Flush();
+
     if (m_logFile.is_open())
     {
         m_logFile << std::endl << "=== Session ended ===" << std::endl;
@@ -57,74 +101,235 @@ Logger::~Logger()
     }
 }
 
-void Logger::Debug(const std::string& message)
+void Logger::Debug(std::string_view message)
 {
     Log(Level::Debug, message);
 }
 
-void Logger::Info(const std::string& message)
+void Logger::Info(std::string_view message)
 {
     Log(Level::Info, message);
 }
 
-void Logger::Warning(const std::string& message)
+void Logger::Warning(std::string_view message)
 {
     Log(Level::Warning, message);
 }
 
-void Logger::Error(const std::string& message, const char* file, int line)
+void Logger::Error(std::string_view message, const char* file, int line)
 {
     Log(Level::Error, message, file, line);
 }
 
-void Logger::Fatal(const std::string& message, const char* file, int line)
+void Logger::Fatal(std::string_view message, const char* file, int line)
 {
     Log(Level::Fatal, message, file, line);
+    Flush();
+}
+
+void Logger::Flush()
+{
+    std::lock_guard<std::timed_mutex> lock(m_drainMutex);
+    Drain();
 }
 
 void Logger::SetMinLevel(Level level)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_minLevel = level;
+    m_minLevel.store(level, std::memory_order_relaxed);
 }
 
 void Logger::EnableFileLogging(bool enabled)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_fileLoggingEnabled = enabled;
+    m_fileLoggingEnabled.store(enabled, std::memory_order_relaxed);
 }
 
 void Logger::EnableConsoleOutput(bool enabled)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_consoleEnabled = enabled;
+    m_consoleEnabled.store(enabled, std::memory_order_relaxed);
 }
 
-void Logger::Log(Level level, const std::string& message, const char* file, int line)
+// ==================================================================================
+// Calling thread
+// ==================================================================================
+
+void Logger::Log(Level level, std::string_view message, const char* file, int line)
 {
     // Filter by minimum level
-    if (level < m_minLevel)
+    if (level < m_minLevel.load(std::memory_order_relaxed))
+        return;
+
+    ThreadBuffer& buffer = GetThreadBuffer();
+    const int64_t timestamp = std::chrono::system_clock::now().time_since_epoch().count();
+
+    // Longer messages are truncated to a quarter of the ring
+    constexpr size_t textCapacity = sizeof(Record::text);
+    message = message.substr(0, RING_CAPACITY / 4 * textCapacity);
+    const size_t count = std::max<size_t>(1, (message.size() + textCapacity - 1) / textCapacity);
+
+    // Single producer: only this thread moves head; the writer only moves tail forward
+    const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+    if (head + count - buffer.tail.load(std::memory_order_acquire) > RING_CAPACITY)
+    {
+        buffer.dropped.store(buffer.dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
         return;
+    }
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    for (size_t i = 0; i < count; ++i)
+    {
+        Record& record = buffer.records[(head + i) & (RING_CAPACITY - 1)];
+        const std::string_view part = message.substr(i * textCapacity, textCapacity);
+        record.timestamp = timestamp;
+        record.file = file;
+        record.line = static_cast<uint32_t>(line);
+        record.level = level;
+        record.continued = i + 1 < count;
+        record.length = static_cast<uint16_t>(part.size());
+        std::memcpy(record.text, part.data(), part.size());
+    }
+
+    // Publishes the whole message at once
+    buffer.head.store(head + count, std::memory_order_release);
+}
+
+Logger::ThreadBuffer& Logger::GetThreadBuffer()
+{
+    if (t_buffer.buffer)
+        return *static_cast<ThreadBuffer*>(t_buffer.buffer);
+
+    // First message from this thread: reuse the empty ring of an exited thread, or add one
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    ThreadBuffer* buffer = nullptr;
+    for (auto& candidate : m_buffers)
+    {
+        if (candidate->released.load(std::memory_order_acquire) &&
+            candidate->head.load(std::memory_order_relaxed) == candidate->tail.load(std::memory_order_acquire))
+        {
+            buffer = candidate.get();
+            buffer->released.store(false, std::memory_order_relaxed);
+            break;
+        }
+    }
+    if (!buffer)
+    {
+        m_buffers.push_back(std::make_unique<ThreadBuffer>());
+        buffer = m_buffers.back().get();
+    }
+
+    t_buffer.buffer = buffer;
+    t_buffer.released = &buffer->released;
+    return *buffer;
+}
+
+// ==================================================================================
+// Writer thread
+// ==================================================================================
+
+void Logger::WriterLoop()
+{
+    std::unique_lock<std::mutex> wakeLock(m_wakeMutex);
+    while (!m_stopping)
+    {
+        m_wake.wait_for(wakeLock, WRITER_INTERVAL);
+        wakeLock.unlock();
+        {
+            std::lock_guard<std::timed_mutex> lock(m_drainMutex);
+            Drain();
+        }
+        wakeLock.lock();
+    }
+}
+
+// Caller holds m_drainMutex
+void Logger::Drain()
+{
+    struct Message
+    {
+        Record first;
+        std::string text;
+    };
+
+    std::vector<ThreadBuffer*> buffers;
+    {
+        std::lock_guard<std::mutex> lock(m_buffersMutex);
+        buffers.reserve(m_buffers.size());
+        for (auto& buffer : m_buffers)
+            buffers.push_back(buffer.get());
+    }
+
+    // Collect complete messages from every ring
+    std::vector<Message> messages;
+    uint64_t dropped = 0;
+    for (ThreadBuffer* buffer : buffers)
+    {
+        const uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+        while (tail < head)
+        {
+            const Record& first = buffer->records[tail & (RING_CAPACITY - 1)];
+            Message message{ first, {} };
+            for (;;)
+            {
+                const Record& part = buffer->records[tail++ & (RING_CAPACITY - 1)];
+                message.text.append(part.text, part.length);
+                if (!part.continued)
+                    break;
+            }
+            messages.push_back(std::move(message));
+        }
+        buffer->tail.store(tail, std::memory_order_release);
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+
+    // Rings are per thread: merge them back into time order
+    std::stable_sort(messages.begin(), messages.end(), [](const Message& a, const Message& b) {
+        return a.first.timestamp < b.first.timestamp;
+    });
+
+    for (const Message& message : messages)
+        Write(message.first, message.text);
+
+    if (dropped > m_reportedDropped)
+    {
+        Record warning{};
+        warning.timestamp = std::chrono::system_clock::now().time_since_epoch().count();
+        warning.level = Level::Warning;
+        Write(warning, "Logger: " + std::to_string(dropped - m_reportedDropped) + " message(s) dropped (ring buffer full)");
+        m_reportedDropped = dropped;
+    }
+
+    if (!messages.empty() && m_logFile.is_open())
+        m_logFile.flush();
+}
+
+// Best effort from a crash handler: if another thread is mid-drain, wake the writer
+// and wait (bounded) for the drain to finish, then drain what is left. Gives up after
+// the timeout, e.g. when the crashing thread is the one draining.
+void Logger::FlushForCrash()
+{
+    m_wake.notify_one();
+    std::unique_lock<std::timed_mutex> lock(m_drainMutex, CRASH_FLUSH_TIMEOUT);
+    if (lock.owns_lock())
+        Drain();
+}
+
+void Logger::Write(const Record& first, const std::string& message)
+{
+    std::string levelStr = LevelToString(first.level);
 
-    std::string timestamp = GetTimestamp();
-    std::string levelStr = LevelToString(level);
-    
     // Build the formatted message
     std::ostringstream formatted;
-    formatted << "[" << timestamp << "] [" << levelStr << "] " << message;
-    
+    formatted << "[" << FormatTimestamp(first.timestamp) << "] [" << levelStr << "] " << message;
+
     // Add file and line info for errors and fatal errors
-    if ((level == Level::Error || level == Level::Fatal) && file != nullptr)
+    if ((first.level == Level::Error || first.level == Level::Fatal) && first.file != nullptr)
     {
         // Extract just the filename from the full path
-        std::string filename = file;
+        std::string filename = first.file;
         size_t lastSlash = filename.find_last_of("\\/");
         if (lastSlash != std::string::npos)
             filename = filename.substr(lastSlash + 1);
-        
-        formatted << " [" << filename << ":" << line << "]";
+
+        formatted << " [" << filename << ":" << first.line << "]";
     }
 
     std::string finalMessage = formatted.str();
@@ -133,27 +338,26 @@ void Logger::Log(Level level, const std::string& message, const char* file, int
     OutputDebugStringA((finalMessage + "\n").c_str());
 
     // Output to console with color
-    if (m_consoleEnabled)
+    if (m_consoleEnabled.load(std::memory_order_relaxed))
     {
-        SetConsoleColor(level);
-        std::cout << finalMessage << std::endl;
+        SetConsoleColor(first.level);
+        std::cout << finalMessage << '\n';
         ResetConsoleColor();
     }
 
-    // Output to file
-    if (m_fileLoggingEnabled && m_logFile.is_open())
+    // Output to file (flushed once per drain)
+    if (m_fileLoggingEnabled.load(std::memory_order_relaxed) && m_logFile.is_open())
     {
-        m_logFile << finalMessage << std::endl;
-        m_logFile.flush(); // Ensure it's written immediately
+        m_logFile << finalMessage << '\n';
     }
 }
 
-std::string Logger::GetTimestamp() const
+std::string Logger::FormatTimestamp(int64_t timestamp) const
 {
-    auto now = std::chrono::system_clock::now();
-    auto time_t_now = std::chrono::system_clock::to_time_t(now);
+    const std::chrono::system_clock::time_point time{ std::chrono::system_clock::duration(timestamp) };
+    auto time_t_now = std::chrono::system_clock::to_time_t(time);
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()) % 1000;
+        time.time_since_epoch()) % 1000;
 
     std::tm tm_now;
     localtime_s(&tm_now, &time_t_now);
@@ -183,7 +387,7 @@ void Logger::SetConsoleColor(Level level)
         return;
 
     HANDLE handle = static_cast<HANDLE>(m_consoleHandle);
-    
+
     switch (level)
     {
     case Level::Debug:
@@ -212,3 +416,27 @@ void Logger::ResetConsoleColor()
     HANDLE handle = static_cast<HANDLE>(m_consoleHandle);
     SetConsoleTextAttribute(handle, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE); // White
 }
+
+// ==================================================================================
+// Crash handlers
+// ----------------------------------------------------------------------------------
+// Write out pending messages before the process dies, then defer to the previous
+// handler.
+// ==================================================================================
+
+void Logger::InstallCrashHandlers()
+{
+    g_previousTerminate = std::set_terminate([]() {
+        Logger::Get().FlushForCrash();
+        if (g_previousTerminate)
+            g_previousTerminate();
+        std::abort();
+    });
+
+    g_previousExceptionFilter = SetUnhandledExceptionFilter([](EXCEPTION_POINTERS* exception) -> LONG {
+        Logger::Get().FlushForCrash();
+        if (g_previousExceptionFilter)
+            return g_previousExceptionFilter(exception);
+        return EXCEPTION_CONTINUE_SEARCH;
+    });
+}
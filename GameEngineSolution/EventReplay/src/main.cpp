@@ -0,0 +1,188 @@
+#include "ECS/Entity.h"
+#include "Events/EventBus.h"
+#include "Events/EventTrace.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ==================================================================================
+// EventReplay
+// ----------------------------------------------------------------------------------
+// Replays an event trace (EventBus::SaveRecording) into a fresh EventBus and
+// reports per-type dispatch cost next to what the recording measured. Each event
+// type gets as many subscribers as the recording saw; with --reproduce-handlers
+// they busy-wait for the recorded handling time, otherwise they do no work and
+// the replay measures the bus itself.
+//
+// Usage: EventReplay <trace> [--iterations N] [--reproduce-handlers]
+// ==================================================================================
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string tracePath;
+    int iterations = 10;
+    bool reproduceHandlers = false;
+};
+
+// A recorded Publish rebuilt for replay
+struct ReplayEvent {
+    const EventTraceRecord* record;
+    std::unique_ptr<Event> event;
+    std::vector<ECS::Entity> entities; // Viewed by batched ECS events
+};
+
+struct TypeReport {
+    uint64_t published = 0;
+    uint64_t queued = 0;
+    uint16_t maxSubscribers = 0;
+    uint64_t recordedTotalNs = 0;
+    uint64_t recordedMaxNs = 0;
+    uint64_t replayedTotalNs = 0;
+    uint64_t replayedMaxNs = 0;
+    uint64_t replayed = 0;
+};
+
+// Record of the event being replayed (read by the subscribers)
+const EventTraceRecord* g_current = nullptr;
+
+bool ParseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc) {
+            options.iterations = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--reproduce-handlers") {
+            options.reproduceHandlers = true;
+        } else if (options.tracePath.empty() && !arg.starts_with("--")) {
+            options.tracePath = arg;
+        } else {
+            return false;
+        }
+    }
+    return !options.tracePath.empty();
+}
+
+void SpinFor(uint64_t nanoseconds) {
+    const Clock::time_point until = Clock::now() + std::chrono::nanoseconds(nanoseconds);
+    while (Clock::now() < until) {
+    }
+}
+
+void PrintReport(const std::array<TypeReport, EventTypeCount>& reports, int iterations) {
+    std::printf("\n%-22s %9s %8s %5s %14s %14s %14s %14s\n",
+        "Event type", "Published", "Queued", "Subs", "Recorded avg", "Recorded max", "Replay avg", "Replay max");
+
+    for (size_t type = 0; type < EventTypeCount; ++type) {
+        const TypeReport& report = reports[type];
+        if (report.published == 0 && report.queued == 0) {
+            continue;
+        }
+
+        const double recordedAvg = report.published ? double(report.recordedTotalNs) / report.published : 0.0;
+        const double replayedAvg = report.replayed ? double(report.replayedTotalNs) / report.replayed : 0.0;
+        std::printf("%-22s %9llu %8llu %5u %11.1f ns %11llu ns %11.1f ns %11llu ns\n",
+            EventBus::GetEventTypeName(static_cast<EventType>(type)).c_str(),
+            static_cast<unsigned long long>(report.published),
+            static_cast<unsigned long long>(report.queued),
+            static_cast<unsigned>(report.maxSubscribers),
+            recordedAvg, static_cast<unsigned long long>(report.recordedMaxNs),
+            replayedAvg, static_cast<unsigned long long>(report.replayedMaxNs));
+    }
+    std::printf("\nReplay: %d iteration(s); averages are per event.\n", iterations);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        std::cerr << "Usage: EventReplay <trace> [--iterations N] [--reproduce-handlers]" << std::endl;
+        return 2;
+    }
+
+    try {
+        uint64_t dropped = 0;
+        const std::vector<EventTraceRecord> records = LoadEventTrace(options.tracePath, &dropped);
+        std::printf("%s: %zu records", options.tracePath.c_str(), records.size());
+        if (dropped > 0) {
+            std::printf(" (%llu older records were overwritten in the ring)", static_cast<unsigned long long>(dropped));
+        }
+        std::printf("\n");
+
+        // Recorded statistics, and the events to replay
+        std::array<TypeReport, EventTypeCount> reports{};
+        std::vector<ReplayEvent> events;
+        uint64_t undecodable = 0;
+        for (const EventTraceRecord& record : records) {
+            TypeReport& report = reports[static_cast<size_t>(record.type)];
+            if (record.flags & EventTraceRecord::Queued) {
+                ++report.queued;
+                continue;
+            }
+
+            ++report.published;
+            report.maxSubscribers = std::max(report.maxSubscribers, record.subscriberCount);
+            report.recordedTotalNs += record.handlingNs;
+            report.recordedMaxNs = std::max<uint64_t>(report.recordedMaxNs, record.handlingNs);
+
+            ReplayEvent replay{ &record, nullptr, {} };
+            replay.event = DecodeTracedEvent(record, replay.entities);
+            if (replay.event) {
+                events.push_back(std::move(replay));
+            } else {
+                ++undecodable;
+            }
+        }
+        if (undecodable > 0) {
+            std::printf("%llu events have no decoder and are not replayed\n", static_cast<unsigned long long>(undecodable));
+        }
+
+        // Fresh bus with the recorded subscriber counts
+        EventBus eventBus;
+        const bool reproduce = options.reproduceHandlers;
+        for (size_t type = 0; type < EventTypeCount; ++type) {
+            const uint16_t subscribers = reports[type].maxSubscribers;
+            for (uint16_t i = 0; i < subscribers; ++i) {
+                // Together the subscribers spin for the event's recorded handling time
+                eventBus.Subscribe(static_cast<EventType>(type), [reproduce, subscribers](Event&) {
+                    if (reproduce && g_current) {
+                        SpinFor(g_current->handlingNs / subscribers);
+                    }
+                });
+            }
+        }
+
+        for (int iteration = 0; iteration < options.iterations; ++iteration) {
+            for (ReplayEvent& replay : events) {
+                TypeReport& report = reports[static_cast<size_t>(replay.record->type)];
+                replay.event->Handled = false;
+                g_current = replay.record;
+
+                const Clock::time_point start = Clock::now();
+                eventBus.Publish(*replay.event);
+                const uint64_t elapsed = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+
+                report.replayedTotalNs += elapsed;
+                report.replayedMaxNs = std::max(report.replayedMaxNs, elapsed);
+                ++report.replayed;
+            }
+        }
+        g_current = nullptr;
+
+        PrintReport(reports, options.iterations);
+    } catch (const std::exception& e) {
+        std::cerr << "EventReplay failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
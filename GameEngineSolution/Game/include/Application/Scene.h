@@ -15,6 +15,9 @@
 #include "Renderer/Renderer.h"
 #include "ECS/ComponentManager.h"
 #include "ECS/SystemManager.h"
+#include "ECS/RewindBuffer.h"
+#include "ECS/FixedTimestep.h"
+#include "ECS/SpatialOrder.h"
 #include "Events/Event.h"
 #include "Events/EventBus.h"
 // Forward declarations for Systems
@@ -25,6 +28,8 @@ namespace ECS {
     class PlayerMovementSystem;
     class CameraSystem;
     class InputSystem;
+    class TransformSystem;
+    class EntityPool;
 }
 class HealthSystem;
 class WeaponSystem;
@@ -46,7 +51,7 @@ struct DirectionalLight;
 // It acts as the central hub for the ECS (Entity Component System) and handles:
 // - Initialization of systems (Physics, Rendering, Gameplay)
 // - Loading and management of game assets (Meshes, Textures)
-// - The main Update loop (propagating time deltas to systems)
+// - The main Update loop (fixed-rate simulation ticks, then one presentation update)
 // - The Render loop (coordinating with the Renderer and UI)
 // ==================================================================================
 class Scene
@@ -62,6 +67,11 @@ public:
     // Scene loading from JSON
     void LoadSceneFromJSON(const std::wstring& jsonPath);
 
+    // Restores the world as it was 'seconds' ago (clamped to the stored history).
+    // Deferred to the next Update: key events arrive from the message pump mid-frame,
+    // and the world is restored between frames.
+    void RequestRewind(float seconds) { m_pendingRewindSeconds = seconds; }
+
     // Debug UI
     void ToggleDebugUI() { m_debugUI.Toggle(); }
     bool IsDebugUIEnabled() const { return m_debugUI.IsEnabled(); }
@@ -71,6 +81,7 @@ private:
     // Render helpers
     bool SetupCamera(Camera& outCamera, DirectX::XMMATRIX& outView, DirectX::XMMATRIX& outProj);
     void RenderUI(Renderer* renderer, UIRenderer* uiRenderer, bool showDebugCollision);
+    void RewindSeconds(float seconds);
 
     // Non-owning pointers
     AssetManager* m_assetManager;
@@ -83,6 +94,7 @@ private:
     ECS::PhysicsSystem* m_ecsPhysicsSystem = nullptr;
     ECS::RenderSystem* m_ecsRenderSystem = nullptr;
     ECS::MovementSystem* m_ecsMovementSystem = nullptr;
+    ECS::TransformSystem* m_transformSystem = nullptr;
     ECS::PlayerMovementSystem* m_ecsPlayerMovementSystem = nullptr;
     ECS::CameraSystem* m_ecsCameraSystem = nullptr;
     HealthSystem* m_healthSystem = nullptr;
@@ -99,6 +111,20 @@ private:
     ECS::ComponentManager m_ecsComponentManager;
     ECS::SystemManager m_systemManager;
 
+    // Parked projectile entities shared by WeaponSystem and ProjectileSystem
+    std::unique_ptr<ECS::EntityPool> m_projectilePool;
+
+    // Simulation tick accumulator (Config::Simulation)
+    ECS::FixedTimestep m_timestep;
+
+    // Keeps transforms/colliders (and the physics group) in spatial order, a slice per frame
+    ECS::SpatialOrder m_spatialOrder;
+
+    // Rewind history (one captured state per simulation tick)
+    ECS::RewindBuffer m_rewindBuffer;
+    uint64_t m_simulationTick = 0;
+    float m_pendingRewindSeconds = 0.0f;
+
     // UI Elements
     std::unique_ptr<Crosshair> m_crosshair;
     SimpleFont m_font;
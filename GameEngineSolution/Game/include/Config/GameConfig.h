@@ -1,4 +1,6 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace Config {
@@ -12,4 +14,35 @@ namespace Config {
         const std::wstring FontName = L"Minecraft";
         const float FontSize = 24.0f;
     }
+
+    namespace Projectiles {
+        const size_t PoolSize = 64;          // Parked projectile entities (see ECS::EntityPool)
+    }
+
+    namespace Simulation {
+        const bool FixedStep = true;         // false: one variable-length tick per frame
+        const float TickRate = 60.0f;        // Simulation ticks per second (see ECS::FixedTimestep)
+        const uint32_t MaxStepsPerFrame = 5; // Longer frames drop time instead of catching up
+    }
+
+    namespace SpatialOrder {
+        const bool Enabled = true;           // Keep component arrays in Morton order (see ECS::SpatialOrder)
+        const size_t EntriesPerFrame = 4096;
+    }
+
+    namespace EventTrace {
+        const bool Enabled = false;          // Record bus events from startup; F8 toggles, F9 saves (see EventRecorder)
+        const size_t Capacity = 1 << 16;     // Records kept
+        const std::string Path = "event_trace.evtr";
+    }
+
+    namespace Health {
+        const uint32_t RegenEntitiesPerTick = 32; // HealthSystem time slice (see ECS::SystemBudget)
+    }
+
+    namespace Rewind {
+        const size_t HistoryTicks = 600;     // 10 seconds at 60 ticks per second
+        const size_t KeyframeInterval = 30;
+        const float Seconds = 5.0f;          // Backspace rewinds this far
+    }
 }
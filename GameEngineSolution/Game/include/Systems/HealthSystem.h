@@ -3,8 +3,16 @@
 #include "ECS/ComponentManager.h"
 #include "ECS/System.h"
 
+// Deaths are checked every simulation tick for damaged entities; regeneration runs in time
+// slices when the system has a budget (see ECS::System::SetBudget)
 class HealthSystem : public ECS::System {
 public:
     explicit HealthSystem(ECS::ComponentManager& cm) : ECS::System(cm) {}
     void Update(float deltaTime) override;
+    const char* GetName() const override { return "HealthSystem"; }
+
+    // Dead entities are destroyed through the command buffer
+    ECS::SystemAccess GetAccess() const override {
+        return ECS::Access<ECS::Write<ECS::HealthComponent>>::Get();
+    }
 };
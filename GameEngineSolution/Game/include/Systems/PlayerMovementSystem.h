@@ -29,7 +29,10 @@ public:
     
     // System phase: PreUpdate (before physics)
     SystemPhase GetPhase() const override { return SystemPhase::PreUpdate; }
-    bool CanParallelize() const override { return false; } // Writes to physics/transform
+    SystemAccess GetAccess() const override {
+        return Access<Read<InputComponent>, Write<PlayerControllerComponent>,
+                      Write<TransformComponent>, Write<PhysicsComponent>>::Get();
+    }
 
 private:
     // Cached component arrays
@@ -3,8 +3,31 @@
 #include "ECS/ComponentManager.h"
 #include "ECS/System.h"
 
+namespace ECS { class EntityPool; }
+
 class ProjectileSystem : public ECS::System {
 public:
     explicit ProjectileSystem(ECS::ComponentManager& cm) : ECS::System(cm) {}
     void Update(float deltaTime) override;
+
+    // Pooled projectiles are returned to the pool instead of destroyed
+    void SetProjectilePool(ECS::EntityPool* pool) {
+        m_projectilePool = pool;
+    }
+
+    // Expired/hit projectiles are destroyed (or released) through the command buffer
+    ECS::SystemAccess GetAccess() const override {
+        return ECS::Access<
+            ECS::Write<ECS::ProjectileComponent>,
+            ECS::Write<ECS::TransformComponent>,
+            ECS::Write<ECS::HealthComponent>,
+            ECS::Read<ECS::ColliderComponent>,
+            ECS::Read<ECS::WorldMatrixComponent>,
+            ECS::Read<ECS::RenderComponent>>::Get();
+    }
+
+private:
+    void RetireProjectile(ECS::Entity entity);
+
+    ECS::EntityPool* m_projectilePool = nullptr;
 };
@@ -4,7 +4,7 @@
 #include "ECS/System.h"
 #include "ECS/System.h"
 
-namespace ECS { class PhysicsSystem; }
+namespace ECS { class PhysicsSystem; class EntityPool; }
 
 class WeaponSystem : public ECS::System {
 public:
@@ -20,15 +20,34 @@ public:
         m_physicsSystem = physicsSystem;
     }
 
+    // Projectiles come from the pool while it has free entities (created otherwise)
+    void SetProjectilePool(ECS::EntityPool* pool) {
+        m_projectilePool = pool;
+    }
+
     void Update(float deltaTime) override;
 
+    // Projectiles are spawned (or taken from the pool) through the command buffer
+    ECS::SystemAccess GetAccess() const override {
+        return ECS::Access<
+            ECS::Write<ECS::WeaponComponent>,
+            ECS::Write<ECS::HealthComponent>,
+            ECS::Read<ECS::TransformComponent>,
+            ECS::Read<ECS::InputComponent>,
+            ECS::Read<ECS::PlayerControllerComponent>,
+            ECS::Read<ECS::ColliderComponent>,
+            ECS::Read<ECS::WorldMatrixComponent>,
+            ECS::Read<ECS::RenderComponent>>::Get();
+    }
+
 private:
     ECS::PhysicsSystem* m_physicsSystem = nullptr;
+    ECS::EntityPool* m_projectilePool = nullptr;
     Mesh* m_projectileMesh = nullptr;
     std::shared_ptr<Material> m_projectileMaterial = nullptr;
 
-    void FireWeapon(ECS::Entity entity, ECS::WeaponComponent& weapon, ECS::TransformComponent& transform);
-    void FireProjectile(ECS::Entity entity, ECS::TransformComponent& transform);
+    void FireWeapon(ECS::Entity entity, ECS::WeaponComponent& weapon, const ECS::TransformComponent& transform);
+    void FireProjectile(ECS::Entity entity, const ECS::TransformComponent& transform);
     
     // Simple ray-AABB intersection for hit detection
     bool RayAABBIntersect(
@@ -12,6 +12,7 @@
 #include "Physics/Collision.h"
 #include "Renderer/PostProcess.h"
 #include "Renderer/Renderer.h"
+#include "Config/GameConfig.h"
 
 Game::Game()
 {
@@ -30,6 +31,9 @@ bool Game::Initialize(HINSTANCE hInstance, int nCmdShow)
     {
         m_window.Initialize(hInstance, nCmdShow, L"MyGameDemo", L"MyGameDemoClass", WINDOW_WIDTH, WINDOW_HEIGHT);
         m_window.SetEventBus(&m_eventBus);
+        if (Config::EventTrace::Enabled) {
+            m_eventBus.StartRecording(Config::EventTrace::Capacity);
+        }
         
         m_graphics.Initialize(m_window.GetHWND(), WINDOW_WIDTH, WINDOW_HEIGHT);
         m_input.Initialize(m_window.GetHWND());
@@ -89,6 +93,9 @@ void Game::Update(float deltaTime)
     {
         m_scene->Update(deltaTime);
     }
+
+    // Deliver events queued during this frame
+    m_eventBus.ProcessEvents();
 }
 
 void Game::Render()
@@ -169,6 +176,12 @@ void Game::SubscribeToEvents()
             LOG_INFO(m_showDebugCollision ? "Debug Collision: ON" : "Debug Collision: OFF");
             e.Handled = true;
             break;
+        case VK_BACK:
+            if (m_scene) {
+                m_scene->RequestRewind(Config::Rewind::Seconds);
+            }
+            e.Handled = true;
+            break;
         case VK_F1:
             if (m_scene) {
                 m_scene->ToggleDebugUI();
@@ -176,6 +189,25 @@ void Game::SubscribeToEvents()
             }
             e.Handled = true;
             break;
+        case VK_F8:
+            if (m_eventBus.IsRecording()) {
+                m_eventBus.StopRecording();
+            } else {
+                m_eventBus.StartRecording(Config::EventTrace::Capacity);
+            }
+            LOG_INFO(m_eventBus.IsRecording() ? "Event Trace: ON" : "Event Trace: OFF");
+            e.Handled = true;
+            break;
+        case VK_F9:
+            try {
+                if (m_eventBus.SaveRecording(Config::EventTrace::Path)) {
+                    LOG_INFO("Event trace saved: " + Config::EventTrace::Path);
+                }
+            } catch (const std::exception& ex) {
+                LOG_ERROR(ex.what());
+            }
+            e.Handled = true;
+            break;
         }
     }, EventPriority::High);
     m_eventSubscriptions.push_back(keyId);
@@ -14,11 +14,13 @@
 #include "ECS/Systems/InputSystem.h"
 #include "ECS/Systems/ECSRenderSystem.h"
 #include "ECS/Systems/ECSMovementSystem.h"
+#include "ECS/Systems/TransformSystem.h"
 #include "Systems/PlayerMovementSystem.h"
 #include "ECS/Systems/CameraSystem.h"
 #include "Systems/HealthSystem.h"
 #include "Systems/WeaponSystem.h"
 #include "Systems/ProjectileSystem.h"
+#include "ECS/EntityPool.h"
 #include "Events/Event.h"
 #include "Events/EventBus.h"
 #include "Events/InputEvents.h"
@@ -33,7 +35,10 @@ Scene::Scene(AssetManager* assetManager, Graphics* graphics, Input* input, Event
       m_graphics(graphics),
       m_input(input),
       m_eventBus(eventBus),
-      m_dirLight{ {0.5f, -0.7f, 0.5f, 0.0f}, {0.2f, 0.2f, 0.3f, 1.0f} }
+      m_dirLight{ {0.5f, -0.7f, 0.5f, 0.0f}, {0.2f, 0.2f, 0.3f, 1.0f} },
+      m_timestep(Config::Simulation::TickRate, Config::Simulation::MaxStepsPerFrame),
+      m_spatialOrder(m_ecsComponentManager, Config::SpatialOrder::EntriesPerFrame),
+      m_rewindBuffer(m_ecsComponentManager, Config::Rewind::HistoryTicks, Config::Rewind::KeyframeInterval)
 {
     // Initialize Systems
     // Note: Order of adding systems doesn't matter - SystemPhase controls execution order
@@ -46,6 +51,7 @@ Scene::Scene(AssetManager* assetManager, Graphics* graphics, Input* input, Event
     m_inputSystem = m_systemManager.AddSystem<ECS::InputSystem>(m_ecsComponentManager, *m_input);
     m_ecsPhysicsSystem = m_systemManager.AddSystem<ECS::PhysicsSystem>(m_ecsComponentManager);
     m_ecsMovementSystem = m_systemManager.AddSystem<ECS::MovementSystem>(m_ecsComponentManager);
+    m_transformSystem = m_systemManager.AddSystem<ECS::TransformSystem>(m_ecsComponentManager); // After Physics (shared PostUpdate)
     m_ecsCameraSystem = m_systemManager.AddSystem<ECS::CameraSystem>(m_ecsComponentManager);
     
     // 2. Gameplay Systems (depend on Input)
@@ -56,9 +62,14 @@ Scene::Scene(AssetManager* assetManager, Graphics* graphics, Input* input, Event
     }
     m_projectileSystem = m_systemManager.AddSystem<ProjectileSystem>(m_ecsComponentManager);
     m_healthSystem = m_systemManager.AddSystem<HealthSystem>(m_ecsComponentManager);
+    m_healthSystem->SetBudget(ECS::SystemBudget::Entities(Config::Health::RegenEntitiesPerTick));
     
     // 3. Rendering System (needs to be updated manually or last)
     m_ecsRenderSystem = m_systemManager.AddSystem<ECS::RenderSystem>(m_ecsComponentManager);
+
+    // Transforms order the physics group with them (PhysicsSystem declares it in Init)
+    m_spatialOrder.Track<ECS::TransformComponent>();
+    m_spatialOrder.Track<ECS::ColliderComponent>();
     
     // Initialize UI
     m_crosshair = std::make_unique<Crosshair>();
@@ -106,6 +117,24 @@ void Scene::Load()
         projectileMat->SetShininess(32.0f);
         
         m_weaponSystem->SetProjectileAssets(sphereMesh.get(), projectileMat);
+
+        // Pre-warm the projectiles: firing then only toggles their enabled state
+        m_projectilePool = std::make_unique<ECS::EntityPool>(m_ecsComponentManager, Config::Projectiles::PoolSize,
+            [mesh = sphereMesh.get(), projectileMat](ECS::ComponentManager& components, ECS::Entity entity) {
+                components.AddComponent(entity, ECS::TransformComponent{ {0,0,0}, {0,0,0}, {0.5f, 0.5f, 0.5f} });
+                components.AddComponent(entity, ECS::RenderComponent{ mesh, projectileMat });
+                components.AddComponent(entity, ECS::PhysicsComponent{});
+                components.AddComponent(entity, ECS::ProjectileComponent{});
+            });
+        m_weaponSystem->SetProjectilePool(m_projectilePool.get());
+        if (m_projectileSystem) {
+            m_projectileSystem->SetProjectilePool(m_projectilePool.get());
+        }
+    }
+
+    // Start from spatial order; Update keeps it as things move
+    if (Config::SpatialOrder::Enabled) {
+        m_spatialOrder.SortAll();
     }
 
     // Force rebuild of render cache to ensure all loaded entities are visible
@@ -132,8 +161,58 @@ void Scene::Update(float deltaTime)
         m_timeAccum -= 1.0f;
     }
 
-    // Update ECS systems via SystemManager
-    m_systemManager.Update(deltaTime);
+    // Restore before the systems run (structural changes are not allowed during updates)
+    if (m_pendingRewindSeconds > 0.0f) {
+        RewindSeconds(m_pendingRewindSeconds);
+        m_pendingRewindSeconds = 0.0f;
+    }
+
+    // Simulation: fixed-length ticks (as many as the frame time covers), or one
+    // variable-length step per frame. Every tick is one rewind history entry.
+    float alpha = 1.0f;
+    if (Config::Simulation::FixedStep) {
+        const uint32_t steps = m_timestep.Advance(deltaTime);
+        for (uint32_t step = 0; step < steps; ++step) {
+            m_systemManager.UpdateSimulation(m_timestep.GetStep());
+            m_rewindBuffer.Capture(++m_simulationTick);
+        }
+        alpha = m_timestep.GetAlpha();
+    } else {
+        m_systemManager.UpdateSimulation(deltaTime);
+        m_rewindBuffer.Capture(++m_simulationTick);
+    }
+
+    // Between ticks and presentation no system iterates: move a slice of the arrays
+    // towards spatial order
+    if (Config::SpatialOrder::Enabled) {
+        m_spatialOrder.Step();
+    }
+
+    // Presentation: once per frame, drawn 'alpha' of the way from the previous tick
+    // to the latest one
+    m_ecsCameraSystem->SetInterpolationAlpha(alpha);
+    m_ecsRenderSystem->SetInterpolationAlpha(alpha);
+    m_systemManager.UpdatePresentation(deltaTime);
+}
+
+void Scene::RewindSeconds(float seconds)
+{
+    if (m_rewindBuffer.IsEmpty()) return;
+
+    // Fixed ticks convert exactly; variable ticks are frames (measured frame rate)
+    const float tickRate = Config::Simulation::FixedStep
+        ? m_timestep.GetTickRate()
+        : static_cast<float>(m_fps > 0 ? m_fps : 60);
+    uint64_t ticks = static_cast<uint64_t>(seconds * tickRate);
+    uint64_t newest = m_rewindBuffer.GetNewestTick();
+    uint64_t oldest = m_rewindBuffer.GetOldestTick();
+    uint64_t target = newest - oldest > ticks ? newest - ticks : oldest;
+
+    m_rewindBuffer.Rewind(target);
+    m_simulationTick = target;
+    m_timestep.Reset();
+
+    DebugUIRenderer::AddMessage(std::format("Rewound {} ticks", newest - target), 2.0f);
 }
 
 void Scene::Render(Renderer* renderer, UIRenderer* uiRenderer, bool showDebugCollision)
@@ -175,10 +254,8 @@ bool Scene::SetupCamera(Camera& outCamera, DirectX::XMMATRIX& outView, DirectX::
         DirectX::XMFLOAT3 position = transform.position;
         
         if (m_ecsComponentManager.HasComponent<ECS::CameraComponent>(cameraEntity)) {
-            auto& cameraComp = m_ecsComponentManager.GetComponent<ECS::CameraComponent>(cameraEntity);
-            position.x += cameraComp.positionOffset.x;
-            position.y += cameraComp.positionOffset.y;
-            position.z += cameraComp.positionOffset.z;
+            // Interpolated between simulation ticks by CameraSystem (offset included)
+            position = m_ecsComponentManager.GetComponent<ECS::CameraComponent>(cameraEntity).eyePosition;
         }
 
         float pitch = transform.rotation.x;
@@ -212,7 +289,9 @@ void Scene::RenderUI(Renderer* renderer, UIRenderer* uiRenderer, bool showDebugC
             renderer->GetPostProcess()->IsBloomEnabled(),
             showDebugCollision,
             m_ecsComponentManager,
-            activeCamera
+            activeCamera,
+            &m_rewindBuffer,
+            &m_systemManager
         );
     }
 
@@ -1,30 +1,37 @@
 #include "Systems/HealthSystem.h"
+#include "ECS/View.h"
 #include <iostream>
 #include <format>
 
 void HealthSystem::Update(float deltaTime) {
-    auto healthArray = m_componentManager.GetComponentArray<ECS::HealthComponent>();
+    // Damage marks health as changed: deaths are found the tick they happen.
+    // Both passes read const and write through GetComponent, so only entities whose
+    // health actually changed are marked (an always-marking pass would keep every
+    // visited entity in the next tick's 'damaged' view).
+    ECS::View<const ECS::HealthComponent, ECS::Changed<ECS::HealthComponent>> damaged(m_componentManager, GetLastRunTick());
     
-    // Iterate backwards to safely remove entities
-    for (int i = (int)healthArray->GetSize() - 1; i >= 0; --i) {
-        ECS::Entity entity = healthArray->GetEntityAtIndex(i);
-        ECS::HealthComponent& health = healthArray->GetData(entity);
+    damaged.Each([&](ECS::Entity entity, const ECS::HealthComponent& health) {
+        if (health.isDead) return;
 
-        if (health.isDead) continue;
+        // Death check (destroyed at the end of the phase)
+        if (health.currentHealth <= 0.0f) {
+            auto& dying = m_componentManager.GetComponent<ECS::HealthComponent>(entity);
+            dying.currentHealth = 0.0f;
+            dying.isDead = true;
+            Commands().DestroyEntity(entity);
+        }
+    });
+
+    // Regeneration: a slice of the entities per simulation tick, each catching up on the time it waited
+    EachSliced<const ECS::HealthComponent>(deltaTime, [&](ECS::Entity entity, const ECS::HealthComponent& health, float elapsed) {
+        if (health.isDead) return;
 
-        // Regeneration
         if (health.regenerationRate > 0.0f && health.currentHealth < health.maxHealth) {
-            health.currentHealth += health.regenerationRate * deltaTime;
-            if (health.currentHealth > health.maxHealth) {
-                health.currentHealth = health.maxHealth;
+            auto& healing = m_componentManager.GetComponent<ECS::HealthComponent>(entity);
+            healing.currentHealth += healing.regenerationRate * elapsed;
+            if (healing.currentHealth > healing.maxHealth) {
+                healing.currentHealth = healing.maxHealth;
             }
         }
-
-        // Death check
-        if (health.currentHealth <= 0.0f) {
-            health.currentHealth = 0.0f;
-            health.isDead = true;
-            m_componentManager.DestroyEntity(entity);
-        }
-    }
+    });
 }
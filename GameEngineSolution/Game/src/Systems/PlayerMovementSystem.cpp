@@ -1,4 +1,5 @@
 #include "Systems/PlayerMovementSystem.h"
+#include "ECS/View.h"
 #include <DirectXMath.h>
 #include "Utils/Logger.h"
 
@@ -14,23 +15,18 @@ void PlayerMovementSystem::Init() {
 }
 
 void PlayerMovementSystem::Update(float deltaTime) {
-    // Use Query API to get entities with Controller, Transform, and Input
-    auto entities = m_componentManager.QueryEntities<PlayerControllerComponent, TransformComponent, InputComponent>();
+    // Iterate entities with Controller, Transform, and Input
+    View<PlayerControllerComponent, TransformComponent, const InputComponent> view(m_componentManager);
     
-    for (Entity entity : entities) {
-        auto& controller = m_componentManager.GetComponent<PlayerControllerComponent>(entity);
-        auto& transform = m_componentManager.GetComponent<TransformComponent>(entity);
-        auto& input = m_componentManager.GetComponent<InputComponent>(entity);
-        
+    view.Each([&](Entity entity, PlayerControllerComponent& controller, TransformComponent& transform, const InputComponent& input) {
         // Handle mouse look and camera
         HandleMouseLook(entity, transform, controller, input, deltaTime);
         
         // Handle movement (WASD) and Jump
-        if (m_componentManager.HasComponent<PhysicsComponent>(entity)) {
-            auto& physics = m_componentManager.GetComponent<PhysicsComponent>(entity);
-            HandleMovement(entity, transform, physics, controller, input, deltaTime);
+        if (PhysicsComponent* physics = m_componentManager.GetComponentPtr<PhysicsComponent>(entity)) {
+            HandleMovement(entity, transform, *physics, controller, input, deltaTime);
         }
-    }
+    });
 }
 
 void PlayerMovementSystem::HandleMovement(Entity entity, TransformComponent& transform, PhysicsComponent& physics,
@@ -1,20 +1,24 @@
 #include "Systems/ProjectileSystem.h"
+#include "ECS/Systems/TransformSystem.h"
+#include "ECS/EntityPool.h"
 #include "Renderer/Mesh.h"
 #include <iostream>
 #include <format>
+#include <utility>
 
 void ProjectileSystem::Update(float deltaTime) {
     auto projectileArray = m_componentManager.GetComponentArray<ECS::ProjectileComponent>();
     
-    // Iterate backwards to safely remove entities
-    for (int i = (int)projectileArray->GetSize() - 1; i >= 0; --i) {
+    // Expired/hit projectiles are retired through the command buffer at the end of the phase
+    for (size_t i = 0; i < projectileArray->GetSize(); ++i) {
         ECS::Entity entity = projectileArray->GetEntityAtIndex(i);
+        if (!m_componentManager.IsEntityEnabled(entity)) continue; // Parked in the pool
         ECS::ProjectileComponent& projectile = projectileArray->GetData(entity);
 
         // Update lifetime
         projectile.lifetime -= deltaTime;
         if (projectile.lifetime <= 0.0f) {
-            m_componentManager.DestroyEntity(entity);
+            RetireProjectile(entity);
             continue;
         }
 
@@ -40,27 +44,22 @@ void ProjectileSystem::Update(float deltaTime) {
         for (size_t j = 0; j < colliderArray->GetSize(); ++j) {
             ECS::Entity targetEntity = colliderArray->GetEntityAtIndex(j);
             if (targetEntity == entity) continue; // Don't hit self
+            if (!m_componentManager.IsEntityEnabled(targetEntity)) continue;
 
             if (!m_componentManager.HasComponent<ECS::TransformComponent>(targetEntity)) continue;
-            auto& targetTransform = m_componentManager.GetComponent<ECS::TransformComponent>(targetEntity);
-            auto& collider = colliderArray->GetData(targetEntity);
+            const auto& targetTransform = std::as_const(m_componentManager).GetComponent<ECS::TransformComponent>(targetEntity);
+            const auto& collider = std::as_const(*colliderArray).GetData(targetEntity);
             
             if (!collider.enabled) continue;
 
             // Check point vs AABB
             if (m_componentManager.HasComponent<ECS::TransformComponent>(entity)) {
-                auto& projTransform = m_componentManager.GetComponent<ECS::TransformComponent>(entity);
+                const auto& projTransform = std::as_const(m_componentManager).GetComponent<ECS::TransformComponent>(entity);
                 
-                float minX = targetTransform.position.x + (collider.localAABB.center.x - collider.localAABB.extents.x) * targetTransform.scale.x;
-                float maxX = targetTransform.position.x + (collider.localAABB.center.x + collider.localAABB.extents.x) * targetTransform.scale.x;
-                float minY = targetTransform.position.y + (collider.localAABB.center.y - collider.localAABB.extents.y) * targetTransform.scale.y;
-                float maxY = targetTransform.position.y + (collider.localAABB.center.y + collider.localAABB.extents.y) * targetTransform.scale.y;
-                float minZ = targetTransform.position.z + (collider.localAABB.center.z - collider.localAABB.extents.z) * targetTransform.scale.z;
-                float maxZ = targetTransform.position.z + (collider.localAABB.center.z + collider.localAABB.extents.z) * targetTransform.scale.z;
-
-                if (projTransform.position.x >= minX && projTransform.position.x <= maxX &&
-                    projTransform.position.y >= minY && projTransform.position.y <= maxY &&
-                    projTransform.position.z >= minZ && projTransform.position.z <= maxZ) {
+                AABB worldBounds = ECS::TransformSystem::GetWorldBounds(m_componentManager, targetEntity, targetTransform, collider.localAABB);
+                AABB point{ projTransform.position, { 0.0f, 0.0f, 0.0f } };
+
+                if (AABBIntersects(point, worldBounds)) {
                     hit = true;
                     hitEntity = targetEntity;
                     break;
@@ -74,19 +73,20 @@ void ProjectileSystem::Update(float deltaTime) {
             for (size_t j = 0; j < healthArray->GetSize(); ++j) {
                 ECS::Entity targetEntity = healthArray->GetEntityAtIndex(j);
                 if (targetEntity == entity) continue; // Don't hit self
+                if (!m_componentManager.IsEntityEnabled(targetEntity)) continue;
                 
                 // Skip if already checked (has Collider)
                 if (m_componentManager.HasComponent<ECS::ColliderComponent>(targetEntity)) continue;
 
                 if (!m_componentManager.HasComponent<ECS::TransformComponent>(targetEntity)) continue;
-                auto& targetTransform = m_componentManager.GetComponent<ECS::TransformComponent>(targetEntity);
+                const auto& targetTransform = std::as_const(m_componentManager).GetComponent<ECS::TransformComponent>(targetEntity);
                 
                 // Determine collision bounds
                 AABB localBounds;
                 bool hasBounds = false;
 
                 if (m_componentManager.HasComponent<ECS::RenderComponent>(targetEntity)) {
-                    auto& render = m_componentManager.GetComponent<ECS::RenderComponent>(targetEntity);
+                    const auto& render = std::as_const(m_componentManager).GetComponent<ECS::RenderComponent>(targetEntity);
                     if (render.mesh) {
                         localBounds = render.mesh->GetLocalBounds();
                         hasBounds = true;
@@ -99,18 +99,12 @@ void ProjectileSystem::Update(float deltaTime) {
                 }
 
                 if (m_componentManager.HasComponent<ECS::TransformComponent>(entity)) {
-                    auto& projTransform = m_componentManager.GetComponent<ECS::TransformComponent>(entity);
+                    const auto& projTransform = std::as_const(m_componentManager).GetComponent<ECS::TransformComponent>(entity);
                     
-                    float minX = targetTransform.position.x + (localBounds.center.x - localBounds.extents.x) * targetTransform.scale.x;
-                    float maxX = targetTransform.position.x + (localBounds.center.x + localBounds.extents.x) * targetTransform.scale.x;
-                    float minY = targetTransform.position.y + (localBounds.center.y - localBounds.extents.y) * targetTransform.scale.y;
-                    float maxY = targetTransform.position.y + (localBounds.center.y + localBounds.extents.y) * targetTransform.scale.y;
-                    float minZ = targetTransform.position.z + (localBounds.center.z - localBounds.extents.z) * targetTransform.scale.z;
-                    float maxZ = targetTransform.position.z + (localBounds.center.z + localBounds.extents.z) * targetTransform.scale.z;
-
-                    if (projTransform.position.x >= minX && projTransform.position.x <= maxX &&
-                        projTransform.position.y >= minY && projTransform.position.y <= maxY &&
-                        projTransform.position.z >= minZ && projTransform.position.z <= maxZ) {
+                    AABB worldBounds = ECS::TransformSystem::GetWorldBounds(m_componentManager, targetEntity, targetTransform, localBounds);
+                    AABB point{ projTransform.position, { 0.0f, 0.0f, 0.0f } };
+
+                    if (AABBIntersects(point, worldBounds)) {
                         hit = true;
                         hitEntity = targetEntity;
                         break;
@@ -128,8 +122,15 @@ void ProjectileSystem::Update(float deltaTime) {
                 health.currentHealth -= projectile.damage;
             }
             
-            m_componentManager.DestroyEntity(entity); // Destroy projectile
+            RetireProjectile(entity);
             continue; // Move to next projectile
         }
     }
 }
+
+void ProjectileSystem::RetireProjectile(ECS::Entity entity) {
+    // Pooled projectiles are parked for reuse; others (pool exhausted) are destroyed
+    if (!m_projectilePool || !m_projectilePool->Release(entity, Commands())) {
+        Commands().DestroyEntity(entity);
+    }
+}
@@ -1,6 +1,9 @@
 #define NOMINMAX
 #include "Systems/WeaponSystem.h"
 #include "ECS/Systems/ECSPhysicsSystem.h"
+#include "ECS/Systems/TransformSystem.h"
+#include "ECS/View.h"
+#include "ECS/EntityPool.h"
 #include "UI/DebugUIRenderer.h"
 #include "Renderer/Mesh.h"
 #include "Utils/Logger.h"
@@ -8,16 +11,14 @@
 #include <format>
 #include <cmath>
 #include <algorithm> // For std::max
+#include <utility>
 
 void WeaponSystem::Update(float deltaTime) {
     // Query for entities with Weapon, Transform, and Input (Controlled entities)
-    auto entities = m_componentManager.QueryEntities<ECS::WeaponComponent, ECS::TransformComponent, ECS::InputComponent>();
+    // Transform and input are only read: const keeps them out of the change ticks
+    ECS::View<ECS::WeaponComponent, const ECS::TransformComponent, const ECS::InputComponent> view(m_componentManager);
     
-    for (ECS::Entity entity : entities) {
-        ECS::WeaponComponent& weapon = m_componentManager.GetComponent<ECS::WeaponComponent>(entity);
-        ECS::TransformComponent& transform = m_componentManager.GetComponent<ECS::TransformComponent>(entity);
-        ECS::InputComponent& input = m_componentManager.GetComponent<ECS::InputComponent>(entity);
-
+    view.Each([&](ECS::Entity entity, ECS::WeaponComponent& weapon, const ECS::TransformComponent& transform, const ECS::InputComponent& input) {
         // Cooldown management
         if (weapon.timeSinceLastShot < weapon.fireRate) {
             weapon.timeSinceLastShot += deltaTime;
@@ -42,17 +43,32 @@ void WeaponSystem::Update(float deltaTime) {
                 weapon.projectileAmmo--; 
             }
         }
-    }
+    });
 }
 
-void WeaponSystem::FireProjectile(ECS::Entity entity, ECS::TransformComponent& transform) {
-    // Create projectile entity
-    ECS::Entity projectile = m_componentManager.CreateEntity();
+void WeaponSystem::FireProjectile(ECS::Entity entity, const ECS::TransformComponent& transform) {
+    // Take a parked projectile from the pool (enabled at the end of the phase); create
+    // one only if the pool is exhausted
+    ECS::CommandBuffer& commands = Commands();
+    ECS::Entity projectile = m_projectilePool ? m_projectilePool->Acquire(commands) : ECS::NULL_ENTITY;
+    const bool pooled = projectile != ECS::NULL_ENTITY;
+    if (!pooled) {
+        projectile = commands.CreateEntity();
+    }
+
+    // Pooled entities already have every component: overwrite them without events
+    auto writeComponent = [&](auto component) {
+        if (pooled) {
+            commands.SetComponent(projectile, std::move(component));
+        } else {
+            commands.AddComponent(projectile, std::move(component));
+        }
+    };
     
     // Calculate spawn position (same as ray origin)
     DirectX::XMFLOAT3 spawnPos = transform.position;
     if (m_componentManager.HasComponent<ECS::PlayerControllerComponent>(entity)) {
-        auto& pc = m_componentManager.GetComponent<ECS::PlayerControllerComponent>(entity);
+        const auto& pc = std::as_const(m_componentManager).GetComponent<ECS::PlayerControllerComponent>(entity);
         spawnPos.y += pc.cameraHeight;
     }
 
@@ -60,7 +76,7 @@ void WeaponSystem::FireProjectile(ECS::Entity entity, ECS::TransformComponent& t
     float pitch = transform.rotation.x;
     float yaw = transform.rotation.y;
     if (m_componentManager.HasComponent<ECS::PlayerControllerComponent>(entity)) {
-        pitch = m_componentManager.GetComponent<ECS::PlayerControllerComponent>(entity).viewPitch;
+        pitch = std::as_const(m_componentManager).GetComponent<ECS::PlayerControllerComponent>(entity).viewPitch;
     }
 
     DirectX::XMFLOAT3 dir;
@@ -77,28 +93,30 @@ void WeaponSystem::FireProjectile(ECS::Entity entity, ECS::TransformComponent& t
     spawnPos.y += dir.y * 1.0f;
     spawnPos.z += dir.z * 1.0f;
 
-    // Add components
-    m_componentManager.AddComponent(projectile, ECS::TransformComponent{ spawnPos, {0,0,0}, {0.5f, 0.5f, 0.5f} });
-    m_componentManager.AddComponent(projectile, ECS::RenderComponent{ m_projectileMesh, m_projectileMaterial });
+    // Add components (the pool's prefab already carries the render component)
+    writeComponent(ECS::TransformComponent{ spawnPos, {0,0,0}, {0.5f, 0.5f, 0.5f} });
+    if (!pooled) {
+        commands.AddComponent(projectile, ECS::RenderComponent{ m_projectileMesh, m_projectileMaterial });
+    }
     
     ECS::PhysicsComponent physics;
     physics.useGravity = true;
     physics.mass = 1.0f;
     physics.velocity = { dir.x * 10.0f, dir.y * 10.0f, dir.z * 10.0f }; // Speed 10
     physics.checkCollisions = false; // Handled by ProjectileSystem manually for now
-    m_componentManager.AddComponent(projectile, physics);
+    writeComponent(physics);
 
     ECS::ProjectileComponent projComp;
     projComp.damage = 20.0f;
     projComp.lifetime = 5.0f;
     projComp.speed = 10.0f;
     projComp.velocity = physics.velocity; // Redundant but used by ProjectileSystem
-    m_componentManager.AddComponent(projectile, projComp);
+    writeComponent(projComp);
 
-    LOG_INFO("Fired Projectile! Entity: " + std::to_string(projectile.id) + " Mesh: " + (m_projectileMesh ? "Valid" : "NULL"));
+    LOG_INFO(m_projectileMesh ? "Fired Projectile! Mesh: Valid" : "Fired Projectile! Mesh: NULL");
 }
 
-void WeaponSystem::FireWeapon(ECS::Entity entity, ECS::WeaponComponent& weapon, ECS::TransformComponent& transform) {
+void WeaponSystem::FireWeapon(ECS::Entity entity, ECS::WeaponComponent& weapon, const ECS::TransformComponent& transform) {
     weapon.timeSinceLastShot = 0.0f;
     weapon.currentAmmo--;
 
@@ -108,7 +126,7 @@ void WeaponSystem::FireWeapon(ECS::Entity entity, ECS::WeaponComponent& weapon,
     
     // Adjust for camera height if available
     if (m_componentManager.HasComponent<ECS::PlayerControllerComponent>(entity)) {
-        auto& pc = m_componentManager.GetComponent<ECS::PlayerControllerComponent>(entity);
+        const auto& pc = std::as_const(m_componentManager).GetComponent<ECS::PlayerControllerComponent>(entity);
         rayOrigin.y += pc.cameraHeight;
     }
 
@@ -119,7 +137,7 @@ void WeaponSystem::FireWeapon(ECS::Entity entity, ECS::WeaponComponent& weapon,
     
     // If player controller exists, use its view pitch
     if (m_componentManager.HasComponent<ECS::PlayerControllerComponent>(entity)) {
-        pitch = m_componentManager.GetComponent<ECS::PlayerControllerComponent>(entity).viewPitch;
+        pitch = std::as_const(m_componentManager).GetComponent<ECS::PlayerControllerComponent>(entity).viewPitch;
     }
 
     DirectX::XMFLOAT3 rayDir;
@@ -139,44 +157,39 @@ void WeaponSystem::FireWeapon(ECS::Entity entity, ECS::WeaponComponent& weapon,
     ECS::Entity hitEntity = ECS::NULL_ENTITY;
     float minDistance = weapon.range;
 
+    // Narrowphase against a target's world-space bounds; keeps the nearest hit
+    auto testTarget = [&](ECS::Entity targetEntity, const ECS::TransformComponent& targetTransform, const AABB& localBounds) {
+        AABB worldBounds = ECS::TransformSystem::GetWorldBounds(m_componentManager, targetEntity, targetTransform, localBounds);
+        DirectX::XMFLOAT3 minBox = { worldBounds.center.x - worldBounds.extents.x, worldBounds.center.y - worldBounds.extents.y, worldBounds.center.z - worldBounds.extents.z };
+        DirectX::XMFLOAT3 maxBox = { worldBounds.center.x + worldBounds.extents.x, worldBounds.center.y + worldBounds.extents.y, worldBounds.center.z + worldBounds.extents.z };
+
+        float t = 0.0f;
+        if (RayAABBIntersect(rayOrigin, rayDir, minBox, maxBox, t) && t < minDistance) {
+            minDistance = t;
+            hitEntity = targetEntity;
+        }
+    };
+
     if (m_physicsSystem) {
         // Broadphase: Get candidates from grid
         const auto& grid = m_physicsSystem->GetSpatialGrid();
         std::vector<ECS::Entity> candidates = grid.Raycast(rayOrigin, rayDir, weapon.range);
 
-        // Narrowphase: Check candidates
+        // Narrowphase: Check candidates (the grid drops destroyed/disabled entities
+        // only when PhysicsSystem next drains its reactive queue)
         for (ECS::Entity targetEntity : candidates) {
             if (targetEntity == entity) continue;
+            if (!m_componentManager.IsEntityEnabled(targetEntity)) continue;
 
             if (!m_componentManager.HasComponent<ECS::ColliderComponent>(targetEntity)) continue;
             if (!m_componentManager.HasComponent<ECS::TransformComponent>(targetEntity)) continue;
 
-            auto& targetTransform = m_componentManager.GetComponent<ECS::TransformComponent>(targetEntity);
-            auto& collider = m_componentManager.GetComponent<ECS::ColliderComponent>(targetEntity);
+            const auto& targetTransform = std::as_const(m_componentManager).GetComponent<ECS::TransformComponent>(targetEntity);
+            const auto& collider = std::as_const(m_componentManager).GetComponent<ECS::ColliderComponent>(targetEntity);
             
             if (!collider.enabled) continue;
 
-            // Calculate World AABB
-            DirectX::XMFLOAT3 minBox, maxBox;
-            
-            float cx = targetTransform.position.x + collider.localAABB.center.x * targetTransform.scale.x;
-            float cy = targetTransform.position.y + collider.localAABB.center.y * targetTransform.scale.y;
-            float cz = targetTransform.position.z + collider.localAABB.center.z * targetTransform.scale.z;
-            
-            float ex = collider.localAABB.extents.x * std::abs(targetTransform.scale.x);
-            float ey = collider.localAABB.extents.y * std::abs(targetTransform.scale.y);
-            float ez = collider.localAABB.extents.z * std::abs(targetTransform.scale.z);
-
-            minBox = { cx - ex, cy - ey, cz - ez };
-            maxBox = { cx + ex, cy + ey, cz + ez };
-
-            float t = 0.0f;
-            if (RayAABBIntersect(rayOrigin, rayDir, minBox, maxBox, t)) {
-                if (t < minDistance) {
-                    minDistance = t;
-                    hitEntity = targetEntity;
-                }
-            }
+            testTarget(targetEntity, targetTransform, collider.localAABB);
         }
     } else {
         // Fallback: O(N) Iteration over ColliderComponent array
@@ -184,34 +197,15 @@ void WeaponSystem::FireWeapon(ECS::Entity entity, ECS::WeaponComponent& weapon,
         for (size_t i = 0; i < colliderArray->GetSize(); ++i) {
             ECS::Entity targetEntity = colliderArray->GetEntityAtIndex(i);
             if (targetEntity == entity) continue;
+            if (!m_componentManager.IsEntityEnabled(targetEntity)) continue;
 
             if (!m_componentManager.HasComponent<ECS::TransformComponent>(targetEntity)) continue;
-            auto& targetTransform = m_componentManager.GetComponent<ECS::TransformComponent>(targetEntity);
-            auto& collider = colliderArray->GetData(targetEntity);
+            const auto& targetTransform = std::as_const(m_componentManager).GetComponent<ECS::TransformComponent>(targetEntity);
+            const auto& collider = std::as_const(*colliderArray).GetData(targetEntity);
             
             if (!collider.enabled) continue;
 
-            // Calculate World AABB
-            DirectX::XMFLOAT3 minBox, maxBox;
-            
-            float cx = targetTransform.position.x + collider.localAABB.center.x * targetTransform.scale.x;
-            float cy = targetTransform.position.y + collider.localAABB.center.y * targetTransform.scale.y;
-            float cz = targetTransform.position.z + collider.localAABB.center.z * targetTransform.scale.z;
-            
-            float ex = collider.localAABB.extents.x * std::abs(targetTransform.scale.x);
-            float ey = collider.localAABB.extents.y * std::abs(targetTransform.scale.y);
-            float ez = collider.localAABB.extents.z * std::abs(targetTransform.scale.z);
-
-            minBox = { cx - ex, cy - ey, cz - ez };
-            maxBox = { cx + ex, cy + ey, cz + ez };
-
-            float t = 0.0f;
-            if (RayAABBIntersect(rayOrigin, rayDir, minBox, maxBox, t)) {
-                if (t < minDistance) {
-                    minDistance = t;
-                    hitEntity = targetEntity;
-                }
-            }
+            testTarget(targetEntity, targetTransform, collider.localAABB);
         }
     }
 
@@ -220,19 +214,20 @@ void WeaponSystem::FireWeapon(ECS::Entity entity, ECS::WeaponComponent& weapon,
     for (size_t i = 0; i < healthArray->GetSize(); ++i) {
         ECS::Entity targetEntity = healthArray->GetEntityAtIndex(i);
         if (targetEntity == entity) continue; // Don't hit self
+        if (!m_componentManager.IsEntityEnabled(targetEntity)) continue;
         
         // Skip if already checked (has Collider)
         if (m_componentManager.HasComponent<ECS::ColliderComponent>(targetEntity)) continue;
 
         if (!m_componentManager.HasComponent<ECS::TransformComponent>(targetEntity)) continue;
-        auto& targetTransform = m_componentManager.GetComponent<ECS::TransformComponent>(targetEntity);
+        const auto& targetTransform = std::as_const(m_componentManager).GetComponent<ECS::TransformComponent>(targetEntity);
 
         // Determine collision bounds (Render or Default)
         AABB localBounds;
         bool hasBounds = false;
 
         if (m_componentManager.HasComponent<ECS::RenderComponent>(targetEntity)) {
-            auto& render = m_componentManager.GetComponent<ECS::RenderComponent>(targetEntity);
+            const auto& render = std::as_const(m_componentManager).GetComponent<ECS::RenderComponent>(targetEntity);
             if (render.mesh) {
                 localBounds = render.mesh->GetLocalBounds();
                 hasBounds = true;
@@ -244,27 +239,7 @@ void WeaponSystem::FireWeapon(ECS::Entity entity, ECS::WeaponComponent& weapon,
             localBounds.extents = { 0.5f, 0.5f, 0.5f }; // Default 1.0 size
         }
 
-        // Calculate World AABB
-        DirectX::XMFLOAT3 minBox, maxBox;
-        
-        float cx = targetTransform.position.x + localBounds.center.x * targetTransform.scale.x;
-        float cy = targetTransform.position.y + localBounds.center.y * targetTransform.scale.y;
-        float cz = targetTransform.position.z + localBounds.center.z * targetTransform.scale.z;
-        
-        float ex = localBounds.extents.x * std::abs(targetTransform.scale.x);
-        float ey = localBounds.extents.y * std::abs(targetTransform.scale.y);
-        float ez = localBounds.extents.z * std::abs(targetTransform.scale.z);
-
-        minBox = { cx - ex, cy - ey, cz - ez };
-        maxBox = { cx + ex, cy + ey, cz + ez };
-
-        float t = 0.0f;
-        if (RayAABBIntersect(rayOrigin, rayDir, minBox, maxBox, t)) {
-            if (t < minDistance) {
-                minDistance = t;
-                hitEntity = targetEntity;
-            }
-        }
+        testTarget(targetEntity, targetTransform, localBounds);
     }
 
     if (hitEntity != ECS::NULL_ENTITY) {